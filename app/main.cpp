@@ -50,6 +50,7 @@ void initialize_cli_options(program_options& cli_options)
                         "interpreter options> <file to process> "
                         "<args to pass to python script>");
     generic_options.add("--volatile-mode", "prevents hal from creating a .hal progress file (e.g. cluster use)");
+    generic_options.add("--binary-hal-file", "writes the .hal progress file in the binary format, which is faster to load for large netlists");
     generic_options.add("--no-log", "prevents hal from creating a .log file");
 
     /* initialize hdl parser options */
@@ -310,7 +311,14 @@ int main(int argc, const char* argv[])
     {
         auto path = file_name;
         path.replace_extension(".hal");
-        netlist_serializer::serialize_to_file(netlist, path);
+        if (args.is_option_set("--binary-hal-file"))
+        {
+            netlist_serializer::serialize_to_binary_file(netlist, path);
+        }
+        else
+        {
+            netlist_serializer::serialize_to_file(netlist, path);
+        }
     }
 
     /* handle file writer */
@@ -77,11 +77,16 @@ if(APPLE AND CMAKE_HOST_APPLE)
     endif()
 else()
     find_package(OpenMP REQUIRED)
-    if(OpenMP_FOUND)
-        set(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} ${OpenMP_C_FLAGS}" PARENT_SCOPE)
-        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${OpenMP_CXX_FLAGS}" PARENT_SCOPE)
-        set(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} ${OpenMP_EXE_LINKER_FLAGS}" PARENT_SCOPE)
-    endif()
+endif()
+
+# Targets using OpenMP link against OpenMP::OpenMP_CXX, the workaround above only provides the flags
+if(NOT TARGET OpenMP::OpenMP_CXX)
+    separate_arguments(OpenMP_CXX_OPTIONS UNIX_COMMAND "${OpenMP_CXX_FLAGS}")
+    add_library(OpenMP::OpenMP_CXX INTERFACE IMPORTED)
+    set_target_properties(OpenMP::OpenMP_CXX PROPERTIES
+                          INTERFACE_COMPILE_OPTIONS "${OpenMP_CXX_OPTIONS}"
+                          INTERFACE_LINK_LIBRARIES "${OpenMP_CXX_OPTIONS};${Additional_OpenMP_Libraries_Workaround}"
+                          )
 endif()
 
 ################################
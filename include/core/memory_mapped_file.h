@@ -0,0 +1,88 @@
+//  MIT License
+//
+//  Copyright (c) 2019 Ruhr-University Bochum, Germany, Chair for Embedded Security. All Rights reserved.
+//  Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#pragma once
+
+#include "def.h"
+
+#include <string>
+#include <string_view>
+
+/**
+ * @ingroup core
+ */
+class CORE_API memory_mapped_file
+{
+public:
+    memory_mapped_file();
+
+    ~memory_mapped_file();
+
+    memory_mapped_file(const memory_mapped_file&) = delete;
+    memory_mapped_file& operator=(const memory_mapped_file&) = delete;
+
+    /**
+     * Maps a file read-only into memory.
+     * A previously mapped file is unmapped first.
+     *
+     * @param[in] file_name - Name of the file.
+     * @returns True on success.
+     */
+    bool map_file(const std::string& file_name);
+
+    /**
+     * Unmaps the file.
+     * All views into the file become invalid.
+     *
+     * @returns True on success, false if no file is mapped.
+     */
+    bool unmap_file();
+
+    /**
+     * Gets the file name of the mapped file.
+     *
+     * @returns The file name.
+     */
+    std::string get_file_name() const;
+
+    /**
+     * Gets a view of the entire content of the mapped file.
+     * The view is valid until the file is unmapped.
+     *
+     * @returns The content of the file.
+     */
+    std::string_view get_data() const;
+
+private:
+    // stores the file name of the mapped file
+    std::string m_file_name;
+
+    // stores the start address and size of the mapping
+    const char* m_data;
+    u64 m_size;
+
+#ifdef _WIN32
+    // stores the file content, since files are read instead of mapped on windows
+    std::string m_content;
+#endif
+};
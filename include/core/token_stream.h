@@ -27,6 +27,9 @@
 
 #include <algorithm>
 #include <map>
+#include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 /**
@@ -36,20 +39,21 @@
 struct CORE_API token
 {
     /**
-     * Base token class that holds a string and a line number.
+     * Base token class that holds a view of a string and a line number.
+     * The token does not own the string, so it must outlive the token, see token_stream::text_storage.
      * Can be set to be case insensitive in all string comparisons (default).
      *
      * @param[in] n - the line number
      * @param[in] s - the string
      * @param[in] cs - if true, string comparisons are case sensitive
      */
-    token(u32 n, const std::string s, bool cs = true);
+    token(u32 n, std::string_view s, bool cs = true);
 
     // the line number
     u32 number;
 
-    // the contained string
-    std::string string;
+    // a view of the contained string
+    std::string_view string;
 
     // if true, string comparisons are case sensitive
     bool case_sensitive;
@@ -61,19 +65,12 @@ struct CORE_API token
 
     /**
      * Assigns a new string to this token.
+     * The string must outlive the token.
      *
      * @param[in] s - the new string
      * @returns A reference to this token.
      */
-    token& operator=(const std::string& s);
-
-    /**
-     * Extends the string in this token.
-     *
-     * @param[in] s - the string to add
-     * @returns A reference to this token.
-     */
-    token& operator+=(const std::string& s);
+    token& operator=(std::string_view s);
 
     /**
      * Checks if the string in this token is equal to another string.
@@ -82,7 +79,7 @@ struct CORE_API token
      * @param[in] s - the string to check against
      * @returns True if both strings are equal.
      */
-    bool operator==(const std::string& s) const;
+    bool operator==(std::string_view s) const;
 
     /**
      * Checks if the string in this token is unequal to another string.
@@ -91,7 +88,7 @@ struct CORE_API token
      * @param[in] s - the string to check against
      * @returns True if both strings are not equal.
      */
-    bool operator!=(const std::string& s) const;
+    bool operator!=(std::string_view s) const;
 };
 
 class NETLIST_API token_stream
@@ -106,6 +103,31 @@ public:
     // constant that can be returned by find next.
     static const u32 END_OF_STREAM = 0xFFFFFFFF;
 
+    /**
+     * Owns the strings of tokens that are not a slice of the tokenized input, e.g., joined tokens.
+     * Strings are copied into large blocks, so storing a string rarely allocates and stored strings never move.
+     */
+    class text_storage
+    {
+    public:
+        text_storage();
+
+        /**
+         * Copies a string into the storage.
+         *
+         * @param[in] s - the string to store
+         * @returns A view of the stored string that is valid as long as the storage exists.
+         */
+        std::string_view store(std::string_view s);
+
+    private:
+        static const u32 BLOCK_SIZE = 64 * 1024;
+
+        std::vector<std::unique_ptr<char[]>> m_blocks;
+        char* m_current;
+        u64 m_remaining;
+    };
+
     /**
      * Constructor for an empty token stream.
      * The increase-level and decrease-level tokens are used for level-aware iteration.
@@ -129,12 +151,32 @@ public:
      */
     token_stream(const std::vector<token>& init, const std::vector<std::string>& increase_level_tokens = {"("}, const std::vector<std::string>& decrease_level_tokens = {")"});
 
+    /**
+     * Initialization constructor that takes ownership of the strings the tokens refer to.
+     * The stream and all streams extracted from it share the tokens and the storage.
+     * The increase-level and decrease-level tokens are used for level-aware iteration.
+     *
+     * @param[in] init - a token vector to initialize with
+     * @param[in] storage - the storage of all token strings that are not owned by the caller
+     * @param[in] decrease_level_tokens - the tokens that mark the start of a new level, i.e., increase the level.
+     * @param[in] increase_level_tokens - the tokens that mark the end of a level, i.e., decrease the level.
+     */
+    token_stream(std::vector<token>&& init,
+                 text_storage&& storage,
+                 const std::vector<std::string>& increase_level_tokens = {"("},
+                 const std::vector<std::string>& decrease_level_tokens = {")"});
+
     /**
      * Copy constructor.
+     * The copy shares the tokens with the original stream, only the position is copied.
      *
      * @param[in] other - the token stream to copy
      */
-    token_stream(const token_stream& other);
+    token_stream(const token_stream& other) = default;
+    token_stream(token_stream&& other)      = default;
+
+    token_stream& operator=(const token_stream& other) = default;
+    token_stream& operator=(token_stream&& other) = default;
 
     /**
      * Consume the next token(s) in the stream.
@@ -174,7 +216,7 @@ public:
     /**
      * Consume the next tokens in the stream until a token matches the given string.
      * This final token is not consumed, i.e., it is now the next token in the stream.
-     * All consumed tokens are returned as a new token stream.
+     * All consumed tokens are returned as a new token stream that shares the tokens with this stream, i.e., nothing is copied.
      * Consumes until the given end position if no token matches the given string, i.e., the entire rest of the stream is returned as a new stream.
      * Can be set to be level-aware with respect to the configured level-down and level-up tokens.
      *
@@ -190,7 +232,7 @@ public:
      * Consume the next tokens in the stream until a token matches the given string.
      * This final token is not consumed, i.e., it is now the next token in the stream.
      * The strings of all consumed tokens are joined with the given joiner string and returned as a new token.
-     * The returned token has the line number of the first consumed token.
+     * The returned token has the line number of the first consumed token, its string is kept in the storage of the stream.
      * Joins until the given end position if no token matches the given string until that point.
      * Can be set to be level-aware with respect to the configured level-down and level-up tokens.
      *
@@ -206,7 +248,7 @@ public:
     /**
      * Consume all remaining tokens in the stream.
      * The strings of all consumed tokens are joined with the given joiner string and returned as a new token.
-     * The returned token has the line number of the first consumed token.
+     * The returned token has the line number of the first consumed token, its string is kept in the storage of the stream.
      *
      * @param[in] joiner - the string used to join consumed tokens.
      * @returns The joined token.
@@ -293,9 +335,23 @@ public:
     void set_position(u32 p);
 
 private:
+    // the tokens of a stream and of all streams extracted from it
+    struct shared_buffer
+    {
+        std::vector<token> tokens;
+        text_storage storage;
+        std::vector<std::string> increase_level_tokens;
+        std::vector<std::string> decrease_level_tokens;
+    };
+
     u32 get_current_line_number() const;
-    std::vector<std::string> m_increase_level_tokens;
-    std::vector<std::string> m_decrease_level_tokens;
-    std::vector<token> m_data;
+    bool is_increase_level_token(const token& t) const;
+    bool is_decrease_level_token(const token& t) const;
+
+    std::shared_ptr<shared_buffer> m_buffer;
+
+    // the range of the shared tokens that belongs to this stream, the position is relative to its begin
+    u32 m_begin;
+    u32 m_end;
     u32 m_pos;
 };
@@ -0,0 +1,286 @@
+//  MIT License
+//
+//  Copyright (c) 2019 Ruhr-University Bochum, Germany, Chair for Embedded Security. All Rights reserved.
+//  Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+
+#pragma once
+
+#include "def.h"
+
+#include "netlist/boolean_function.h"
+
+#include <functional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Manager of hash-consed reduced ordered binary decision diagrams (ROBDDs).<br>
+ * All diagrams of a manager share their nodes, so two diagrams represent the same function if and only if they are the same node.
+ * Variables are ordered by their first use.<br>
+ * Boolean functions with X are represented by two diagrams, one for the input assignments that evaluate to ONE and one for those that evaluate to X.
+ * Such a pair is canonical as well and can be used to compare or hash gate functions across a netlist.
+ *
+ * @ingroup netlist
+ */
+class NETLIST_API bdd_manager
+{
+public:
+    /** handle of a node */
+    using node = u32;
+
+    /** the terminal nodes */
+    static constexpr node ZERO = 0;
+    static constexpr node ONE  = 1;
+
+    /** a boolean function as the diagrams of its ONE and X outputs */
+    struct function
+    {
+        node ones;
+        node unknowns;
+
+        bool operator==(const function& other) const
+        {
+            return ones == other.ones && unknowns == other.unknowns;
+        }
+
+        bool operator!=(const function& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    /** hash and equality functors to use functions as keys of unordered containers */
+    struct function_hash
+    {
+        std::size_t operator()(const function& f) const
+        {
+            u64 h = ((u64)f.ones << 32) | f.unknowns;
+            h *= 0x9E3779B97F4A7C15ull;
+            return (std::size_t)(h ^ (h >> 32));
+        }
+    };
+
+    struct function_equal
+    {
+        bool operator()(const function& a, const function& b) const
+        {
+            return a == b;
+        }
+    };
+
+    /** default maximum number of entries of the operation cache */
+    static constexpr u32 DEFAULT_CACHE_LIMIT = 1 << 20;
+
+    bdd_manager();
+
+    /**
+     * Gets the node of a variable, new variables are appended to the variable order.
+     *
+     * @param[in] name - The name of the variable.
+     * @returns The node.
+     */
+    node get_variable(const std::string& name);
+
+    /**
+     * Gets the names of all variables in their order.
+     *
+     * @returns The variable names.
+     */
+    const std::vector<std::string>& get_variables() const;
+
+    /**
+     * Gets the number of nodes including the terminals.
+     *
+     * @returns The number of nodes.
+     */
+    u32 get_num_nodes() const;
+
+    /**
+     * Computes if-then-else, i.e., (f & g) | (!f & h).
+     *
+     * @param[in] f - The condition.
+     * @param[in] g - The function if f is ONE.
+     * @param[in] h - The function if f is ZERO.
+     * @returns The resulting node.
+     */
+    node ite(node f, node g, node h);
+
+    /**
+     * Combines diagrams.
+     *
+     * @param[in] a - The first node.
+     * @param[in] b - The second node.
+     * @returns The resulting node.
+     */
+    node apply_and(node a, node b);
+    node apply_or(node a, node b);
+    node apply_xor(node a, node b);
+
+    /**
+     * Negates a diagram.
+     *
+     * @param[in] a - The node.
+     * @returns The resulting node.
+     */
+    node negate(node a);
+
+    /**
+     * Fixes a variable to a value.
+     *
+     * @param[in] f - The node.
+     * @param[in] name - The name of the variable.
+     * @param[in] value - The value.
+     * @returns The resulting node.
+     */
+    node restrict(node f, const std::string& name, bool value);
+
+    /**
+     * Replaces a variable by another diagram.
+     *
+     * @param[in] f - The node.
+     * @param[in] name - The name of the variable.
+     * @param[in] g - The diagram to take the place of the variable.
+     * @returns The resulting node.
+     */
+    node compose(node f, const std::string& name, node g);
+
+    /**
+     * Builds the diagrams of a boolean function.
+     *
+     * @param[in] f - The boolean function.
+     * @returns The diagrams.
+     */
+    function from_boolean_function(const boolean_function& f);
+
+    /**
+     * Builds the diagrams of a boolean function whose variables are bound to other functions.<br>
+     * This is equivalent to substituting all bound variables at once, variables without a binding remain variables.
+     *
+     * @param[in] f - The boolean function.
+     * @param[in] inputs - The functions bound to variables of f.
+     * @returns The diagrams.
+     */
+    function from_boolean_function(const boolean_function& f, const std::unordered_map<std::string, function>& inputs);
+
+    /**
+     * Converts diagrams back to a boolean function by Shannon expansion.<br>
+     * Every node is expanded once, but the resulting expression does not share subexpressions,
+     * so its size can grow exponentially with the number of variables, e.g., for wide XOR functions.
+     * Prefer to work on the diagrams themselves for such functions.
+     *
+     * @param[in] f - The diagrams.
+     * @returns The boolean function.
+     */
+    boolean_function to_boolean_function(const function& f);
+
+    /**
+     * Combines functions with X handled like in boolean_function::evaluate.
+     *
+     * @param[in] a - The first function.
+     * @param[in] b - The second function.
+     * @returns The resulting function.
+     */
+    function apply_and(const function& a, const function& b);
+    function apply_or(const function& a, const function& b);
+    function apply_xor(const function& a, const function& b);
+
+    /**
+     * Negates a function, X outputs remain X.
+     *
+     * @param[in] a - The function.
+     * @returns The resulting function.
+     */
+    function negate(const function& a);
+
+    /**
+     * Replaces a variable by another function.
+     * Wherever g is X, the result is X unless f does not depend on the variable for that input assignment.
+     *
+     * @param[in] f - The function.
+     * @param[in] name - The name of the variable.
+     * @param[in] g - The function to take the place of the variable.
+     * @returns The resulting function.
+     */
+    function compose(const function& f, const std::string& name, const function& g);
+
+    /**
+     * Clears the cache of computed operations, the nodes remain valid.
+     */
+    void clear_cache();
+
+    /**
+     * Sets the maximum number of entries of the cache of computed operations.<br>
+     * The cache is cleared whenever it is full, so memory stays bounded during long runs.
+     *
+     * @param[in] max_entries - The maximum number of entries, at least 1.
+     */
+    void set_cache_limit(u32 max_entries);
+
+    /**
+     * Gets the number of entries of the cache of computed operations.
+     *
+     * @returns The number of entries.
+     */
+    u32 get_cache_size() const;
+
+private:
+    struct node_entry
+    {
+        u32 var;
+        node low;
+        node high;
+    };
+
+    struct triple_hash
+    {
+        std::size_t operator()(const std::tuple<u32, u32, u32>& t) const
+        {
+            u64 h = std::get<0>(t);
+            h     = h * 0x9E3779B97F4A7C15ull ^ std::get<1>(t);
+            h     = h * 0x9E3779B97F4A7C15ull ^ std::get<2>(t);
+            return (std::size_t)(h ^ (h >> 32));
+        }
+    };
+
+    node make_node(u32 var, node low, node high);
+    node cofactor(node f, u32 var, bool value) const;
+    node restrict_internal(node f, u32 var, bool value, std::unordered_map<node, node>& cache);
+    boolean_function to_boolean_function_internal(node ones, node unknowns, std::unordered_map<u64, boolean_function>& cache);
+
+    std::vector<node_entry> m_nodes;
+    std::unordered_map<std::tuple<u32, u32, u32>, node, triple_hash> m_unique_table;
+    std::unordered_map<std::tuple<u32, u32, u32>, node, triple_hash> m_ite_cache;
+    u32 m_cache_limit = DEFAULT_CACHE_LIMIT;
+
+    std::vector<std::string> m_variables;
+    std::unordered_map<std::string, u32> m_variable_indices;
+};
+
+namespace std
+{
+    template<>
+    struct hash<bdd_manager::function> : bdd_manager::function_hash
+    {
+    };
+}    // namespace std
@@ -31,6 +31,9 @@
 #include <set>
 #include <vector>
 
+class truth_table;
+class compiled_boolean_function;
+
 /**
  * Boolean function class.
  *
@@ -158,7 +161,7 @@ public:
      * Operator precedence is ! > & > ^ > |
      *
      * Since, for example, '(' is interpreted as a new term, but might also be an intended part of a variable,
-     * a vector of known variable names can be supplied, which are extracted before parsing.
+     * a vector of known variable names can be supplied, which take precedence over the tokenization.
      *
      * If there is an error during bracket matching, X is returned for that part.
      *
@@ -241,6 +244,7 @@ public:
 
     /**
      * Tests whether two boolean functions are equal.
+     * Functions over at most truth_table::MAX_VARIABLES variables are compared by their truth tables, larger ones by their BDDs.
      *
      * @param[in] other - Boolean function to compare to.
      * @returns True when both boolean functions are equal, false otherwise.
@@ -283,7 +287,11 @@ public:
     std::vector<std::vector<std::pair<std::string, bool>>> get_dnf_clauses() const;
 
     /**
-     * Optimizes the function by first converting it to DNF and then applying the Quine-McCluskey algorithm.
+     * Optimizes the function to a small sum of products.
+     * Functions over at most truth_table::MAX_VARIABLES variables without X outputs are minimized on their truth table:
+     * up to 8 variables to a minimum cover of their prime implicants, above by an Espresso-style heuristic. Results are cached per truth table
+     * in a process-wide cache that is shared by all netlists.
+     * All other functions are converted to DNF and minimized by the Quine-McCluskey algorithm.
      *
      * @returns The optimized boolean function.
      */
@@ -292,6 +300,7 @@ public:
     /**
      * Get the truth table outputs of the function.
      * WARNING: Exponential runtime in the number of variables!
+     * Up to truth_table::MAX_VARIABLES variables the outputs are computed bit-parallel, see to_truth_table.
      *
      * Output is the vector of output values when walking the truth table in ascending order.
      * The variable values are changed in order of appearance, i.e.:
@@ -308,7 +317,37 @@ public:
      */
     std::vector<value> get_truth_table(const std::vector<std::string>& ordered_variables = {}) const;
 
+    /**
+     * Get the packed truth table of the function.
+     * The variables are ordered like in get_truth_table, variables of the function that are not part of ordered_variables evaluate to X.
+     *
+     * @param[in] ordered_variables - Specific order of the variables, at most truth_table::MAX_VARIABLES.
+     * @returns The packed truth table.
+     */
+    truth_table to_truth_table(const std::vector<std::string>& ordered_variables) const;
+
+    /**
+     * Builds a function from a packed truth table by Shannon expansion.
+     * Variables the truth table does not depend on do not appear in the result.
+     *
+     * @param[in] table - The truth table.
+     * @param[in] variables - The variable names in the order of the truth table.
+     * @returns The boolean function.
+     */
+    static boolean_function from_truth_table(const truth_table& table, const std::vector<std::string>& variables);
+
+    /**
+     * Compiles the function to a flat program for repeated evaluation, see compiled_boolean_function.
+     *
+     * @param[in] var_order - The variables, their position is the index of their input value during evaluation.
+     * @returns The compiled function.
+     */
+    compiled_boolean_function compile(const std::vector<std::string>& var_order) const;
+
 private:
+    friend class compiled_boolean_function;
+    friend class bdd_manager;
+
     enum class operation
     {
         AND,
@@ -318,8 +357,6 @@ private:
     static std::string to_string(const operation& op);
     friend std::ostream& operator<<(std::ostream& os, const operation& op);
 
-    static boolean_function from_string_internal(std::string expression, const std::vector<std::string>& variable_names);
-
     /*
      * Constructor for a function of the form "term1 op term2 op term3 op ..."
      * Empty terms behaves like constant X.
@@ -329,6 +366,12 @@ private:
 
     boolean_function combine(operation op, const boolean_function& other) const;
 
+    // evaluates the function for all assignments of the indexed variables at once
+    truth_table to_truth_table_internal(const std::map<std::string, u32>& variable_indices, u32 num_variables) const;
+
+    // expands the truth table by the variables up to the given index
+    static boolean_function from_truth_table_internal(const truth_table& table, const std::vector<std::string>& variables, u32 num_remaining);
+
     std::string to_string_internal() const;
 
     // replaces a^b with (a & !b | (!a & b)
@@ -0,0 +1,110 @@
+//  MIT License
+//
+//  Copyright (c) 2019 Ruhr-University Bochum, Germany, Chair for Embedded Security. All Rights reserved.
+//  Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+
+#pragma once
+
+#include "def.h"
+
+#include "netlist/boolean_function.h"
+
+#include <utility>
+#include <vector>
+
+/**
+ * A boolean function compiled to a flat postfix program over indexed variables.<br>
+ * Evaluation neither walks the expression tree nor looks up variable names.
+ * Values are processed as bit planes (ONE and X) of 64-bit words, so the bitsliced evaluation computes 64 input vectors at once.
+ *
+ * @ingroup netlist
+ */
+class NETLIST_API compiled_boolean_function
+{
+public:
+    /**
+     * Constructor for an empty program that evaluates to X.
+     */
+    compiled_boolean_function();
+
+    /**
+     * Compiles a boolean function.
+     * Variables of the function that are not part of var_order always evaluate to X.
+     *
+     * @param[in] function - The boolean function.
+     * @param[in] var_order - The variables, their position is the index of their input value.
+     */
+    compiled_boolean_function(const boolean_function& function, const std::vector<std::string>& var_order);
+
+    /**
+     * Gets the number of input variables.
+     *
+     * @returns The number of variables.
+     */
+    u32 get_num_variables() const;
+
+    /**
+     * Evaluates the function on a single input vector.
+     *
+     * @param[in] inputs - The value of every variable in the order given at compilation.
+     * @returns The value that the function evaluates to.
+     */
+    boolean_function::value evaluate(const std::vector<boolean_function::value>& inputs) const;
+
+    /**
+     * Evaluates the function on 64 input vectors at once.<br>
+     * Bit i of every word belongs to input vector i. An input is X if its bit is set in unknowns, otherwise it is ONE if its bit is set in ones.
+     *
+     * @param[in] ones - The ONE bit plane of every variable in the order given at compilation.
+     * @param[in] unknowns - The X bit plane of every variable in the order given at compilation.
+     * @returns The ONE and X bit planes of the outputs.
+     */
+    std::pair<u64, u64> evaluate_bitsliced(const std::vector<u64>& ones, const std::vector<u64>& unknowns) const;
+
+private:
+    enum class opcode : u8
+    {
+        VARIABLE,
+        CONSTANT,
+        AND,
+        OR,
+        XOR,
+        NOT
+    };
+
+    struct instruction
+    {
+        opcode op;
+        u32 operand;
+    };
+
+    void compile(const boolean_function& function, const std::map<std::string, u32>& variable_indices, u32 depth);
+
+    void emit(opcode op, u32 operand, u32 depth);
+
+    template<typename Load>
+    std::pair<u64, u64> run(const Load& load) const;
+
+    u32 m_num_variables;
+    u32 m_max_depth;
+    std::vector<instruction> m_program;
+};
@@ -91,9 +91,11 @@ public:
 protected:
     /**
      * A function called when data has changed.
-     * Has to be implemented by the child class.
+     * Can be implemented by the child class, e.g., to invalidate values derived from the data.
      */
-    //virtual void notify_updated() = 0;
+    virtual void notify_updated()
+    {
+    }
 
     std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> m_data;
 };
@@ -25,31 +25,215 @@
 
 #include "def.h"
 
+#include <spdlog/common.h>
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+
 /* forward declaration */
 class gate;
 
+/**
+ * Handle to an interned pin name.<br>
+ * Every distinct pin name is stored only once, the handle is a single pointer.
+ * It reads like a const std::string and can be assigned a std::string, so code using the former std::string member endpoint::pin_type still compiles.
+ *
+ * @ingroup netlist
+ */
+class NETLIST_API interned_pin_type
+{
+public:
+    /**
+     * Constructs the empty pin name.
+     */
+    interned_pin_type() = default;
+
+    /**
+     * Constructs a handle to the given pin name, adding the name to the pool if it is not yet known.
+     *
+     * @param[in] type - The pin name.
+     */
+    interned_pin_type(const std::string& type) : m_type(intern(type))
+    {
+    }
+
+    /**
+     * Assigns a pin name.
+     *
+     * @param[in] type - The pin name.
+     * @returns The handle.
+     */
+    interned_pin_type& operator=(const std::string& type)
+    {
+        m_type = intern(type);
+        return *this;
+    }
+
+    /**
+     * Get the pin name.
+     *
+     * @returns The pin name.
+     */
+    const std::string& str() const;
+
+    /**
+     * Get the pin name.
+     *
+     * @returns The pin name.
+     */
+    operator const std::string&() const
+    {
+        return str();
+    }
+
+    /**
+     * Checks whether the pin name is empty.
+     *
+     * @returns True if the pin name is empty.
+     */
+    bool empty() const
+    {
+        return m_type == nullptr;
+    }
+
+    /**
+     * Get the length of the pin name.
+     *
+     * @returns The length of the pin name.
+     */
+    std::string::size_type size() const
+    {
+        return str().size();
+    }
+
+    /**
+     * Get the pin name as a C string.
+     *
+     * @returns The pin name.
+     */
+    const char* c_str() const
+    {
+        return str().c_str();
+    }
+
+    /**
+     * Compares two handles, which is a pointer compare since every pin name is stored only once.
+     */
+    friend bool operator==(const interned_pin_type& lhs, const interned_pin_type& rhs)
+    {
+        return lhs.m_type == rhs.m_type;
+    }
+    friend bool operator!=(const interned_pin_type& lhs, const interned_pin_type& rhs)
+    {
+        return lhs.m_type != rhs.m_type;
+    }
+
+    /**
+     * Orders handles by their pin names.
+     */
+    friend bool operator<(const interned_pin_type& lhs, const interned_pin_type& rhs)
+    {
+        return (lhs.m_type != rhs.m_type) && (lhs.str() < rhs.str());
+    }
+
+    /**
+     * Compares a handle with a pin name.
+     */
+    friend bool operator==(const interned_pin_type& lhs, const std::string& rhs)
+    {
+        return lhs.str() == rhs;
+    }
+    friend bool operator==(const std::string& lhs, const interned_pin_type& rhs)
+    {
+        return lhs == rhs.str();
+    }
+    friend bool operator!=(const interned_pin_type& lhs, const std::string& rhs)
+    {
+        return lhs.str() != rhs;
+    }
+    friend bool operator!=(const std::string& lhs, const interned_pin_type& rhs)
+    {
+        return lhs != rhs.str();
+    }
+    friend bool operator<(const interned_pin_type& lhs, const std::string& rhs)
+    {
+        return lhs.str() < rhs;
+    }
+    friend bool operator<(const std::string& lhs, const interned_pin_type& rhs)
+    {
+        return lhs < rhs.str();
+    }
+    friend std::string operator+(const std::string& lhs, const interned_pin_type& rhs)
+    {
+        return lhs + rhs.str();
+    }
+    friend std::string operator+(const interned_pin_type& lhs, const std::string& rhs)
+    {
+        return lhs.str() + rhs;
+    }
+
+private:
+    /**
+     * Returns the unique handle of a pin name, adding the name to the pool if it is not yet known.
+     * The empty name is represented by a nullptr.
+     *
+     * @param[in] type - The pin name.
+     * @returns The interned pin name.
+     */
+    static const std::string* intern(const std::string& type);
+
+    const std::string* m_type = nullptr;
+};
+
+/**
+ * Writes a pin name to a stream.
+ *
+ * @param[in] os - The stream.
+ * @param[in] type - The pin name.
+ * @returns The stream.
+ */
+NETLIST_API std::ostream& operator<<(std::ostream& os, const interned_pin_type& type);
+
+namespace fmt
+{
+    template<>
+    struct formatter<interned_pin_type> : formatter<string_view>
+    {
+        template<typename FormatContext>
+        auto format(const interned_pin_type& type, FormatContext& ctx)
+        {
+            return formatter<string_view>::format(type.str(), ctx);
+        }
+    };
+}    // namespace fmt
+
 /**
  *  Endpoint data structure for (gate, pin) tuples
  *
+ * Pin names are interned, i.e., every distinct pin name is stored only once and endpoints merely hold a handle to it.
+ *
  * @ingroup netlist
  */
-struct endpoint
+struct NETLIST_API endpoint
 {
     std::shared_ptr<::gate> gate;
 
-    std::string pin_type;
+    interned_pin_type pin_type;
 
     /**
-    * Copies the value of an endpoint over to another endpoint.
-    *
-    * @param[in] copy - The endpoint to copy.
-    * @returns The target endpoint.
-    */
-    endpoint& operator=(const endpoint& copy)
+     * Constructs an empty endpoint.
+     */
+    endpoint() = default;
+
+    /**
+     * Constructs an endpoint from a gate and a pin type.
+     *
+     * @param[in] g - The gate.
+     * @param[in] type - The pin type.
+     */
+    endpoint(const std::shared_ptr<::gate>& g, const std::string& type) : gate(g), pin_type(type)
     {
-        this->gate     = copy.gate;
-        this->pin_type = copy.pin_type;
-        return *this;
     }
 
     /**
@@ -113,7 +297,7 @@ struct endpoint
      */
     const std::string& get_pin_type() const
     {
-        return pin_type;
+        return pin_type.str();
     }
 
     /**
@@ -123,6 +307,6 @@ struct endpoint
      */
     void set_pin_type(const std::string& type)
     {
-        endpoint::pin_type = type;
+        pin_type = type;
     }
 };
@@ -56,6 +56,7 @@ namespace netlist_event_handler
         unmarked_global_input,     ///< associated_data = id of net
         unmarked_global_output,    ///< associated_data = id of net
         unmarked_global_inout,     ///< associated_data = id of net
+        bulk_changes_committed,    ///< no associated_data
 
     };
 
@@ -51,6 +51,8 @@ struct endpoint;
 class NETLIST_API gate : public data_container, public std::enable_shared_from_this<gate>
 {
     friend class netlist_internal_manager;
+    friend class netlist_builder;
+    friend class netlist_graph_snapshot;
 
 public:
     /**
@@ -314,6 +316,10 @@ private:
     gate& operator=(const gate&) = delete;    //disable copy-assignment
 
     boolean_function get_lut_function() const;
+    boolean_function compute_lut_function(const std::string& config_str) const;
+
+    /* drops the cached LUT function whenever the configuration might have changed */
+    void notify_updated() override;
 
     /* pointer to corresponding netlist parent */
     std::shared_ptr<netlist> m_netlist;
@@ -334,10 +340,16 @@ private:
     /* owning module */
     std::shared_ptr<module> m_module;
 
-    /* connected nets */
-    std::map<std::string, std::shared_ptr<net>> m_in_nets;
-    std::map<std::string, std::shared_ptr<net>> m_out_nets;
+    /* connected nets, indexed by the pin index within the gate type (nullptr if unconnected) */
+    std::vector<std::shared_ptr<net>> m_in_nets;
+    std::vector<std::shared_ptr<net>> m_out_nets;
 
     /* dedicated functions */
     std::map<std::string, boolean_function> m_functions;
+
+    /* LUT function of the current configuration, shared through the netlist's cache */
+    mutable std::shared_ptr<const boolean_function> m_lut_function;
+
+    /* incremented whenever the configuration changes, a function computed from an outdated configuration is not stored */
+    u64 m_lut_config_version = 0;
 };
@@ -44,6 +44,8 @@ public:
         latch
     };
 
+    static constexpr u32 invalid_pin_index = 0xFFFFFFFF;
+
     /**
      * Constructor for a gate type.
      *
@@ -120,6 +122,30 @@ public:
      */
     std::vector<std::string> get_input_pins() const;
 
+    /**
+     * Get the index of an input pin of the gate type.
+     * Input pins are numbered in the order they were added to the gate type.
+     *
+     * @param[in] input_pin - The name of the input pin.
+     * @returns The index of the input pin or gate_type::invalid_pin_index if the pin does not exist.
+     */
+    u32 get_input_pin_index(const std::string& input_pin) const;
+
+    /**
+     * Get the name of the input pin with the given index.
+     *
+     * @param[in] index - The index of the input pin.
+     * @returns The name of the input pin or an empty string if the index is out of range.
+     */
+    const std::string& get_input_pin(u32 index) const;
+
+    /**
+     * Get the indices of the input pins ordered by the names of the pins.
+     *
+     * @returns The input pin indices in lexicographical order of the pin names.
+     */
+    const std::vector<u32>& get_input_pin_order() const;
+
     /**
      * Add an output pin to the gate type.
      *
@@ -141,6 +167,30 @@ public:
      */
     std::vector<std::string> get_output_pins() const;
 
+    /**
+     * Get the index of an output pin of the gate type.
+     * Output pins are numbered in the order they were added to the gate type.
+     *
+     * @param[in] output_pin - The name of the output pin.
+     * @returns The index of the output pin or gate_type::invalid_pin_index if the pin does not exist.
+     */
+    u32 get_output_pin_index(const std::string& output_pin) const;
+
+    /**
+     * Get the name of the output pin with the given index.
+     *
+     * @param[in] index - The index of the output pin.
+     * @returns The name of the output pin or an empty string if the index is out of range.
+     */
+    const std::string& get_output_pin(u32 index) const;
+
+    /**
+     * Get the indices of the output pins ordered by the names of the pins.
+     *
+     * @returns The output pin indices in lexicographical order of the pin names.
+     */
+    const std::vector<u32>& get_output_pin_order() const;
+
     /**
      * Add a boolean function with the specified name to the gate type.
      *
@@ -164,6 +214,10 @@ private:
 
     std::vector<std::string> m_input_pins;
     std::vector<std::string> m_output_pins;
+    std::unordered_map<std::string, u32> m_input_pin_indices;
+    std::unordered_map<std::string, u32> m_output_pin_indices;
+    std::vector<u32> m_input_pin_order;
+    std::vector<u32> m_output_pin_order;
 
     std::unordered_map<std::string, boolean_function> m_functions;
 
@@ -171,4 +225,6 @@ private:
     gate_type& operator=(const gate_type&) = delete;    // disable copy-assignment
 
     virtual bool do_compare(const gate_type& other) const;
+
+    static void insert_by_name(const std::vector<std::string>& pins, std::vector<u32>& order, u32 index);
 };
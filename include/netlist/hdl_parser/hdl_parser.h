@@ -25,11 +25,14 @@
 
 #include "def.h"
 
+#include "netlist/netlist_builder.h"
+
 #include <cctype>
 #include <fstream>
 #include <set>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 /* forward declaration*/
@@ -46,6 +49,14 @@ public:
      */
     explicit hdl_parser(std::stringstream& stream);
 
+    /**
+     * Creates a parser that works directly on a buffer, e.g., a memory mapped file.
+     * The buffer is not copied and must outlive the parser.
+     *
+     * @param[in] buffer - The buffer filled with the hdl code.
+     */
+    explicit hdl_parser(std::string_view buffer);
+
     virtual ~hdl_parser() = default;
 
     /**
@@ -57,9 +68,21 @@ public:
     virtual std::shared_ptr<netlist> parse(const std::string& gate_library) = 0;
 
 protected:
+    // converts the digits of a number in base 2, 8, 10, or 16 to its bits (most significant first) without limiting the width
+    static std::string get_bits_from_digits(const std::string& digits, u32 base);
+
+    // converts bits (most significant first) to lower case hex digits without leading zeros
+    static std::string get_hex_from_bits(const std::string& bits);
+
     // stores the netlist
     std::shared_ptr<netlist> m_netlist;
 
-    // stores the input stream to the file
-    std::stringstream& m_fs;
+    // populates the netlist without firing events for every single gate and net
+    std::unique_ptr<netlist_builder> m_builder;
+
+    // stores the hdl code, tokens refer to it instead of copying it
+    std::string_view m_buffer;
+
+    // owns the hdl code if the parser was created from a string stream
+    std::string m_buffer_storage;
 };
@@ -47,6 +47,11 @@ public:
      */
     explicit hdl_parser_verilog(std::stringstream& stream);
 
+    /**
+     * @param[in] buffer - The buffer filled with the hdl code, it must outlive the parser.
+     */
+    explicit hdl_parser_verilog(std::string_view buffer);
+
     ~hdl_parser_verilog() = default;
 
     /**
@@ -80,7 +85,7 @@ private:
         std::unordered_map<std::string, std::vector<std::string>> expanded_signal_names;
     };
 
-    token_stream m_token_stream;
+    std::vector<token_stream> m_entity_streams;
     std::string m_last_entity;
     std::unordered_map<std::string, std::vector<std::string>> m_gate_to_pin_map;
 
@@ -93,15 +98,16 @@ private:
     std::unordered_map<std::string, std::vector<std::string>> m_nets_to_merge;
 
     bool tokenize();
+    std::vector<token> tokenize_lines(const std::vector<std::string_view>& lines, u32 begin, u32 end, bool multi_line_comment, bool multi_line_property, token_stream::text_storage& storage);
     bool parse_tokens();
 
     // parse the hdl into an intermediate format
-    bool parse_entity_definiton();
-    bool parse_port_list(entity& e);
-    bool parse_port_definition(entity& e);
-    bool parse_signal_definition(entity& e);
-    bool parse_assign(entity& e);
-    bool parse_instance(entity& e);
+    bool parse_entity_definiton(token_stream& ts, entity& e);
+    bool parse_port_list(token_stream& ts, entity& e);
+    bool parse_port_definition(token_stream& ts, entity& e);
+    bool parse_signal_definition(token_stream& ts, entity& e);
+    bool parse_assign(token_stream& ts, entity& e);
+    bool parse_instance(token_stream& ts, entity& e);
     bool connect_instances();
 
     // build the netlist from the intermediate format
@@ -109,7 +115,7 @@ private:
     std::shared_ptr<module> instantiate(const entity& e, std::shared_ptr<module> parent, std::unordered_map<std::string, std::string> port_assignments);
 
     // helper functions
-    void remove_comments(std::string& line, bool& multi_line_comment, bool& multi_line_property);
+    void remove_comments(std::string_view line, bool& multi_line_comment, bool& multi_line_property, std::vector<std::string_view>& parts);
     void expand_signal(std::vector<std::string>& expanded_signal, std::string current_signal, std::vector<std::pair<i32, i32>> bounds, u32 dimension);
     std::unordered_map<std::string, std::vector<std::string>> get_expanded_signals(token_stream& signal_str);
     std::vector<std::string> get_assignment_signals(token_stream& signal_str, entity& e, bool allow_numerics);
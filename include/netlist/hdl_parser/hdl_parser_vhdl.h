@@ -47,6 +47,11 @@ public:
      */
     explicit hdl_parser_vhdl(std::stringstream& stream);
 
+    /**
+     * @param[in] buffer - The buffer filled with the hdl code, it must outlive the parser.
+     */
+    explicit hdl_parser_vhdl(std::string_view buffer);
+
     ~hdl_parser_vhdl() = default;
 
     /**
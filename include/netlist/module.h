@@ -51,6 +51,7 @@ class gate;
 class NETLIST_API module : public data_container, public std::enable_shared_from_this<module>
 {
     friend class netlist_internal_manager;
+    friend class netlist_builder;
     friend class netlist;
 
 public:
@@ -214,7 +215,6 @@ private:
     std::map<u32, std::shared_ptr<module>> m_submodules_map;
     std::set<std::shared_ptr<module>> m_submodules_set;
 
-    /** stores gates sorted by id*/
-    std::map<u32, std::shared_ptr<gate>> m_gates_map;
+    /** stores the gates directly contained in this module, lookups by id are answered by the netlist */
     std::set<std::shared_ptr<gate>> m_gates_set;
 };
@@ -49,6 +49,9 @@ class netlist_internal_manager;
 class NETLIST_API net : public data_container, public std::enable_shared_from_this<net>
 {
     friend class netlist_internal_manager;
+    friend class netlist_builder;
+    friend class netlist_graph_snapshot;
+    friend class gate;
 
 public:
     /**
@@ -26,8 +26,11 @@
 #include "def.h"
 
 #include "netlist/gate_library/gate_library.h"
+#include "netlist/slot_map.h"
 
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -37,6 +40,7 @@
 
 /** forward declaration */
 class netlist_internal_manager;
+class netlist_graph_snapshot;
 class net;
 class gate;
 class module;
@@ -50,6 +54,9 @@ struct endpoint;
 class NETLIST_API netlist : public std::enable_shared_from_this<netlist>
 {
     friend class netlist_internal_manager;
+    friend class netlist_builder;
+    friend class netlist_graph_snapshot;
+    friend class gate;
 
 public:
     /**
@@ -281,6 +288,23 @@ public:
      */
     std::set<std::shared_ptr<gate>> get_gates(const std::function<bool(const std::shared_ptr<gate>&)>& filter = nullptr) const;
 
+    /**
+     * Get the number of gates in the netlist regardless of the module they are in.<br>
+     * Faster than get_gates().size().
+     *
+     * @returns The number of gates.
+     */
+    u32 get_num_of_gates() const;
+
+    /**
+     * Calls a function for every gate of the netlist regardless of the module they are in.<br>
+     * In contrast to get_gates(), no set is built, so this is the preferred way to iterate large netlists.<br>
+     * The netlist must not be modified from within the callback.
+     *
+     * @param[in] callback - The function to call for each gate.
+     */
+    void for_each_gate(const std::function<void(const std::shared_ptr<gate>&)>& callback) const;
+
     /**
      * Mark a gate as a global vcc gate.
      *
@@ -471,6 +495,22 @@ public:
      */
     std::set<std::shared_ptr<net>> get_global_output_nets() const;
 
+    /*
+     * ################################################################
+     *      graph functions
+     * ################################################################
+     */
+
+    /**
+     * Get a read-only CSR snapshot of the gate-level graph of the netlist.<br>
+     * The snapshot is built on first use and shared by all callers until the netlist is structurally modified, i.e., until
+     * a gate or net is created or deleted or a net's source or destinations change.<br>
+     * The function may be called concurrently, the snapshot is then built only once. Structural modifications of the netlist must not run concurrently.
+     *
+     * @returns The graph snapshot.
+     */
+    std::shared_ptr<const netlist_graph_snapshot> get_graph_snapshot();
+
 private:
     /** stores the pointer to the netlist internal manager */
     netlist_internal_manager* m_manager;
@@ -490,24 +530,15 @@ private:
     /* stores the name of the device */
     std::string m_device_name;
 
-    /** stores the auto generated ids for fast next id */
-    u32 m_next_gate_id;
-    std::set<u32> m_used_gate_ids;
-    std::set<u32> m_free_gate_ids;
-    u32 m_next_net_id;
-    std::set<u32> m_used_net_ids;
-    std::set<u32> m_free_net_ids;
-    u32 m_next_module_id;
-    std::set<u32> m_used_module_ids;
-    std::set<u32> m_free_module_ids;
-
     /** stores the modules */
     std::shared_ptr<module> m_top_module;
-    std::unordered_map<u32, std::shared_ptr<module>> m_modules;
+    slot_map<module> m_modules;
+
+    /** stores all gates independent of their module */
+    slot_map<gate> m_gates;
 
     /** stores the nets */
-    std::unordered_map<u32, std::shared_ptr<net>> m_nets_map;
-    std::unordered_set<std::shared_ptr<net>> m_nets_set;
+    slot_map<net> m_nets;
 
     /** stores the set of global gates and nets */
     std::set<std::shared_ptr<net>> m_global_input_nets;
@@ -517,4 +548,16 @@ private:
     std::set<std::shared_ptr<gate>> m_gnd_gates;
 
     std::set<std::shared_ptr<gate>> m_vcc_gates;
+
+    /** cached graph snapshot, reset on every structural change */
+    std::shared_ptr<const netlist_graph_snapshot> m_graph_snapshot;
+
+    /** guards building and publishing the cached graph snapshot */
+    std::mutex m_graph_snapshot_mutex;
+
+    /** LUT functions shared by all gates of the same type and configuration, the type also fixes the pin order */
+    std::unordered_map<const gate_type*, std::unordered_map<std::string, std::shared_ptr<const boolean_function>>> m_lut_function_cache;
+
+    /** guards the LUT function cache and the cached LUT functions of all gates, which are filled by const accessors */
+    std::shared_mutex m_lut_function_mutex;
 };
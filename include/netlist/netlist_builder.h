@@ -0,0 +1,162 @@
+//  MIT License
+//
+//  Copyright (c) 2019 Ruhr-University Bochum, Germany, Chair for Embedded Security. All Rights reserved.
+//  Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#pragma once
+
+#include "def.h"
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+/* forward declaration */
+class netlist;
+class gate;
+class gate_type;
+class net;
+class module;
+
+/**
+ * Builder for populating a netlist with large numbers of gates and nets, e.g., by parsers or deserializers.<br>
+ * In contrast to the respective netlist functions, no events are fired for the individual changes. Instead, a single
+ * netlist_event_handler::event::bulk_changes_committed event is fired on commit(). Validation is reduced to checks that
+ * run in constant time, i.e., gate types are only checked against the gate library once and pin occupation is
+ * checked via the pin index instead of scanning all connected nets.<br>
+ * All changes are applied to the netlist immediately, hence the netlist can be queried and modified regularly while a builder is active.
+ *
+ * @ingroup netlist
+ */
+class NETLIST_API netlist_builder
+{
+public:
+    /**
+     * Creates a builder for the given netlist.
+     *
+     * @param[in] nl - The netlist to populate.
+     */
+    explicit netlist_builder(const std::shared_ptr<netlist>& nl);
+
+    /**
+     * Commits all pending changes.
+     */
+    ~netlist_builder();
+
+    /**
+     * Reserves memory for the given number of gates and nets in addition to those already in the netlist.
+     *
+     * @param[in] num_gates - The number of gates to be added.
+     * @param[in] num_nets - The number of nets to be added.
+     */
+    void reserve(u32 num_gates, u32 num_nets);
+
+    /**
+     * Creates a new gate and adds it to the top module of the netlist.
+     *
+     * @param[in] id - The unique ID != 0 for the new gate.
+     * @param[in] gt - The gate type.
+     * @param[in] name - A name for the gate.
+     * @param[in] x - The x-coordinate of the gate.
+     * @param[in] y - The y-coordinate of the gate.
+     * @returns The new gate on success, nullptr on error.
+     */
+    std::shared_ptr<gate> create_gate(u32 id, const std::shared_ptr<const gate_type>& gt, const std::string& name, float x = -1, float y = -1);
+
+    /**
+     * Creates a new gate with a unique id and adds it to the top module of the netlist.
+     *
+     * @param[in] gt - The gate type.
+     * @param[in] name - A name for the gate.
+     * @param[in] x - The x-coordinate of the gate.
+     * @param[in] y - The y-coordinate of the gate.
+     * @returns The new gate on success, nullptr on error.
+     */
+    std::shared_ptr<gate> create_gate(const std::shared_ptr<const gate_type>& gt, const std::string& name, float x = -1, float y = -1);
+
+    /**
+     * Creates a new net.
+     *
+     * @param[in] id - The unique ID != 0 for the new net.
+     * @param[in] name - A name for the net.
+     * @returns The new net on success, nullptr on error.
+     */
+    std::shared_ptr<net> create_net(u32 id, const std::string& name);
+
+    /**
+     * Creates a new net with a unique id.
+     *
+     * @param[in] name - A name for the net.
+     * @returns The new net on success, nullptr on error.
+     */
+    std::shared_ptr<net> create_net(const std::string& name);
+
+    /**
+     * Sets the source of a net, replacing a previously assigned source.<br>
+     * Fails if the output pin is already connected.
+     *
+     * @param[in] n - The net.
+     * @param[in] g - The source gate.
+     * @param[in] pin_type - The output pin of the source gate.
+     * @returns True on success.
+     */
+    bool set_src(const std::shared_ptr<net>& n, const std::shared_ptr<gate>& g, const std::string& pin_type);
+
+    /**
+     * Adds a destination to a net.<br>
+     * Fails if the input pin is already connected.
+     *
+     * @param[in] n - The net.
+     * @param[in] g - The destination gate.
+     * @param[in] pin_type - The input pin of the destination gate.
+     * @returns True on success.
+     */
+    bool add_dst(const std::shared_ptr<net>& n, const std::shared_ptr<gate>& g, const std::string& pin_type);
+
+    /**
+     * Moves a gate into a module.
+     *
+     * @param[in] m - The module.
+     * @param[in] g - The gate.
+     * @returns True on success.
+     */
+    bool assign_gate(const std::shared_ptr<module>& m, const std::shared_ptr<gate>& g);
+
+    /**
+     * Fires a single event for all changes since the last commit. <br>
+     * Does nothing if there were no changes.
+     */
+    void commit();
+
+private:
+    netlist_builder(const netlist_builder&) = delete;               //disable copy-constructor
+    netlist_builder& operator=(const netlist_builder&) = delete;    //disable copy-assignment
+
+    bool is_gate_type_valid(const std::shared_ptr<const gate_type>& gt);
+
+    std::shared_ptr<netlist> m_netlist;
+
+    /* gate types already checked against the gate library */
+    std::unordered_set<const gate_type*> m_valid_gate_types;
+
+    /* whether there are uncommitted changes */
+    bool m_pending;
+};
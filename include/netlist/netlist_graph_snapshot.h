@@ -0,0 +1,224 @@
+//  MIT License
+//
+//  Copyright (c) 2019 Ruhr-University Bochum, Germany, Chair for Embedded Security. All Rights reserved.
+//  Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#pragma once
+
+#include "def.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/* forward declaration */
+class netlist;
+class gate;
+class net;
+
+/**
+ * Immutable snapshot of the gate-level graph of a netlist stored in compressed sparse row (CSR) format.<br>
+ * Gates and nets are numbered densely starting at 0. The snapshot stores, for every gate, its fan-in and fan-out nets
+ * together with the pin indices (see gate_type::get_input_pin_index) as well as its direct predecessor and successor gates.<br>
+ * The snapshot is not updated when the netlist changes, use netlist::get_graph_snapshot() to always get an up-to-date one.
+ *
+ * @ingroup netlist
+ */
+class NETLIST_API netlist_graph_snapshot
+{
+public:
+    static constexpr u32 invalid_index = 0xFFFFFFFF;
+
+    /**
+     * A gate-to-gate connection. <br>
+     * Depending on the direction of the query, 'gate' is either the predecessor or the successor gate.
+     */
+    struct edge
+    {
+        u32 gate;       ///< index of the adjacent gate
+        u32 net;        ///< index of the net the connection runs through
+        u32 src_pin;    ///< index of the output pin at the source gate
+        u32 dst_pin;    ///< index of the input pin at the destination gate
+    };
+
+    /**
+     * A gate-to-net connection.
+     */
+    struct pin_net
+    {
+        u32 pin;    ///< index of the pin at the gate
+        u32 net;    ///< index of the connected net
+    };
+
+    /**
+     * A lightweight view on a contiguous part of the snapshot.
+     */
+    template<typename T>
+    class range
+    {
+    public:
+        range(const T* begin, const T* end) : m_begin(begin), m_end(end)
+        {
+        }
+
+        const T* begin() const
+        {
+            return m_begin;
+        }
+
+        const T* end() const
+        {
+            return m_end;
+        }
+
+        u32 size() const
+        {
+            return static_cast<u32>(m_end - m_begin);
+        }
+
+        bool empty() const
+        {
+            return m_begin == m_end;
+        }
+
+        const T& operator[](u32 i) const
+        {
+            return m_begin[i];
+        }
+
+    private:
+        const T* m_begin;
+        const T* m_end;
+    };
+
+    /**
+     * Builds the snapshot of the given netlist in a single pass over its gates.
+     *
+     * @param[in] nl - The netlist.
+     */
+    explicit netlist_graph_snapshot(const std::shared_ptr<netlist>& nl);
+
+    ~netlist_graph_snapshot() = default;
+
+    /**
+     * Get the number of gates in the snapshot.
+     *
+     * @returns The number of gates.
+     */
+    u32 get_num_of_gates() const;
+
+    /**
+     * Get the number of nets in the snapshot.
+     *
+     * @returns The number of nets.
+     */
+    u32 get_num_of_nets() const;
+
+    /**
+     * Get the number of gate-to-gate connections in the snapshot.
+     *
+     * @returns The number of edges.
+     */
+    u32 get_num_of_edges() const;
+
+    /**
+     * Get the gate with the given index.
+     *
+     * @param[in] index - The index of the gate.
+     * @returns The gate.
+     */
+    const std::shared_ptr<gate>& get_gate(u32 index) const;
+
+    /**
+     * Get the net with the given index.
+     *
+     * @param[in] index - The index of the net.
+     * @returns The net.
+     */
+    const std::shared_ptr<net>& get_net(u32 index) const;
+
+    /**
+     * Get the index of a gate within the snapshot.
+     *
+     * @param[in] g - The gate.
+     * @returns The index of the gate or netlist_graph_snapshot::invalid_index if the gate is not part of the snapshot.
+     */
+    u32 get_gate_index(const std::shared_ptr<gate>& g) const;
+
+    /**
+     * Get the index of a net within the snapshot.
+     *
+     * @param[in] n - The net.
+     * @returns The index of the net or netlist_graph_snapshot::invalid_index if the net is not part of the snapshot.
+     */
+    u32 get_net_index(const std::shared_ptr<net>& n) const;
+
+    /**
+     * Get the direct successors of a gate.
+     *
+     * @param[in] index - The index of the gate.
+     * @returns The outgoing edges of the gate, 'edge::gate' referring to the successor.
+     */
+    range<edge> get_successors(u32 index) const;
+
+    /**
+     * Get the direct predecessors of a gate.
+     *
+     * @param[in] index - The index of the gate.
+     * @returns The incoming edges of the gate, 'edge::gate' referring to the predecessor.
+     */
+    range<edge> get_predecessors(u32 index) const;
+
+    /**
+     * Get the nets connected to the input pins of a gate.
+     *
+     * @param[in] index - The index of the gate.
+     * @returns The fan-in nets along with the input pin indices.
+     */
+    range<pin_net> get_fan_in_nets(u32 index) const;
+
+    /**
+     * Get the nets connected to the output pins of a gate.
+     *
+     * @param[in] index - The index of the gate.
+     * @returns The fan-out nets along with the output pin indices.
+     */
+    range<pin_net> get_fan_out_nets(u32 index) const;
+
+private:
+    netlist_graph_snapshot(const netlist_graph_snapshot&) = delete;               //disable copy-constructor
+    netlist_graph_snapshot& operator=(const netlist_graph_snapshot&) = delete;    //disable copy-assignment
+
+    std::vector<std::shared_ptr<gate>> m_gates;
+    std::vector<std::shared_ptr<net>> m_nets;
+    std::unordered_map<u32, u32> m_gate_index_by_id;
+    std::unordered_map<u32, u32> m_net_index_by_id;
+
+    /* CSR arrays, the entries of gate i are located in [offsets[i], offsets[i + 1]) */
+    std::vector<u32> m_successor_offsets;
+    std::vector<edge> m_successors;
+    std::vector<u32> m_predecessor_offsets;
+    std::vector<edge> m_predecessors;
+    std::vector<u32> m_fan_in_offsets;
+    std::vector<pin_net> m_fan_in_nets;
+    std::vector<u32> m_fan_out_offsets;
+    std::vector<pin_net> m_fan_out_nets;
+};
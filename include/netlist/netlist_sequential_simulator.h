@@ -0,0 +1,170 @@
+//  MIT License
+//
+//  Copyright (c) 2019 Ruhr-University Bochum, Germany, Chair for Embedded Security. All Rights reserved.
+//  Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+
+#pragma once
+
+#include "def.h"
+
+#include "netlist/gate_library/gate_type/gate_type_sequential.h"
+#include "netlist/netlist_simulator.h"
+
+#include <queue>
+#include <string>
+
+/** forward declaration */
+class gate;
+
+/**
+ * Event-driven simulator for netlists with flip-flops and latches.<br>
+ * Like the combinational simulator, every net carries 64 patterns at once.
+ *
+ * Flip-flops take their next state on a rising edge of their clock function, latches are transparent while their enable function is ONE.
+ * Set and reset act asynchronously, the behavior if both are active follows the gate type.
+ * The initial state is read from the init data of the gate if available, otherwise it is X.
+ *
+ * Only gates whose inputs changed are evaluated again, in the order of their logic level.
+ * All value changes are recorded and can be written to a VCD file.
+ *
+ * @ingroup netlist
+ */
+class NETLIST_API netlist_sequential_simulator : public netlist_simulator
+{
+public:
+    /**
+     * Prepares the simulation of a netlist.<br>
+     * The outputs of flip-flops and latches are driven by the simulation and are no inputs.
+     *
+     * @param[in] nl - The netlist.
+     */
+    explicit netlist_sequential_simulator(const std::shared_ptr<netlist>& nl);
+
+    using netlist_simulator::set_input;
+
+    /**
+     * Sets the 64 input patterns of an input net.<br>
+     * The change takes effect in the next step.
+     *
+     * @param[in] n - The input net.
+     * @param[in] ones - The ONE bit plane.
+     * @param[in] unknowns - The X bit plane.
+     * @returns True on success.
+     */
+    bool set_input(const std::shared_ptr<net>& n, u64 ones, u64 unknowns = 0) override;
+
+    /**
+     * Propagates all input changes through the netlist until it is stable and advances the time by one.
+     */
+    void step();
+
+    /**
+     * Toggles a clock input from ZERO to ONE for a number of cycles, each half cycle is one step.
+     *
+     * @param[in] clock - The clock input net.
+     * @param[in] num_cycles - The number of cycles.
+     * @returns True on success.
+     */
+    bool run_clock_cycles(const std::shared_ptr<net>& clock, u32 num_cycles);
+
+    /**
+     * Applies the input changes of a stimulus file.<br>
+     * Every line consists of a time, the name of an input net and its value (0, 1 or X) for all patterns, lines starting with '#' are ignored.
+     * At every time that appears in the file, all of its changes are applied and a step is simulated.
+     * The times must not be lower than the current time.
+     *
+     * @param[in] path - The path of the stimulus file.
+     * @returns True on success.
+     */
+    bool run_stimulus(const hal::path& path);
+
+    /**
+     * Writes all value changes of a single pattern to a VCD file.
+     *
+     * @param[in] path - The path of the VCD file.
+     * @param[in] pattern - The index of the pattern, must be less than 64.
+     * @returns True on success.
+     */
+    bool write_vcd(const hal::path& path, u32 pattern = 0) const;
+
+    /**
+     * Get the current time, i.e., the number of steps simulated so far unless a stimulus skipped ahead.
+     *
+     * @returns The time.
+     */
+    u64 get_time() const;
+
+    /**
+     * Get the number of gate outputs and sequential gates evaluated so far.
+     *
+     * @returns The number of evaluations.
+     */
+    u64 get_num_evaluations() const;
+
+private:
+    static constexpr u32 MAX_ITERATIONS = 1000;
+
+    struct sequential_element
+    {
+        bool is_ff;
+        kernel clock, data, set, reset;
+        bool has_clock, has_data, has_set, has_reset;
+        gate_type_sequential::set_reset_behavior state_behavior, inverted_state_behavior;
+
+        std::vector<u32> state_outputs, inverted_state_outputs;
+
+        u64 state_ones, state_unknowns;
+        u64 inverted_state_ones, inverted_state_unknowns;
+        u64 clock_ones, clock_unknowns;
+        bool clock_initialized;
+    };
+
+    struct value_change
+    {
+        u64 time;
+        u32 net;
+        u64 ones;
+        u64 unknowns;
+    };
+
+    std::pair<u64, u64> evaluate(const kernel& k);
+    void update_net(u32 index, u64 ones, u64 unknowns);
+    void update_elements();
+
+    std::string m_design_name;
+    std::vector<std::shared_ptr<net>> m_nets;
+
+    std::vector<sequential_element> m_elements;
+    std::vector<std::vector<u32>> m_kernel_readers;
+    std::vector<std::vector<u32>> m_element_readers;
+
+    // kernels are sorted by level, so processing the lowest index first evaluates each kernel at most once
+    std::priority_queue<u32, std::vector<u32>, std::greater<u32>> m_kernel_queue;
+    std::vector<bool> m_kernel_scheduled;
+    std::vector<u32> m_element_queue;
+    std::vector<bool> m_element_scheduled;
+
+    std::vector<value_change> m_changes;
+    u64 m_time;
+    u64 m_num_evaluations;
+    bool m_initialized;
+};
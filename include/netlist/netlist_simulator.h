@@ -0,0 +1,143 @@
+//  MIT License
+//
+//  Copyright (c) 2019 Ruhr-University Bochum, Germany, Chair for Embedded Security. All Rights reserved.
+//  Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+
+#pragma once
+
+#include "def.h"
+
+#include "netlist/boolean_function.h"
+#include "netlist/compiled_boolean_function.h"
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/** forward declaration */
+class netlist;
+class net;
+
+/**
+ * Simulator for the combinational logic of a netlist.<br>
+ * Every net carries 64 input patterns at once, bit i of its bit planes belongs to pattern i.
+ * A net is X for a pattern if its bit is set in the X plane, otherwise it is ONE if its bit is set in the ONE plane.
+ *
+ * The inputs of the simulation are all nets without a source, all nets driven by flip-flops or latches
+ * and all nets driven by pins without a boolean function. All other nets are computed by the simulation.
+ *
+ * @ingroup netlist
+ */
+class NETLIST_API netlist_simulator
+{
+public:
+    /**
+     * Prepares the simulation of a netlist.<br>
+     * The combinational gates are sorted by their logic level and their functions are compiled.
+     * Gates in combinational loops are not simulated, the nets they drive remain X.
+     * The netlist must not be modified while the simulator is in use.
+     *
+     * @param[in] nl - The netlist.
+     */
+    explicit netlist_simulator(const std::shared_ptr<netlist>& nl);
+
+    virtual ~netlist_simulator() = default;
+
+    /**
+     * Get the inputs of the simulation.
+     *
+     * @returns The input nets.
+     */
+    const std::vector<std::shared_ptr<net>>& get_input_nets() const;
+
+    /**
+     * Get the number of gate outputs that are evaluated in every simulation pass.
+     *
+     * @returns The number of evaluated gate outputs.
+     */
+    u32 get_num_evaluated_outputs() const;
+
+    /**
+     * Sets the 64 input patterns of an input net.<br>
+     * All inputs are X until they are set.
+     *
+     * @param[in] n - The input net.
+     * @param[in] ones - The ONE bit plane.
+     * @param[in] unknowns - The X bit plane.
+     * @returns True on success.
+     */
+    virtual bool set_input(const std::shared_ptr<net>& n, u64 ones, u64 unknowns = 0);
+
+    /**
+     * Sets all 64 input patterns of an input net to the same value.
+     *
+     * @param[in] n - The input net.
+     * @param[in] value - The value.
+     * @returns True on success.
+     */
+    bool set_input(const std::shared_ptr<net>& n, boolean_function::value value);
+
+    /**
+     * Evaluates all combinational gates for the current input patterns.
+     */
+    void simulate();
+
+    /**
+     * Get the bit planes of a net after the last simulation pass.
+     *
+     * @param[in] n - The net.
+     * @returns The ONE and X bit planes.
+     */
+    std::pair<u64, u64> get_value(const std::shared_ptr<net>& n) const;
+
+    /**
+     * Get the value of a net for a single pattern after the last simulation pass.
+     *
+     * @param[in] n - The net.
+     * @param[in] pattern - The index of the pattern, must be less than 64.
+     * @returns The value.
+     */
+    boolean_function::value get_value(const std::shared_ptr<net>& n, u32 pattern) const;
+
+protected:
+    // evaluates one output pin of a gate
+    struct kernel
+    {
+        compiled_boolean_function function;
+        std::vector<u32> inputs;
+        u32 output;
+    };
+
+    std::vector<kernel> m_kernels;
+    std::vector<std::shared_ptr<net>> m_input_nets;
+
+    // bit planes of all nets, index 0 is a constant X for unconnected pins
+    std::unordered_map<u32, u32> m_net_indices;
+    std::vector<u64> m_ones;
+    std::vector<u64> m_unknowns;
+    std::vector<bool> m_is_input;
+
+    // gathered inputs of the current kernel
+    std::vector<u64> m_input_ones;
+    std::vector<u64> m_input_unknowns;
+};
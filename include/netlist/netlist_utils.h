@@ -0,0 +1,82 @@
+//  MIT License
+//
+//  Copyright (c) 2019 Ruhr-University Bochum, Germany, Chair for Embedded Security. All Rights reserved.
+//  Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+
+#pragma once
+
+#include "def.h"
+
+#include "netlist/bdd_manager.h"
+#include "netlist/boolean_function.h"
+
+#include <functional>
+#include <memory>
+
+/** forward declaration */
+class gate;
+class net;
+
+/**
+ * Utility functions that operate on the structure of a netlist.
+ *
+ * @ingroup netlist
+ */
+namespace netlist_utils
+{
+    /**
+     * Returns the name of the variable that represents a net in the functions of subgraphs.
+     *
+     * @param[in] n - The net.
+     * @returns The variable name "net_<id>".
+     */
+    NETLIST_API std::string get_net_variable_name(const std::shared_ptr<net>& n);
+
+    /**
+     * Computes the boolean function of a net by composing the functions of the combinational gates driving it.<br>
+     * The traversal stops at nets without a source, at gates for which the stop condition holds and at gates without a function for the driving pin.
+     * These nets become the variables of the function, named by get_net_variable_name.
+     * If no stop condition is given, the traversal stops at flip-flops and latches.<br>
+     * Unconnected input pins are X and combinational loops are cut by treating the net that closes the loop as a variable.
+     *
+     * The composition is done on a shared BDD manager, so that common subexpressions are built only once.
+     * Supplying the same manager for multiple nets shares the work between their cones.
+     *
+     * @param[in] manager - The BDD manager.
+     * @param[in] n - The net.
+     * @param[in] stop_condition - Returns true for gates that the traversal must not pass.
+     * @returns The diagrams of the function.
+     */
+    NETLIST_API bdd_manager::function get_subgraph_function(bdd_manager& manager, const std::shared_ptr<net>& n, const std::function<bool(const std::shared_ptr<gate>&)>& stop_condition = nullptr);
+
+    /**
+     * Computes the boolean function of a net by composing the functions of the combinational gates driving it.<br>
+     * See the overload on a BDD manager for details.<br>
+     * The result is converted from the diagrams by bdd_manager::to_boolean_function, whose expression can be exponentially larger than the diagrams,
+     * e.g., for cones that compute the parity of many nets. Use the overload on a BDD manager to compare or combine the functions of such cones.
+     *
+     * @param[in] n - The net.
+     * @param[in] stop_condition - Returns true for gates that the traversal must not pass.
+     * @returns The boolean function.
+     */
+    NETLIST_API boolean_function get_subgraph_function(const std::shared_ptr<net>& n, const std::function<bool(const std::shared_ptr<gate>&)>& stop_condition = nullptr);
+}    // namespace netlist_utils
@@ -0,0 +1,166 @@
+//  MIT License
+//
+//  Copyright (c) 2019 Ruhr-University Bochum, Germany, Chair for Embedded Security. All Rights reserved.
+//  Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+
+#pragma once
+
+#include "def.h"
+
+#include "core/memory_mapped_file.h"
+
+#include <map>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+/* forward declaration */
+class netlist;
+
+/**
+ * Binary, columnar representation of a netlist in a .hal file.<br>
+ * Every column, e.g., the gate IDs, the gate names, or the destinations of all nets, is stored in a section of its own.
+ * Names are stored as indices into a string table and connectivity is stored in compressed sparse row (CSR) format.<br>
+ * An opened file is memory mapped and all columns are accessed in place, i.e., names and data entries of single elements
+ * are only materialized on request and the netlist is only built when calling create_netlist().<br>
+ * The file is written in the byte order of the host, files of a different byte order are rejected.
+ *
+ * @ingroup persistent
+ */
+class NETLIST_API netlist_binary_file
+{
+public:
+    /** version of the binary format, independent of the version of the JSON format */
+    static constexpr u32 FORMAT_VERSION = 1;
+
+    /**
+     * Writes a netlist to a binary .hal file.
+     *
+     * @param[in] nl - The netlist to write.
+     * @param[in] hal_file - The file to write to.
+     * @param[in] extension - Opaque content that is stored alongside the netlist, e.g., the data of the hal_file_manager callbacks.
+     * @returns True on success.
+     */
+    static bool write(const std::shared_ptr<netlist>& nl, const hal::path& hal_file, std::string_view extension = "");
+
+    /**
+     * Checks whether a file starts with the header of a binary .hal file.
+     *
+     * @param[in] hal_file - The file to check.
+     * @returns True if the file is a binary .hal file.
+     */
+    static bool is_binary_file(const hal::path& hal_file);
+
+    netlist_binary_file() = default;
+
+    /**
+     * Maps a binary .hal file into memory and validates its section table.<br>
+     * A previously opened file is closed.
+     *
+     * @param[in] hal_file - The file to open.
+     * @returns True on success.
+     */
+    bool open(const hal::path& hal_file);
+
+    /**
+     * Builds the netlist stored in the opened file.
+     *
+     * @param[in] load_data - If false, the data entries of gates, nets, and modules are not loaded.
+     * @returns The netlist or nullptr on error.
+     */
+    std::shared_ptr<netlist> create_netlist(bool load_data = true) const;
+
+    /**
+     * Gets the opaque content stored alongside the netlist.
+     *
+     * @returns The content, valid as long as the file is opened.
+     */
+    std::string_view get_extension() const;
+
+    /**
+     * Gets the name of the gate library of the stored netlist.
+     *
+     * @returns The name of the gate library.
+     */
+    std::string_view get_gate_library_name() const;
+
+    /**
+     * Gets the number of gates, nets, or modules of the stored netlist.<br>
+     * Elements are addressed by their index in [0, num) in ascending order of their IDs, except for modules where parents precede their submodules.
+     *
+     * @returns The number of elements.
+     */
+    u32 get_num_of_gates() const;
+    u32 get_num_of_nets() const;
+    u32 get_num_of_modules() const;
+
+    /**
+     * Gets the ID of a stored gate, net, or module.
+     *
+     * @param[in] index - The index of the element.
+     * @returns The ID.
+     */
+    u32 get_gate_id(u32 index) const;
+    u32 get_net_id(u32 index) const;
+    u32 get_module_id(u32 index) const;
+
+    /**
+     * Gets the name of a stored gate, net, or module without materializing any other names.
+     *
+     * @param[in] index - The index of the element.
+     * @returns The name, valid as long as the file is opened.
+     */
+    std::string_view get_gate_name(u32 index) const;
+    std::string_view get_net_name(u32 index) const;
+    std::string_view get_module_name(u32 index) const;
+
+    /**
+     * Gets the name of the gate type of a stored gate.
+     *
+     * @param[in] index - The index of the gate.
+     * @returns The name of the gate type, valid as long as the file is opened.
+     */
+    std::string_view get_gate_type(u32 index) const;
+
+    /**
+     * Decodes the data entries of a stored gate, net, or module.
+     *
+     * @param[in] index - The index of the element.
+     * @returns A map from ((1) category, (2) key) to ((1) type, (2) value), see data_container::get_data().
+     */
+    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> get_gate_data(u32 index) const;
+    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> get_net_data(u32 index) const;
+    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> get_module_data(u32 index) const;
+
+private:
+    template<typename T>
+    const T* get_column(u32 section) const;
+    u32 get_column_size(u32 section, u32 element_size) const;
+
+    std::string_view get_string(u32 index) const;
+    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> get_data(u32 offsets_section, u32 entries_section, u32 index) const;
+
+    memory_mapped_file m_file;
+    std::vector<std::string_view> m_sections;
+    u64 m_num_of_strings = 0;
+};
@@ -43,8 +43,19 @@ namespace netlist_serializer
      */
     NETLIST_API bool serialize_to_file(std::shared_ptr<netlist> nl, const hal::path& hal_file);
 
+    /**
+     * Serializes a netlist into a binary .hal file, see netlist_binary_file.<br>
+     * Invokes the hal_file_manager and all associated callbacks, their content is stored alongside the netlist.
+     *
+     * @param[in] nl - The netlist to serialize.
+     * @param[in] hal_file - The file to serialize to.
+     * @returns True on success.
+     */
+    NETLIST_API bool serialize_to_binary_file(std::shared_ptr<netlist> nl, const hal::path& hal_file);
+
     /**
      * Deserializes a netlist from a .hal file.<br>
+     * Both JSON and binary .hal files are supported, the format is detected automatically.<br>
      * Invokes the hal_file_manager and all associated callbacks.
      *
      * @param[in] hal_file - The file to deserialize from.
@@ -0,0 +1,266 @@
+//  MIT License
+//
+//  Copyright (c) 2019 Ruhr-University Bochum, Germany, Chair for Embedded Security. All Rights reserved.
+//  Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+#pragma once
+
+#include "def.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+/**
+ * Dense storage for netlist elements (gates, nets, modules) that are addressed by their unique id.<br>
+ * Ids are used as direct indices into a slot array, the elements themselves are kept in a contiguous vector for iteration.<br>
+ * Ids that are far beyond the currently used range are kept in an ordered map instead, so that sparse ids do not blow up the slot array.<br>
+ * The id 0 is reserved and represents an invalid id.
+ *
+ * @ingroup netlist
+ */
+template<class T>
+class slot_map
+{
+public:
+    /**
+     * Checks whether an element is stored for the given id.
+     *
+     * @param[in] id - The id to check.
+     * @returns True if the id is occupied.
+     */
+    bool contains(const u32 id) const
+    {
+        return get_position(id) != INVALID_POSITION;
+    }
+
+    /**
+     * Get the element stored for the given id.
+     *
+     * @param[in] id - The id of the element.
+     * @returns The element or a nullptr.
+     */
+    std::shared_ptr<T> get(const u32 id) const
+    {
+        u32 pos = get_position(id);
+        if (pos == INVALID_POSITION)
+        {
+            return nullptr;
+        }
+        return m_elements[pos];
+    }
+
+    /**
+     * Checks whether exactly this element is stored, i.e., its id is occupied by the very same object.
+     *
+     * @param[in] id - The id of the element.
+     * @param[in] element - The element to check.
+     * @returns True if the element is stored under the given id.
+     */
+    bool contains_element(const u32 id, const std::shared_ptr<T>& element) const
+    {
+        u32 pos = get_position(id);
+        return (element != nullptr) && (pos != INVALID_POSITION) && (m_elements[pos] == element);
+    }
+
+    /**
+     * Stores an element for the given id.
+     *
+     * @param[in] id - The id of the element, must not be 0.
+     * @param[in] element - The element to store.
+     * @returns True on success, false if the id is invalid or already occupied.
+     */
+    bool insert(const u32 id, const std::shared_ptr<T>& element)
+    {
+        if (id == 0 || contains(id))
+        {
+            return false;
+        }
+
+        u32 pos = (u32)m_elements.size();
+        m_elements.push_back(element);
+        m_ids.push_back(id);
+        m_free_ids.erase(id);
+
+        if (id < m_slots.size() || id <= max_direct_id())
+        {
+            if (id >= m_slots.size())
+            {
+                grow_slots(std::max((size_t)id + 1, 2 * m_slots.size()));
+            }
+            m_slots[id] = pos;
+        }
+        else
+        {
+            m_sparse_slots[id] = pos;
+        }
+        return true;
+    }
+
+    /**
+     * Removes the element stored for the given id.<br>
+     * The id is remembered and handed out again by get_unique_id().
+     *
+     * @param[in] id - The id of the element.
+     * @returns True on success, false if the id was not occupied.
+     */
+    bool erase(const u32 id)
+    {
+        u32 pos = get_position(id);
+        if (pos == INVALID_POSITION)
+        {
+            return false;
+        }
+
+        // move the last element into the gap to keep the storage contiguous
+        u32 last = (u32)m_elements.size() - 1;
+        if (pos != last)
+        {
+            m_elements[pos] = std::move(m_elements[last]);
+            m_ids[pos]      = m_ids[last];
+            set_position(m_ids[pos], pos);
+        }
+        m_elements.pop_back();
+        m_ids.pop_back();
+        set_position(id, INVALID_POSITION);
+
+        m_free_ids.insert(id);
+        return true;
+    }
+
+    /**
+     * Gets an unoccupied id.<br>
+     * Previously freed ids are reused first, starting with the smallest one.
+     *
+     * @returns An unoccupied id != 0.
+     */
+    u32 get_unique_id()
+    {
+        if (!m_free_ids.empty())
+        {
+            return *m_free_ids.begin();
+        }
+        while (contains(m_next_id))
+        {
+            m_next_id++;
+        }
+        return m_next_id;
+    }
+
+    /**
+     * Reserves memory for the given number of elements.
+     *
+     * @param[in] count - The expected number of elements.
+     */
+    void reserve(const u32 count)
+    {
+        m_elements.reserve(count);
+        m_ids.reserve(count);
+        if (m_slots.size() <= count)
+        {
+            grow_slots((size_t)count + 1);
+        }
+    }
+
+    /**
+     * Get the number of stored elements.
+     *
+     * @returns The number of elements.
+     */
+    u32 size() const
+    {
+        return (u32)m_elements.size();
+    }
+
+    /**
+     * Get all stored elements in a contiguous vector.<br>
+     * The order is unspecified and changes when elements are removed.
+     *
+     * @returns The elements.
+     */
+    const std::vector<std::shared_ptr<T>>& elements() const
+    {
+        return m_elements;
+    }
+
+private:
+    static constexpr u32 INVALID_POSITION = 0xFFFFFFFF;
+
+    // ids up to this bound are stored in the slot array, larger ones in the sparse map
+    size_t max_direct_id() const
+    {
+        return std::max<size_t>(1 << 16, 2 * m_slots.size());
+    }
+
+    void grow_slots(const size_t new_size)
+    {
+        m_slots.resize(new_size, INVALID_POSITION);
+
+        // sparse ids that are now covered by the slot array have to be moved over, they are the smallest keys of the map
+        auto it = m_sparse_slots.begin();
+        for (; it != m_sparse_slots.end() && it->first < new_size; ++it)
+        {
+            m_slots[it->first] = it->second;
+        }
+        m_sparse_slots.erase(m_sparse_slots.begin(), it);
+    }
+
+    u32 get_position(const u32 id) const
+    {
+        if (id < m_slots.size())
+        {
+            return m_slots[id];
+        }
+        if (m_sparse_slots.empty())
+        {
+            return INVALID_POSITION;
+        }
+        auto it = m_sparse_slots.find(id);
+        return (it == m_sparse_slots.end()) ? INVALID_POSITION : it->second;
+    }
+
+    void set_position(const u32 id, const u32 pos)
+    {
+        if (id < m_slots.size())
+        {
+            m_slots[id] = pos;
+        }
+        else if (pos == INVALID_POSITION)
+        {
+            m_sparse_slots.erase(id);
+        }
+        else
+        {
+            m_sparse_slots[id] = pos;
+        }
+    }
+
+    std::vector<u32> m_slots;
+    std::map<u32, u32> m_sparse_slots;
+
+    std::vector<std::shared_ptr<T>> m_elements;
+    std::vector<u32> m_ids;
+
+    std::set<u32> m_free_ids;
+    u32 m_next_id = 1;
+};
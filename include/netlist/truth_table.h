@@ -0,0 +1,223 @@
+//  MIT License
+//
+//  Copyright (c) 2019 Ruhr-University Bochum, Germany, Chair for Embedded Security. All Rights reserved.
+//  Copyright (c) 2019 Marc Fyrbiak, Sebastian Wallat, Max Hoffmann ("ORIGINAL AUTHORS"). All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+
+
+#pragma once
+
+#include "def.h"
+
+#include "netlist/boolean_function.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Packed truth table of a boolean function with up to MAX_VARIABLES inputs.<br>
+ * The outputs are stored as two bit planes of 64-bit words, one marking ONE outputs and one marking X outputs,
+ * so all operations work on 64 input assignments at once.<br>
+ * The index of an input assignment is built like in boolean_function::get_truth_table, i.e., the first variable is the least significant bit.
+ *
+ * @ingroup netlist
+ */
+class NETLIST_API truth_table
+{
+public:
+    /** the maximum number of variables of a truth table */
+    static constexpr u32 MAX_VARIABLES = 16;
+
+    /**
+     * Constructor for a constant truth table.
+     *
+     * @param[in] num_variables - The number of variables, at most MAX_VARIABLES.
+     * @param[in] constant - The output for all input assignments.
+     */
+    explicit truth_table(u32 num_variables = 0, boolean_function::value constant = boolean_function::ZERO);
+
+    /**
+     * Creates the truth table of a single variable.
+     *
+     * @param[in] num_variables - The number of variables, at most MAX_VARIABLES.
+     * @param[in] index - The index of the variable.
+     * @returns The truth table that is ONE whenever the variable is ONE.
+     */
+    static truth_table variable(u32 num_variables, u32 index);
+
+    /**
+     * Creates a truth table from a vector of outputs as returned by boolean_function::get_truth_table.
+     *
+     * @param[in] outputs - The output for every input assignment, the size has to be a power of two.
+     * @returns The truth table.
+     */
+    static truth_table from_vector(const std::vector<boolean_function::value>& outputs);
+
+    /**
+     * Creates a truth table from a bit plane of ONE outputs, e.g., a LUT configuration.
+     * Missing words are filled with ZERO outputs.
+     *
+     * @param[in] num_variables - The number of variables, at most MAX_VARIABLES.
+     * @param[in] ones - The words of the bit plane, see get_ones.
+     * @returns The truth table.
+     */
+    static truth_table from_words(u32 num_variables, const std::vector<u64>& ones);
+
+    /**
+     * Creates a truth table from a hex string of arbitrary length, e.g., a LUT configuration.<br>
+     * Bit i of the number, counted from the least significant bit of the last digit, is the output for input assignment i.
+     * Missing digits are filled with ZERO outputs, surplus digits are ignored.
+     *
+     * @param[in] num_variables - The number of variables, at most MAX_VARIABLES.
+     * @param[in] hex - The hex digits, optionally prefixed by 0x.
+     * @returns The truth table.
+     */
+    static truth_table from_hex_string(u32 num_variables, const std::string& hex);
+
+    /**
+     * Gets the ONE outputs as a hex string, the inverse of from_hex_string.
+     * The string has one digit per four input assignments, but at least one digit.
+     *
+     * @returns The hex string.
+     */
+    std::string to_hex_string() const;
+
+    /**
+     * Reverses the order of the input assignments, i.e., output i becomes output size()-1-i.
+     * This converts between configurations in ascending and descending bit order.
+     *
+     * @returns The reversed truth table.
+     */
+    truth_table reverse() const;
+
+    /**
+     * Gets the number of variables.
+     *
+     * @returns The number of variables.
+     */
+    u32 get_num_variables() const;
+
+    /**
+     * Gets the number of input assignments, i.e., 2^num_variables.
+     *
+     * @returns The number of input assignments.
+     */
+    u32 size() const;
+
+    /**
+     * Gets the output for an input assignment.
+     *
+     * @param[in] assignment - The index of the input assignment.
+     * @returns The output.
+     */
+    boolean_function::value get_value(u32 assignment) const;
+
+    /**
+     * Sets the output for an input assignment.
+     *
+     * @param[in] assignment - The index of the input assignment.
+     * @param[in] v - The output.
+     */
+    void set_value(u32 assignment, boolean_function::value v);
+
+    /**
+     * Gets the outputs for all input assignments.
+     *
+     * @returns The vector of outputs, see boolean_function::get_truth_table.
+     */
+    std::vector<boolean_function::value> to_vector() const;
+
+    /**
+     * Gets the bit plane of ONE outputs, bit i of word i/64 belongs to input assignment i.
+     *
+     * @returns The words of the bit plane.
+     */
+    const std::vector<u64>& get_ones() const;
+
+    /**
+     * Gets the bit plane of X outputs, bit i of word i/64 belongs to input assignment i.
+     *
+     * @returns The words of the bit plane.
+     */
+    const std::vector<u64>& get_unknowns() const;
+
+    /**
+     * Computes the cofactor with respect to a variable, i.e., the truth table with the variable fixed to a value.
+     * The result keeps the number of variables, it just does not depend on the fixed variable anymore.
+     *
+     * @param[in] index - The index of the variable.
+     * @param[in] value - The value to fix the variable to.
+     * @returns The cofactor.
+     */
+    truth_table cofactor(u32 index, bool value) const;
+
+    /**
+     * Checks whether the output depends on a variable.
+     *
+     * @param[in] index - The index of the variable.
+     * @returns True if the cofactors of the variable differ.
+     */
+    bool depends_on(u32 index) const;
+
+    /**
+     * Checks whether all outputs are equal to a constant.
+     *
+     * @param[in] constant - The constant.
+     * @returns True if the truth table is constant.
+     */
+    bool is_constant(boolean_function::value constant) const;
+
+    /**
+     * Combines two truth tables of the same number of variables, X is handled like in boolean_function::evaluate.
+     *
+     * @param[in] other - The other truth table.
+     * @returns The combined truth table.
+     */
+    truth_table operator&(const truth_table& other) const;
+    truth_table operator|(const truth_table& other) const;
+    truth_table operator^(const truth_table& other) const;
+    truth_table& operator&=(const truth_table& other);
+    truth_table& operator|=(const truth_table& other);
+    truth_table& operator^=(const truth_table& other);
+
+    /**
+     * Negates the truth table, X outputs remain X.
+     *
+     * @returns The negated truth table.
+     */
+    truth_table operator!() const;
+
+    /**
+     * Tests whether two truth tables have the same number of variables and outputs.
+     *
+     * @param[in] other - The other truth table.
+     * @returns True if both truth tables are equal.
+     */
+    bool operator==(const truth_table& other) const;
+    bool operator!=(const truth_table& other) const;
+
+private:
+    // clears the bits of the last word that do not belong to an input assignment
+    void clear_unused_bits();
+
+    u32 m_num_variables;
+    std::vector<u64> m_ones;
+    std::vector<u64> m_unknowns;
+};
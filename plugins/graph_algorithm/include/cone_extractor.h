@@ -0,0 +1,141 @@
+#pragma once
+
+#include "def.h"
+
+#include <limits>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+/* forward declaration */
+class netlist;
+class netlist_graph_snapshot;
+class gate;
+class gate_type;
+
+/**
+ * Extracts levelized fan-in and fan-out cones on the graph snapshot of a netlist (see netlist::get_graph_snapshot).<br>
+ * Gates are addressed by their index within the snapshot and gate types by dense type IDs, so a set of terminal gate
+ * types is resolved once into a filter that can be used for any number of cones. The frontiers of a cone are tracked in
+ * bitsets that are only reset where they were set, i.e., the cost of a cone does not depend on the size of the netlist.<br>
+ * The extractor keeps working on the snapshot it was created with, create a new one after modifying the netlist.
+ */
+class cone_extractor
+{
+public:
+    static constexpr u32 invalid_index = 0xFFFFFFFF;
+    static constexpr u32 unlimited     = std::numeric_limits<u32>::max();
+
+    /**
+     * Creates an extractor for the current state of the netlist.
+     *
+     * @param[in] nl - The netlist.
+     */
+    explicit cone_extractor(const std::shared_ptr<netlist>& nl);
+
+    ~cone_extractor() = default;
+
+    /**
+     * Get the index of a gate.
+     *
+     * @param[in] g - The gate.
+     * @returns The index or cone_extractor::invalid_index if the gate is not part of the snapshot.
+     */
+    u32 get_index(const std::shared_ptr<gate>& g) const;
+
+    /**
+     * Get the gate with the given index.
+     *
+     * @param[in] index - The index.
+     * @returns The gate.
+     */
+    const std::shared_ptr<gate>& get_gate(u32 index) const;
+
+    /**
+     * Get the graph snapshot the extractor works on.
+     *
+     * @returns The snapshot.
+     */
+    const std::shared_ptr<const netlist_graph_snapshot>& get_snapshot() const;
+
+    /**
+     * Get the type ID of a gate.
+     *
+     * @param[in] index - The index of the gate.
+     * @returns The type ID.
+     */
+    u32 get_type_id(u32 index) const;
+
+    /**
+     * Get the number of distinct gate types in the netlist, type IDs are in the range [0, get_num_of_types()).
+     *
+     * @returns The number of gate types.
+     */
+    u32 get_num_of_types() const;
+
+    /**
+     * Resolves gate type names into a type filter. Names of gate types that do not occur in the netlist are ignored.
+     *
+     * @param[in] gate_types - The names of the gate types.
+     * @returns A bitset over the type IDs.
+     */
+    std::vector<u64> get_type_filter(const std::set<std::string>& gate_types) const;
+
+    /**
+     * Get the cone of the given gates level by level.<br>
+     * Level 0 holds the sources, level i + 1 the predecessors (or successors) of the gates in level i. Gates of a terminal
+     * type are not expanded unless they are in level 0.<br>
+     * By default every gate is assigned to the first level it is reached in. If 'revisit' is set, a level holds all gates
+     * that are reachable through a path of that length, so a gate may appear in several levels and the extraction only
+     * ends at 'max_depth' or an empty level.
+     *
+     * @param[in] sources - The indices of the source gates.
+     * @param[in] forward - True for the fan-out cone, false for the fan-in cone.
+     * @param[in] max_depth - The maximum level, level 0 holds the sources.
+     * @param[in] terminal_types - A type filter (see get_type_filter), empty to expand all gates.
+     * @param[in] include_terminals - If false, gates of a terminal type are left out of the cone instead of ending it.
+     * @param[in] revisit - True to allow a gate in more than one level.
+     * @returns The indices of the gates in each level, within a level in the order they were reached.
+     */
+    std::vector<std::vector<u32>> get_cone(const std::vector<u32>& sources,
+                                           bool forward                           = false,
+                                           u32 max_depth                          = unlimited,
+                                           const std::vector<u64>& terminal_types = {},
+                                           bool include_terminals                 = true,
+                                           bool revisit                           = false);
+
+    /**
+     * Get the cones of many gates at once, the cones are extracted in parallel.<br>
+     * Each gate is the only source of its cone, see get_cone() for the parameters.
+     *
+     * @param[in] sources - The indices of the gates.
+     * @param[in] forward - True for the fan-out cones, false for the fan-in cones.
+     * @param[in] max_depth - The maximum level, level 0 holds the sources.
+     * @param[in] terminal_types - A type filter (see get_type_filter), empty to expand all gates.
+     * @param[in] include_terminals - If false, gates of a terminal type are left out of the cones instead of ending them.
+     * @param[in] revisit - True to allow a gate in more than one level.
+     * @returns The levelized cone of sources[i] at position i.
+     */
+    std::vector<std::vector<std::vector<u32>>> get_cones(const std::vector<u32>& sources,
+                                                         bool forward                           = false,
+                                                         u32 max_depth                          = unlimited,
+                                                         const std::vector<u64>& terminal_types = {},
+                                                         bool include_terminals                 = true,
+                                                         bool revisit                           = false) const;
+
+private:
+    void extract(std::vector<u64>& marked,
+                 std::vector<std::vector<u32>>& levels,
+                 const std::vector<u32>& sources,
+                 bool forward,
+                 u32 max_depth,
+                 const std::vector<u64>& terminal_types,
+                 bool include_terminals,
+                 bool revisit) const;
+
+    std::shared_ptr<const netlist_graph_snapshot> m_snapshot;
+    std::vector<u32> m_gate_type_ids;
+    std::vector<std::shared_ptr<const gate_type>> m_types;
+    std::vector<u64> m_marked;
+};
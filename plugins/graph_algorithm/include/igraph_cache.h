@@ -0,0 +1,116 @@
+#pragma once
+
+#include "def.h"
+
+#include "netlist/event_system/gate_event_handler.h"
+#include "netlist/event_system/net_event_handler.h"
+
+#include <igraph/igraph.h>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/* forward declaration */
+class netlist;
+class gate;
+class net;
+
+/**
+ * Directed igraph representation of a netlist that is kept up to date through the net and gate event handlers.<br>
+ * Every gate is mapped to a compact vertex index, so gate IDs do not have to be dense. Nets without a source get a dummy
+ * input vertex and nets without destinations get a dummy output vertex.<br>
+ * Added connections are appended to the existing igraph object, removed ones lead to a rebuild from the cached edges on
+ * the next access. The netlist itself is only traversed again after bulk changes (see netlist_builder) or if changes
+ * were made while the event handlers were disabled.
+ */
+class igraph_cache
+{
+public:
+    static constexpr u32 invalid_vertex = 0xFFFFFFFF;
+
+    /**
+     * Builds the graph of the netlist and registers the event callbacks.
+     *
+     * @param[in] nl - The netlist.
+     */
+    explicit igraph_cache(const std::shared_ptr<netlist>& nl);
+
+    /**
+     * Unregisters the event callbacks and destroys the igraph object.
+     */
+    ~igraph_cache();
+
+    /**
+     * Get the netlist the graph belongs to.
+     *
+     * @returns The netlist or nullptr if it does not exist anymore.
+     */
+    std::shared_ptr<netlist> get_netlist() const;
+
+    /**
+     * Get the up-to-date igraph object.<br>
+     * The object is owned by the cache and must not be modified, use igraph_copy if required.
+     *
+     * @returns The directed graph.
+     */
+    const igraph_t* get_graph();
+
+    /**
+     * Get the gates of all vertices of the igraph object returned by the last call to get_graph().
+     *
+     * @returns A vector from vertex index to gate, nullptr for dummy and unused vertices.
+     */
+    const std::vector<std::shared_ptr<gate>>& get_vertex_gates() const;
+
+    /**
+     * Get the vertex of a gate.
+     *
+     * @param[in] g - The gate.
+     * @returns The vertex index or igraph_cache::invalid_vertex if the gate is not part of the graph.
+     */
+    u32 get_vertex(const std::shared_ptr<gate>& g) const;
+
+private:
+    igraph_cache(const igraph_cache&) = delete;               //disable copy-constructor
+    igraph_cache& operator=(const igraph_cache&) = delete;    //disable copy-assignment
+
+    /* the connections of a net, every destination vertex is connected to the source vertex */
+    struct net_edges
+    {
+        u32 src      = invalid_vertex;
+        bool has_src = false;    // false if 'src' is a dummy input vertex
+        std::vector<u32> dsts;
+        bool has_dsts = false;    // false if 'dsts' only holds a dummy output vertex
+    };
+
+    void rebuild(const std::shared_ptr<netlist>& nl);
+    void compact();
+
+    u32 add_vertex(const std::shared_ptr<gate>& g);
+    void remove_vertex(u32 vertex);
+
+    void add_edge(u32 src, u32 dst);
+    void connect(net_edges& edges, u32 src, const std::vector<u32>& dsts);
+    void add_dst(net_edges& edges, u32 dst);
+    void remove_dst(net_edges& edges, u32 dst);
+    void clear(net_edges& edges);
+
+    void handle_gate_event(gate_event_handler::event e, const std::shared_ptr<gate>& g);
+    void handle_net_event(net_event_handler::event e, const std::shared_ptr<net>& n, u32 associated_data);
+
+    std::weak_ptr<netlist> m_netlist;
+    const netlist* m_netlist_raw;
+    std::string m_callback_name;
+
+    std::vector<std::shared_ptr<gate>> m_vertex_gates;
+    std::unordered_map<u32, u32> m_vertex_of_gate;
+    std::vector<u32> m_free_vertices;
+    std::map<u32, net_edges> m_net_edges;
+
+    igraph_t m_graph;
+    u32 m_graph_vertices;
+    std::vector<u32> m_added_edges;
+    bool m_edges_removed;
+    bool m_netlist_changed;
+};
@@ -2,12 +2,15 @@
 
 #include "core/interface_base.h"
 
+#include <functional>
 #include <igraph/igraph.h>
 
 /* forward declaration */
 class netlist;
 class gate;
 class net;
+class igraph_cache;
+class cone_extractor;
 
 class PLUGIN_API plugin_graph_algorithm : public i_base
 {
@@ -33,7 +36,9 @@ public:
      */
 
     /**
-     * Returns map of community-IDs to communities.
+     * Returns map of community-IDs to communities.<br>
+     * Leaves, i.e., gates with less than two connections to other gates, are repeatedly left out of the communities, the
+     * netlist itself is not modified.
      *
      * @param[in] nl - Netlist (internally transformed to di-graph)
      * @returns A map of community-IDs to sets of gates belonging to the communities
@@ -67,6 +72,17 @@ public:
      */
     std::map<int, std::set<std::shared_ptr<gate>>> get_communities_multilevel(std::shared_ptr<netlist> nl);
 
+    /**
+     * Returns the community of every gate computed by the parallel Leiden algorithm on the undirected gate graph.<br>
+     * The netlist is not modified, the algorithm runs on its graph snapshot (see netlist::get_graph_snapshot).
+     *
+     * @param[in] nl - Netlist
+     * @param[in] resolution - Resolution of the modularity, larger values result in more and smaller communities
+     * @param[in] edge_weight - Weight of the connections through a net, must not be negative (default = nullptr means that every connection has weight 1)
+     * @returns A map from gate ID to community-ID, community-IDs are numbered densely starting at 0.
+     */
+    std::map<u32, u32> get_communities_leiden(std::shared_ptr<netlist> const nl, const double resolution = 1.0, const std::function<double(const std::shared_ptr<net>&)>& edge_weight = nullptr);
+
     /**
      *  other graph algorithm
      */
@@ -80,6 +96,18 @@ public:
      */
     std::set<std::set<std::shared_ptr<gate>>> get_strongly_connected_components(std::shared_ptr<netlist> const nl, const std::set<std::shared_ptr<gate>> gates = {});
 
+    /**
+     * Returns the strongly connected components as gate IDs.<br>
+     * The components are computed on the graph snapshot of the netlist (see netlist::get_graph_snapshot), either by an
+     * iterative variant of Tarjan's algorithm or by a parallel forward-backward algorithm with trimming.
+     *
+     * @param[in] nl - Netlist
+     * @param[in] gate_ids - IDs of the gates for which the strongly connected components are determined (default = empty means that all gates of the netlist are considered)
+     * @param[in] parallel - Use the parallel forward-backward algorithm, pays off on netlists with millions of gates
+     * @returns A vector of strongly connected components where each component is a vector of sorted gate IDs, ordered by their smallest gate ID.
+     */
+    std::vector<std::vector<u32>> get_strongly_connected_component_ids(std::shared_ptr<netlist> const nl, const std::vector<u32>& gate_ids = {}, const bool parallel = false);
+
     /**
      * Returns the set of strongly connected components.
      *
@@ -111,24 +139,39 @@ public:
                                                                const u32 depth                                = std::numeric_limits<u32>::max(),
                                                                const std::set<std::string> terminal_gate_type = std::set<std::string>());
 
+    /**
+     * Return a cone extractor for the provided netlist.<br>
+     * The extractor is kept until the netlist is structurally modified, so repeated graph cuts of the same netlist only
+     * traverse the respective cones.
+     *
+     * @param[in] nl - Netlist
+     * @returns the cone extractor working on the current graph snapshot of the netlist.
+     */
+    std::shared_ptr<cone_extractor> get_cone_extractor(std::shared_ptr<netlist> const nl);
+
     /*
      *      igraph specific functions
      */
     /**
      * Return a map of sets of gates with the same membership id
      *
-     * @param[in] graph - igraph graph object
+     * @param[in] vertex_to_gate - vector from vertex ID in igraph to HAL gate, see igraph_cache::get_vertex_gates
      * @param[in] membership - membership vector
-     * @param[in] vertex_to_gate - map from vertex ID in igraph to HAL gate
      * @returns map from membership id to set of gates that have the membership.
      */
-    std::map<int, std::set<std::shared_ptr<gate>>> get_memberships_for_hal(igraph_t graph, igraph_vector_t membership, std::map<int, std::shared_ptr<gate>> vertex_to_gate);
+    std::map<int, std::set<std::shared_ptr<gate>>> get_memberships_for_hal(const std::vector<std::shared_ptr<gate>>& vertex_to_gate, const igraph_vector_t& membership);
 
     /**
-     * Return the igraph object from the provided netlist.
+     * Return the cached igraph representation of the provided netlist.<br>
+     * The graph is built on first use and afterwards kept up to date through the netlist events, so repeated analyses
+     * of the same netlist do not traverse the netlist again. Requesting the graph of another netlist replaces the cache.
      *
      * @param[in] nl - Netlist
-     * @returns tuple of igraph_t object and map from igraph vertex id to HAL gate ID for further graph analysis.
+     * @returns the cache holding the directed igraph object and the map from igraph vertex id to HAL gate for further graph analysis.
      */
-    std::tuple<igraph_t, std::map<int, std::shared_ptr<gate>>> get_igraph_directed(std::shared_ptr<netlist> const nl);
+    std::shared_ptr<igraph_cache> get_igraph_directed(std::shared_ptr<netlist> const nl);
+
+private:
+    std::shared_ptr<igraph_cache> m_igraph_cache;
+    std::shared_ptr<cone_extractor> m_cone_extractor;
 };
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "def.h"
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+/* forward declaration */
+class netlist;
+class netlist_graph_snapshot;
+class gate;
+class net;
+
+/**
+ * Multi-source shortest path searches on the graph snapshot of a netlist (see netlist::get_graph_snapshot).<br>
+ * Gates are addressed by their index within the snapshot. Stop conditions and edge weights are resolved once when they are
+ * set, and the scratch memory of a search is only reset where the previous search touched it, so an engine can be reused
+ * for millions of small searches, e.g., from every flip-flop to the next flip-flops.<br>
+ * The engine keeps working on the snapshot it was created with, create a new one after modifying the netlist.
+ */
+class shortest_path_engine
+{
+public:
+    static constexpr u32 invalid_index = 0xFFFFFFFF;
+    static constexpr u32 unlimited     = std::numeric_limits<u32>::max();
+
+    /**
+     * Creates an engine for the current state of the netlist.
+     *
+     * @param[in] nl - The netlist.
+     */
+    explicit shortest_path_engine(const std::shared_ptr<netlist>& nl);
+
+    ~shortest_path_engine() = default;
+
+    /**
+     * Get the index of a gate.
+     *
+     * @param[in] g - The gate.
+     * @returns The index or shortest_path_engine::invalid_index if the gate is not part of the snapshot.
+     */
+    u32 get_index(const std::shared_ptr<gate>& g) const;
+
+    /**
+     * Get the gate with the given index.
+     *
+     * @param[in] index - The index.
+     * @returns The gate.
+     */
+    const std::shared_ptr<gate>& get_gate(u32 index) const;
+
+    /**
+     * Get the graph snapshot the engine works on.
+     *
+     * @returns The snapshot.
+     */
+    const std::shared_ptr<const netlist_graph_snapshot>& get_snapshot() const;
+
+    /**
+     * Sets the gates at which searches stop. Stop gates are reached but not expanded, unless they are a source.<br>
+     * E.g., to stop at registers, pass a condition that checks whether the type of a gate is a gate_type_sequential.
+     *
+     * @param[in] condition - The stop condition, nullptr to expand all gates.
+     */
+    void set_stop_condition(const std::function<bool(const std::shared_ptr<gate>&)>& condition);
+
+    /**
+     * Sets the gates at which searches stop by the names of their gate types.
+     *
+     * @param[in] gate_types - The names of the gate types.
+     */
+    void set_stop_gate_types(const std::set<std::string>& gate_types);
+
+    /**
+     * Sets the weights used by dijkstra(), every connection through a net has the weight of that net.
+     *
+     * @param[in] weight - The weight of a net, must not be negative. nullptr to use weight 1 for all nets.
+     * @returns True on success.
+     */
+    bool set_edge_weights(const std::function<double(const std::shared_ptr<net>&)>& weight);
+
+    /**
+     * Breadth-first search with unit weights from multiple sources.
+     *
+     * @param[in] sources - The indices of the source gates.
+     * @param[in] forward - True to follow the successors, false to follow the predecessors.
+     * @param[in] max_depth - The maximum number of edges of a path.
+     * @param[in] targets - If not empty, the search terminates as soon as all of these gates are reached.
+     * @returns The number of reached gates including the sources.
+     */
+    u32 bfs(const std::vector<u32>& sources, bool forward = true, u32 max_depth = unlimited, const std::vector<u32>& targets = {});
+
+    /**
+     * Dijkstra's algorithm from multiple sources using the weights set by set_edge_weights().<br>
+     * If a heuristic is given, this is an A* search. The heuristic has to be consistent, i.e., it must never overestimate the
+     * distance of a gate to the closest target and must not drop by more than the weight of an edge along that edge.<br>
+     * With a maximum depth, every gate gets the shortest of its paths with at most max_depth edges, even if a shorter path
+     * with more edges exists. To this end a gate may be expanded again if it is reached with fewer edges later on.
+     *
+     * @param[in] sources - The indices of the source gates.
+     * @param[in] forward - True to follow the successors, false to follow the predecessors.
+     * @param[in] max_depth - The maximum number of edges of a path.
+     * @param[in] targets - If not empty, the search terminates as soon as the distances of all of these gates are final.
+     * @param[in] heuristic - Lower bound of the remaining distance of a gate given by its index, nullptr for Dijkstra's algorithm.
+     * @returns The number of reached gates including the sources.
+     */
+    u32 dijkstra(const std::vector<u32>& sources,
+                 bool forward                                = true,
+                 u32 max_depth                               = unlimited,
+                 const std::vector<u32>& targets             = {},
+                 const std::function<double(u32)>& heuristic = nullptr);
+
+    /**
+     * Get the gates reached by the last search in the order in which their distances became final.
+     *
+     * @returns The indices of the reached gates.
+     */
+    const std::vector<u32>& get_reached() const;
+
+    /**
+     * Check whether a gate was reached by the last search.
+     *
+     * @param[in] index - The index of the gate.
+     * @returns True if the gate was reached.
+     */
+    bool is_reached(u32 index) const;
+
+    /**
+     * Get the distance of a gate found by the last search.
+     *
+     * @param[in] index - The index of the gate.
+     * @returns The distance or -1 if the gate was not reached.
+     */
+    double get_distance(u32 index) const;
+
+    /**
+     * Get the number of edges on the path to a gate found by the last search.
+     *
+     * @param[in] index - The index of the gate.
+     * @returns The depth or shortest_path_engine::invalid_index if the gate was not reached.
+     */
+    u32 get_depth(u32 index) const;
+
+    /**
+     * Get the path to a gate found by the last search.
+     *
+     * @param[in] index - The index of the gate.
+     * @returns The indices of the gates on the path, starting at a source and ending at the gate. Empty if the gate was not reached.
+     */
+    std::vector<u32> get_path(u32 index) const;
+
+    /**
+     * Computes the distances from every source to every target, the searches run in parallel.
+     *
+     * @param[in] sources - The indices of the source gates.
+     * @param[in] targets - The indices of the target gates.
+     * @param[in] forward - True to follow the successors, false to follow the predecessors.
+     * @param[in] max_depth - The maximum number of edges of a path.
+     * @param[in] weighted - True to use the weights set by set_edge_weights(), false for unit weights.
+     * @returns A matrix holding the distance from sources[i] to targets[j] in row i and column j, -1 for unreachable targets.
+     */
+    std::vector<std::vector<double>>
+        get_distance_matrix(const std::vector<u32>& sources, const std::vector<u32>& targets, bool forward = true, u32 max_depth = unlimited, bool weighted = false) const;
+
+private:
+    /* a path to a gate, continuing the path of its predecessor label */
+    struct label
+    {
+        u32 gate;
+        u32 depth;
+        double distance;
+        u32 predecessor;
+    };
+
+    /* the scratch memory of a search, 'best' holds the label of the shortest path found for every seen gate */
+    struct search_state
+    {
+        std::vector<u64> seen;
+        std::vector<u64> settled;
+        std::vector<u64> target;
+        std::vector<u32> best;
+        std::vector<u32> expanded_depth;
+        std::vector<label> labels;
+        std::vector<u32> touched;
+        std::vector<u32> reached;
+    };
+
+    void init_state(search_state& state) const;
+    void run_bfs(search_state& state, const std::vector<u32>& sources, bool forward, u32 max_depth, const std::vector<u32>& targets) const;
+    void run_dijkstra(search_state& state, const std::vector<u32>& sources, bool forward, u32 max_depth, const std::vector<u32>& targets, const std::function<double(u32)>& heuristic) const;
+    bool prepare(search_state& state, const std::vector<u32>& sources, const std::vector<u32>& targets, u32& num_targets) const;
+
+    std::shared_ptr<const netlist_graph_snapshot> m_snapshot;
+    std::vector<u64> m_stop;
+    std::vector<double> m_net_weights;
+    search_state m_state;
+};
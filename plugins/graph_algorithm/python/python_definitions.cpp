@@ -1,10 +1,13 @@
+#include "cone_extractor.h"
 #include "core/log.h"
 #include "core/utils.h"
 #include "def.h"
 #include "netlist/gate.h"
 #include "netlist/net.h"
 #include "netlist/netlist.h"
+#include "netlist/netlist_graph_snapshot.h"
 #include "plugin_graph_algorithm.h"
+#include "shortest_path_engine.h"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wshadow"
@@ -14,6 +17,7 @@
 #pragma clang diagnostic ignored "-Wshadow-field-in-constructor-modified"
 #endif
 
+#include "pybind11/functional.h"
 #include "pybind11/operators.h"
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
@@ -81,6 +85,21 @@ Returns the map of community-IDs to communities running the multilevel clusterin
 :param set[hal_py.gate] gates: Set of gates for which the strongly connected components are determined. (default = empty means that all gates of the netlist are considered)
 :returns: A map of clusters.
 :rtype: dict[int,set[hal_py.gate]]
+)")
+        .def("get_communities_leiden",
+             &plugin_graph_algorithm::get_communities_leiden,
+             py::arg("netlist"),
+             py::arg("resolution")  = 1.0,
+             py::arg("edge_weight") = nullptr,
+             R"(
+Returns the community of every gate computed by the parallel Leiden algorithm. The netlist is not modified.
+
+:param hal_py.netlist netlist: Netlist (internally transformed to an undirected graph)
+:param float resolution: Resolution of the modularity, larger values result in more and smaller communities.
+:param edge_weight: Weight of the connections through a net, must not be negative. (default = None means that every connection has weight 1)
+:type edge_weight: lambda(hal_py.net) -> float
+:returns: A map from gate ID to community-ID.
+:rtype: dict[int,int]
 )")
         .def("get_communities_spinglass", &plugin_graph_algorithm::get_communities_spinglass, py::arg("nl"), py::arg("spins"), R"(
 Returns the map of community-IDs to communities running the spinglass clustering algorithm.
@@ -106,6 +125,20 @@ Returns the set of strongly connected components.
 :param set[hal_py.gate] gates: Set of gates for which the strongly connected components are determined. (default = empty means that all gates of the netlist are considered)
 :returns: A set of strongly connected components where each component is a set of gates.
 :rtype: set[set[hal_py.gate]]
+)")
+        .def("get_strongly_connected_component_ids",
+             &plugin_graph_algorithm::get_strongly_connected_component_ids,
+             py::arg("netlist"),
+             py::arg("gate_ids") = std::vector<u32>(),
+             py::arg("parallel") = false,
+             R"(
+Returns the strongly connected components as gate IDs.
+
+:param hal_py.netlist netlist: Netlist (internally transformed to di-graph)
+:param list[int] gate_ids: IDs of the gates for which the strongly connected components are determined. (default = empty means that all gates of the netlist are considered)
+:param bool parallel: Use the parallel forward-backward algorithm, pays off on netlists with millions of gates.
+:returns: A list of strongly connected components where each component is a list of sorted gate IDs.
+:rtype: list[list[int]]
 )")
         .def("get_dijkstra_shortest_paths", &plugin_graph_algorithm::get_dijkstra_shortest_paths, py::arg("gate"), R"(
 Returns the shortest path distances for one gate to all other gates.
@@ -130,6 +163,301 @@ Returns a graph cut for a specific gate and depth.
 :type terminal_gate_type: set[str]
 :returns: A list of gate sets where each list entry refers to the distance to the starting gate.
 :rtype: list[set[hal_py.gate]]
+)")
+        .def("get_cone_extractor", &plugin_graph_algorithm::get_cone_extractor, py::arg("netlist"), R"(
+Return a cone extractor for the provided netlist.
+The extractor is kept until the netlist is structurally modified, so repeated graph cuts of the same netlist only traverse the respective cones.
+
+:param hal_py.netlist netlist: Netlist
+:returns: The cone extractor working on the current graph snapshot of the netlist.
+:rtype: libgraph_algorithm.cone_extractor
+)");
+
+    py::class_<cone_extractor, std::shared_ptr<cone_extractor>>(m, "cone_extractor", R"(
+Extracts levelized fan-in and fan-out cones on the graph snapshot of a netlist.
+Gates are addressed by their index within the snapshot, a set of terminal gate types is resolved once into a type filter that can be used for any number of cones.
+The extractor keeps working on the snapshot it was created with, create a new one after modifying the netlist.
+)")
+        .def(py::init<const std::shared_ptr<netlist>&>(), py::arg("netlist"), R"(
+Creates an extractor for the current state of the netlist.
+
+:param hal_py.netlist netlist: The netlist.
+)")
+        .def_readonly_static("invalid_index", &cone_extractor::invalid_index, R"(
+Index of gates that are not part of the snapshot.
+
+:type: int
+)")
+        .def_readonly_static("unlimited", &cone_extractor::unlimited, R"(
+Maximum depth that does not limit the cone.
+
+:type: int
+)")
+        .def("get_index", &cone_extractor::get_index, py::arg("gate"), R"(
+Get the index of a gate.
+
+:param hal_py.gate gate: The gate.
+:returns: The index or cone_extractor.invalid_index if the gate is not part of the snapshot.
+:rtype: int
+)")
+        .def("get_gate",
+             [](const cone_extractor& self, u32 index) {
+                 if (index >= self.get_snapshot()->get_num_of_gates())
+                 {
+                     throw py::index_error("gate index " + std::to_string(index) + " out of range");
+                 }
+                 return self.get_gate(index);
+             },
+             py::arg("index"),
+             R"(
+Get the gate with the given index.
+
+:param int index: The index.
+:returns: The gate.
+:rtype: hal_py.gate
+:raises IndexError: If the index is out of range.
+)")
+        .def("get_snapshot",
+             [](const cone_extractor& self) { return std::const_pointer_cast<netlist_graph_snapshot>(self.get_snapshot()); },
+             R"(
+Get the graph snapshot the extractor works on.
+
+:returns: The snapshot.
+:rtype: hal_py.netlist_graph_snapshot
+)")
+        .def("get_type_id",
+             [](const cone_extractor& self, u32 index) {
+                 if (index >= self.get_snapshot()->get_num_of_gates())
+                 {
+                     throw py::index_error("gate index " + std::to_string(index) + " out of range");
+                 }
+                 return self.get_type_id(index);
+             },
+             py::arg("index"),
+             R"(
+Get the type ID of a gate.
+
+:param int index: The index of the gate.
+:returns: The type ID.
+:rtype: int
+:raises IndexError: If the index is out of range.
+)")
+        .def("get_num_of_types", &cone_extractor::get_num_of_types, R"(
+Get the number of distinct gate types in the netlist, type IDs are in the range [0, get_num_of_types()).
+
+:returns: The number of gate types.
+:rtype: int
+)")
+        .def("get_type_filter", &cone_extractor::get_type_filter, py::arg("gate_types"), R"(
+Resolves gate type names into a type filter. Names of gate types that do not occur in the netlist are ignored.
+
+:param set[str] gate_types: The names of the gate types.
+:returns: A bitset over the type IDs.
+:rtype: list[int]
+)")
+        .def("get_cone",
+             &cone_extractor::get_cone,
+             py::arg("sources"),
+             py::arg("forward")           = false,
+             py::arg("max_depth")         = cone_extractor::unlimited,
+             py::arg("terminal_types")    = std::vector<u64>(),
+             py::arg("include_terminals") = true,
+             py::arg("revisit")           = false,
+             R"(
+Get the cone of the given gates level by level.
+Level 0 holds the sources, level i + 1 the predecessors (or successors) of the gates in level i. Gates of a terminal type are not expanded unless they are in level 0.
+By default every gate is assigned to the first level it is reached in. If 'revisit' is set, a level holds all gates that are reachable through a path of that length.
+
+:param list[int] sources: The indices of the source gates.
+:param bool forward: True for the fan-out cone, false for the fan-in cone.
+:param int max_depth: The maximum level, level 0 holds the sources.
+:param list[int] terminal_types: A type filter (see get_type_filter), empty to expand all gates.
+:param bool include_terminals: If false, gates of a terminal type are left out of the cone instead of ending it.
+:param bool revisit: True to allow a gate in more than one level.
+:returns: The indices of the gates in each level.
+:rtype: list[list[int]]
+)")
+        .def("get_cones",
+             &cone_extractor::get_cones,
+             py::arg("sources"),
+             py::arg("forward")           = false,
+             py::arg("max_depth")         = cone_extractor::unlimited,
+             py::arg("terminal_types")    = std::vector<u64>(),
+             py::arg("include_terminals") = true,
+             py::arg("revisit")           = false,
+             R"(
+Get the cones of many gates at once, the cones are extracted in parallel.
+Each gate is the only source of its cone, see get_cone() for the parameters.
+
+:param list[int] sources: The indices of the gates.
+:param bool forward: True for the fan-out cones, false for the fan-in cones.
+:param int max_depth: The maximum level, level 0 holds the sources.
+:param list[int] terminal_types: A type filter (see get_type_filter), empty to expand all gates.
+:param bool include_terminals: If false, gates of a terminal type are left out of the cones instead of ending them.
+:param bool revisit: True to allow a gate in more than one level.
+:returns: The levelized cone of sources[i] at position i.
+:rtype: list[list[list[int]]]
+)");
+
+    py::class_<shortest_path_engine, std::shared_ptr<shortest_path_engine>>(m, "shortest_path_engine", R"(
+Multi-source shortest path searches on the graph snapshot of a netlist.
+Gates are addressed by their index within the snapshot, stop conditions and edge weights are resolved once when they are set, so an engine can be reused for many small searches.
+The engine keeps working on the snapshot it was created with, create a new one after modifying the netlist.
+)")
+        .def(py::init<const std::shared_ptr<netlist>&>(), py::arg("netlist"), R"(
+Creates an engine for the current state of the netlist.
+
+:param hal_py.netlist netlist: The netlist.
+)")
+        .def_readonly_static("invalid_index", &shortest_path_engine::invalid_index, R"(
+Index of gates that are not part of the snapshot.
+
+:type: int
+)")
+        .def_readonly_static("unlimited", &shortest_path_engine::unlimited, R"(
+Maximum depth that does not limit the search.
+
+:type: int
+)")
+        .def("get_index", &shortest_path_engine::get_index, py::arg("gate"), R"(
+Get the index of a gate.
+
+:param hal_py.gate gate: The gate.
+:returns: The index or shortest_path_engine.invalid_index if the gate is not part of the snapshot.
+:rtype: int
+)")
+        .def("get_gate",
+             [](const shortest_path_engine& self, u32 index) {
+                 if (index >= self.get_snapshot()->get_num_of_gates())
+                 {
+                     throw py::index_error("gate index " + std::to_string(index) + " out of range");
+                 }
+                 return self.get_gate(index);
+             },
+             py::arg("index"),
+             R"(
+Get the gate with the given index.
+
+:param int index: The index.
+:returns: The gate.
+:rtype: hal_py.gate
+:raises IndexError: If the index is out of range.
+)")
+        .def("get_snapshot",
+             [](const shortest_path_engine& self) { return std::const_pointer_cast<netlist_graph_snapshot>(self.get_snapshot()); },
+             R"(
+Get the graph snapshot the engine works on.
+
+:returns: The snapshot.
+:rtype: hal_py.netlist_graph_snapshot
+)")
+        .def("set_stop_condition", &shortest_path_engine::set_stop_condition, py::arg("condition"), R"(
+Sets the gates at which searches stop. Stop gates are reached but not expanded, unless they are a source.
+
+:param condition: The stop condition, None to expand all gates.
+:type condition: lambda(hal_py.gate) -> bool
+)")
+        .def("set_stop_gate_types", &shortest_path_engine::set_stop_gate_types, py::arg("gate_types"), R"(
+Sets the gates at which searches stop by the names of their gate types.
+
+:param set[str] gate_types: The names of the gate types.
+)")
+        .def("set_edge_weights", &shortest_path_engine::set_edge_weights, py::arg("weight"), R"(
+Sets the weights used by dijkstra(), every connection through a net has the weight of that net.
+
+:param weight: The weight of a net, must not be negative. None to use weight 1 for all nets.
+:type weight: lambda(hal_py.net) -> float
+:returns: True on success.
+:rtype: bool
+)")
+        .def("bfs",
+             &shortest_path_engine::bfs,
+             py::arg("sources"),
+             py::arg("forward")   = true,
+             py::arg("max_depth") = shortest_path_engine::unlimited,
+             py::arg("targets")   = std::vector<u32>(),
+             R"(
+Breadth-first search with unit weights from multiple sources.
+
+:param list[int] sources: The indices of the source gates.
+:param bool forward: True to follow the successors, false to follow the predecessors.
+:param int max_depth: The maximum number of edges of a path.
+:param list[int] targets: If not empty, the search terminates as soon as all of these gates are reached.
+:returns: The number of reached gates including the sources.
+:rtype: int
+)")
+        .def("dijkstra",
+             &shortest_path_engine::dijkstra,
+             py::arg("sources"),
+             py::arg("forward")   = true,
+             py::arg("max_depth") = shortest_path_engine::unlimited,
+             py::arg("targets")   = std::vector<u32>(),
+             py::arg("heuristic") = nullptr,
+             R"(
+Dijkstra's algorithm from multiple sources using the weights set by set_edge_weights().
+If a heuristic is given, this is an A* search. The heuristic has to be consistent.
+With a maximum depth, every gate gets the shortest of its paths with at most max_depth edges.
+
+:param list[int] sources: The indices of the source gates.
+:param bool forward: True to follow the successors, false to follow the predecessors.
+:param int max_depth: The maximum number of edges of a path.
+:param list[int] targets: If not empty, the search terminates as soon as the distances of all of these gates are final.
+:param heuristic: Lower bound of the remaining distance of a gate given by its index, None for Dijkstra's algorithm.
+:type heuristic: lambda(int) -> float
+:returns: The number of reached gates including the sources.
+:rtype: int
+)")
+        .def("get_reached", &shortest_path_engine::get_reached, R"(
+Get the gates reached by the last search in the order in which their distances became final.
+
+:returns: The indices of the reached gates.
+:rtype: list[int]
+)")
+        .def("is_reached", &shortest_path_engine::is_reached, py::arg("index"), R"(
+Check whether a gate was reached by the last search.
+
+:param int index: The index of the gate.
+:returns: True if the gate was reached.
+:rtype: bool
+)")
+        .def("get_distance", &shortest_path_engine::get_distance, py::arg("index"), R"(
+Get the distance of a gate found by the last search.
+
+:param int index: The index of the gate.
+:returns: The distance or -1 if the gate was not reached.
+:rtype: float
+)")
+        .def("get_depth", &shortest_path_engine::get_depth, py::arg("index"), R"(
+Get the number of edges on the path to a gate found by the last search.
+
+:param int index: The index of the gate.
+:returns: The depth or shortest_path_engine.invalid_index if the gate was not reached.
+:rtype: int
+)")
+        .def("get_path", &shortest_path_engine::get_path, py::arg("index"), R"(
+Get the path to a gate found by the last search.
+
+:param int index: The index of the gate.
+:returns: The indices of the gates on the path, starting at a source and ending at the gate. Empty if the gate was not reached.
+:rtype: list[int]
+)")
+        .def("get_distance_matrix",
+             &shortest_path_engine::get_distance_matrix,
+             py::arg("sources"),
+             py::arg("targets"),
+             py::arg("forward")   = true,
+             py::arg("max_depth") = shortest_path_engine::unlimited,
+             py::arg("weighted")  = false,
+             R"(
+Computes the distances from every source to every target, the searches run in parallel.
+
+:param list[int] sources: The indices of the source gates.
+:param list[int] targets: The indices of the target gates.
+:param bool forward: True to follow the successors, false to follow the predecessors.
+:param int max_depth: The maximum number of edges of a path.
+:param bool weighted: True to use the weights set by set_edge_weights(), false for unit weights.
+:returns: A matrix holding the distance from sources[i] to targets[j] in row i and column j, -1 for unreachable targets.
+:rtype: list[list[float]]
 )");
 
 #ifndef PYBIND11_MODULE
@@ -0,0 +1,518 @@
+#include "plugin_graph_algorithm.h"
+
+#include "core/log.h"
+
+#include "netlist/gate.h"
+#include "netlist/net.h"
+#include "netlist/netlist.h"
+#include "netlist/netlist_graph_snapshot.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace
+{
+    /* passes of local moving, refinement and aggregation */
+    const u32 MAX_PASSES = 32;
+
+    /* iterations of the local moving phase per pass */
+    const u32 MAX_LOCAL_MOVING_ITERATIONS = 20;
+
+    /* relative modularity gain below which the local moving phase is considered converged */
+    const double TOLERANCE = 1e-6;
+
+    /**
+     * Undirected weighted graph in CSR format.
+     * Edges within a vertex are stored as a self-loop whose weight counts both directions, so that the vertex weights,
+     * i.e., the sum of all adjacent edge weights, stay the same when the graph is aggregated.
+     */
+    struct weighted_graph
+    {
+        std::vector<u32> offsets;
+        std::vector<u32> neighbors;
+        std::vector<double> weights;
+        std::vector<double> vertex_weights;
+
+        u32 size() const
+        {
+            return vertex_weights.size();
+        }
+    };
+
+    void atomic_add(std::atomic<double>& target, double value)
+    {
+        double expected = target.load(std::memory_order_relaxed);
+        while (!target.compare_exchange_weak(expected, expected + value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /**
+     * Sums up the weights of pairs with the same key in place.
+     */
+    void merge_by_key(std::vector<std::pair<u32, double>>& pairs)
+    {
+        std::sort(pairs.begin(), pairs.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        u32 size = 0;
+        for (u32 i = 0; i < pairs.size(); ++i)
+        {
+            if (size > 0 && pairs[size - 1].first == pairs[i].first)
+            {
+                pairs[size - 1].second += pairs[i].second;
+            }
+            else
+            {
+                pairs[size++] = pairs[i];
+            }
+        }
+        pairs.resize(size);
+    }
+
+    /**
+     * Builds a graph from the merged rows of its vertices.
+     */
+    weighted_graph build_graph(std::vector<std::vector<std::pair<u32, double>>>& rows)
+    {
+        weighted_graph g;
+        i32 n = rows.size();
+        g.offsets.assign(n + 1, 0);
+        for (i32 v = 0; v < n; ++v)
+        {
+            g.offsets[v + 1] = g.offsets[v] + rows[v].size();
+        }
+        g.neighbors.resize(g.offsets[n]);
+        g.weights.resize(g.offsets[n]);
+        g.vertex_weights.assign(n, 0.0);
+
+#pragma omp parallel for schedule(dynamic, 1024)
+        for (i32 v = 0; v < n; ++v)
+        {
+            u32 e = g.offsets[v];
+            for (const auto& [u, w] : rows[v])
+            {
+                g.neighbors[e] = u;
+                g.weights[e]   = w;
+                g.vertex_weights[v] += w;
+                e++;
+            }
+            std::vector<std::pair<u32, double>>().swap(rows[v]);
+        }
+        return g;
+    }
+
+    /**
+     * Moves vertices to the neighboring community with the largest modularity gain until no vertex improves anymore.
+     * All vertices are processed in parallel, after a move only the neighbors outside of the new community are revisited.
+     *
+     * @returns True if at least one vertex was moved.
+     */
+    bool move_vertices(const weighted_graph& g, std::vector<std::atomic<u32>>& membership, std::vector<std::atomic<double>>& community_weights, double resolution, double total_weight)
+    {
+        i32 n = g.size();
+        std::vector<std::atomic<bool>> pending(n);
+        for (i32 v = 0; v < n; ++v)
+        {
+            pending[v].store(true, std::memory_order_relaxed);
+        }
+
+        bool moved_any = false;
+        for (u32 iteration = 0; iteration < MAX_LOCAL_MOVING_ITERATIONS; ++iteration)
+        {
+            double gain = 0;
+            bool moved  = false;
+
+#pragma omp parallel reduction(+ : gain) reduction(|| : moved)
+            {
+                std::vector<std::pair<u32, double>> links;
+
+#pragma omp for schedule(dynamic, 1024)
+                for (i32 v = 0; v < n; ++v)
+                {
+                    if (!pending[v].exchange(false, std::memory_order_relaxed))
+                    {
+                        continue;
+                    }
+
+                    u32 current = membership[v].load(std::memory_order_relaxed);
+                    double k_v  = g.vertex_weights[v];
+                    double own  = 0;
+
+                    links.clear();
+                    for (u32 e = g.offsets[v]; e < g.offsets[v + 1]; ++e)
+                    {
+                        u32 u = g.neighbors[e];
+                        if (u == (u32)v)
+                        {
+                            continue;
+                        }
+                        u32 c = membership[u].load(std::memory_order_relaxed);
+                        if (c == current)
+                        {
+                            own += g.weights[e];
+                        }
+                        else
+                        {
+                            links.emplace_back(c, g.weights[e]);
+                        }
+                    }
+                    merge_by_key(links);
+
+                    double factor    = resolution * k_v / total_weight;
+                    double stay_gain = own - factor * (community_weights[current].load(std::memory_order_relaxed) - k_v);
+                    double best_gain = stay_gain;
+                    u32 best         = current;
+                    for (const auto& [c, w] : links)
+                    {
+                        double move_gain = w - factor * community_weights[c].load(std::memory_order_relaxed);
+                        if (move_gain > best_gain)
+                        {
+                            best_gain = move_gain;
+                            best      = c;
+                        }
+                    }
+
+                    if (best == current)
+                    {
+                        continue;
+                    }
+
+                    atomic_add(community_weights[current], -k_v);
+                    atomic_add(community_weights[best], k_v);
+                    membership[v].store(best, std::memory_order_relaxed);
+                    gain += best_gain - stay_gain;
+                    moved = true;
+
+                    for (u32 e = g.offsets[v]; e < g.offsets[v + 1]; ++e)
+                    {
+                        u32 u = g.neighbors[e];
+                        if (membership[u].load(std::memory_order_relaxed) != best)
+                        {
+                            pending[u].store(true, std::memory_order_relaxed);
+                        }
+                    }
+                }
+            }
+
+            moved_any |= moved;
+            if (!moved || gain < TOLERANCE * total_weight)
+            {
+                break;
+            }
+        }
+        return moved_any;
+    }
+
+    /**
+     * Splits every community into well-connected sub-communities.
+     * Starting from singletons, every vertex that is still a singleton and well-connected to its community greedily merges
+     * into the well-connected sub-community of the same community with the largest modularity gain.
+     * The communities are refined in parallel but the vertices of a community sequentially, so a vertex only joins a
+     * sub-community it is connected to and the result does not depend on the scheduling of the threads.
+     */
+    std::vector<u32> refine_communities(const weighted_graph& g, const std::vector<std::atomic<u32>>& membership, const std::vector<std::atomic<double>>& community_weights, double resolution, double total_weight)
+    {
+        u32 n = g.size();
+
+        // group the vertices by community, ascending within every community
+        std::vector<u32> community(n);
+        std::vector<u32> member_offsets(n + 1, 0);
+        for (u32 v = 0; v < n; ++v)
+        {
+            community[v] = membership[v].load(std::memory_order_relaxed);
+            member_offsets[community[v] + 1]++;
+        }
+        for (u32 c = 0; c < n; ++c)
+        {
+            member_offsets[c + 1] += member_offsets[c];
+        }
+        std::vector<u32> members(n);
+        std::vector<u32> position(member_offsets.begin(), member_offsets.end() - 1);
+        for (u32 v = 0; v < n; ++v)
+        {
+            members[position[community[v]]++] = v;
+        }
+
+        // sub-communities are labeled by the vertex they started from, so every label belongs to exactly one community
+        std::vector<u32> refined(n);
+        std::vector<double> refined_weights(n);
+        std::vector<double> external_weights(n);
+        std::vector<u8> singleton(n, 1);
+
+#pragma omp parallel for schedule(dynamic, 1024)
+        for (i32 v = 0; v < (i32)n; ++v)
+        {
+            refined[v]         = v;
+            refined_weights[v] = g.vertex_weights[v];
+
+            double external = 0;
+            for (u32 e = g.offsets[v]; e < g.offsets[v + 1]; ++e)
+            {
+                u32 u = g.neighbors[e];
+                if (u != (u32)v && community[u] == community[v])
+                {
+                    external += g.weights[e];
+                }
+            }
+            external_weights[v] = external;
+        }
+
+#pragma omp parallel
+        {
+            std::vector<std::pair<u32, double>> links;
+
+#pragma omp for schedule(dynamic, 1)
+            for (i32 c = 0; c < (i32)n; ++c)
+            {
+                double community_weight = community_weights[c].load(std::memory_order_relaxed);
+                auto well_connected     = [&](u32 label) {
+                    double weight = refined_weights[label];
+                    return external_weights[label] >= resolution * weight * (community_weight - weight) / total_weight;
+                };
+
+                for (u32 i = member_offsets[c]; i < member_offsets[c + 1]; ++i)
+                {
+                    u32 v = members[i];
+                    if (!singleton[v] || !well_connected(v))
+                    {
+                        continue;
+                    }
+
+                    links.clear();
+                    for (u32 e = g.offsets[v]; e < g.offsets[v + 1]; ++e)
+                    {
+                        u32 u = g.neighbors[e];
+                        if (u != v && community[u] == (u32)c)
+                        {
+                            links.emplace_back(refined[u], g.weights[e]);
+                        }
+                    }
+                    merge_by_key(links);
+
+                    double factor    = resolution * g.vertex_weights[v] / total_weight;
+                    double best_gain = 0;
+                    double best_link = 0;
+                    u32 best         = v;
+                    for (const auto& [label, w] : links)
+                    {
+                        double move_gain = w - factor * refined_weights[label];
+                        if (move_gain > best_gain && well_connected(label))
+                        {
+                            best_gain = move_gain;
+                            best_link = w;
+                            best      = label;
+                        }
+                    }
+                    if (best == v)
+                    {
+                        continue;
+                    }
+
+                    // neither the vertex nor the sub-community it joins may leave afterwards
+                    singleton[v]    = 0;
+                    singleton[best] = 0;
+                    refined[v]      = best;
+                    refined_weights[best] += g.vertex_weights[v];
+                    external_weights[best] += external_weights[v] - 2 * best_link;
+                }
+            }
+        }
+
+        return refined;
+    }
+
+    /**
+     * Renumbers the labels densely in the order of their first occurrence.
+     *
+     * @returns The number of distinct labels.
+     */
+    u32 renumber(std::vector<u32>& labels)
+    {
+        std::vector<u32> new_label(labels.size(), netlist_graph_snapshot::invalid_index);
+        u32 count = 0;
+        for (auto& label : labels)
+        {
+            if (new_label[label] == netlist_graph_snapshot::invalid_index)
+            {
+                new_label[label] = count++;
+            }
+            label = new_label[label];
+        }
+        return count;
+    }
+
+    /**
+     * Collapses every refined community into a single vertex.
+     */
+    weighted_graph aggregate(const weighted_graph& g, const std::vector<u32>& refined, u32 num_refined)
+    {
+        // group the vertices by refined community
+        std::vector<u32> member_offsets(num_refined + 1, 0);
+        for (u32 v = 0; v < g.size(); ++v)
+        {
+            member_offsets[refined[v] + 1]++;
+        }
+        for (u32 c = 0; c < num_refined; ++c)
+        {
+            member_offsets[c + 1] += member_offsets[c];
+        }
+        std::vector<u32> members(g.size());
+        std::vector<u32> position(member_offsets.begin(), member_offsets.end() - 1);
+        for (u32 v = 0; v < g.size(); ++v)
+        {
+            members[position[refined[v]]++] = v;
+        }
+
+        std::vector<std::vector<std::pair<u32, double>>> rows(num_refined);
+
+#pragma omp parallel for schedule(dynamic, 256)
+        for (i32 c = 0; c < (i32)num_refined; ++c)
+        {
+            auto& row = rows[c];
+            for (u32 i = member_offsets[c]; i < member_offsets[c + 1]; ++i)
+            {
+                u32 v = members[i];
+                for (u32 e = g.offsets[v]; e < g.offsets[v + 1]; ++e)
+                {
+                    row.emplace_back(refined[g.neighbors[e]], g.weights[e]);
+                }
+            }
+            merge_by_key(row);
+            row.shrink_to_fit();
+        }
+
+        return build_graph(rows);
+    }
+}    // namespace
+
+std::map<u32, u32> plugin_graph_algorithm::get_communities_leiden(std::shared_ptr<netlist> const nl, const double resolution, const std::function<double(const std::shared_ptr<net>&)>& edge_weight)
+{
+    if (nl == nullptr)
+    {
+        log_error(this->get_name(), "{}", "parameter 'nl' is nullptr");
+        return std::map<u32, u32>();
+    }
+    if (resolution <= 0)
+    {
+        log_error(this->get_name(), "resolution has to be positive, {} given", resolution);
+        return std::map<u32, u32>();
+    }
+
+    auto snapshot = nl->get_graph_snapshot();
+    i32 num_gates = snapshot->get_num_of_gates();
+
+    /* the weight function is evaluated once per net, so it does not need to be thread-safe */
+    std::vector<double> net_weights(snapshot->get_num_of_nets(), 1.0);
+    if (edge_weight != nullptr)
+    {
+        for (u32 i = 0; i < net_weights.size(); ++i)
+        {
+            net_weights[i] = edge_weight(snapshot->get_net(i));
+            if (!(net_weights[i] >= 0))
+            {
+                log_error(this->get_name(), "edge weight of net '{}' (id {}) is negative", snapshot->get_net(i)->get_name(), snapshot->get_net(i)->get_id());
+                return std::map<u32, u32>();
+            }
+        }
+    }
+
+    /* undirected gate graph, every gate-to-gate connection contributes to both of its gates */
+    std::vector<std::vector<std::pair<u32, double>>> rows(num_gates);
+
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (i32 i = 0; i < num_gates; ++i)
+    {
+        auto& row = rows[i];
+        for (const auto& e : snapshot->get_successors(i))
+        {
+            row.emplace_back(e.gate, net_weights[e.net]);
+        }
+        for (const auto& e : snapshot->get_predecessors(i))
+        {
+            row.emplace_back(e.gate, net_weights[e.net]);
+        }
+        merge_by_key(row);
+    }
+    weighted_graph graph = build_graph(rows);
+
+    double total_weight = 0;
+    for (double k : graph.vertex_weights)
+    {
+        total_weight += k;
+    }
+
+    /* the vertex of the current aggregation level every gate belongs to */
+    std::vector<u32> vertex_of_gate(num_gates);
+    for (i32 i = 0; i < num_gates; ++i)
+    {
+        vertex_of_gate[i] = i;
+    }
+
+    std::vector<u32> communities(num_gates);
+    for (i32 i = 0; i < num_gates; ++i)
+    {
+        communities[i] = i;
+    }
+
+    for (u32 pass = 0; pass < MAX_PASSES && total_weight > 0; ++pass)
+    {
+        u32 n = graph.size();
+        std::vector<std::atomic<u32>> membership(n);
+        std::vector<std::atomic<double>> community_weights(n);
+        for (u32 v = 0; v < n; ++v)
+        {
+            membership[v].store(communities[v], std::memory_order_relaxed);
+            community_weights[v].store(0, std::memory_order_relaxed);
+        }
+        for (u32 v = 0; v < n; ++v)
+        {
+            atomic_add(community_weights[communities[v]], graph.vertex_weights[v]);
+        }
+
+        bool moved = move_vertices(graph, membership, community_weights, resolution, total_weight);
+        for (u32 v = 0; v < n; ++v)
+        {
+            communities[v] = membership[v].load(std::memory_order_relaxed);
+        }
+        u32 num_communities = renumber(communities);
+        if (!moved || num_communities == n)
+        {
+            break;
+        }
+
+        std::vector<u32> refined = refine_communities(graph, membership, community_weights, resolution, total_weight);
+        u32 num_refined          = renumber(refined);
+        if (num_refined == n)
+        {
+            break;
+        }
+
+        /* every refined community lies within a single community, which becomes the initial community of its vertex */
+        std::vector<u32> aggregated_communities(num_refined);
+        for (u32 v = 0; v < n; ++v)
+        {
+            aggregated_communities[refined[v]] = communities[v];
+        }
+        for (auto& v : vertex_of_gate)
+        {
+            v = refined[v];
+        }
+
+        graph       = aggregate(graph, refined, num_refined);
+        communities = std::move(aggregated_communities);
+    }
+
+    /* number the communities by their first gate */
+    std::vector<u32> gate_communities(num_gates);
+    for (i32 i = 0; i < num_gates; ++i)
+    {
+        gate_communities[i] = communities[vertex_of_gate[i]];
+    }
+    renumber(gate_communities);
+
+    std::map<u32, u32> result;
+    for (i32 i = 0; i < num_gates; ++i)
+    {
+        result[snapshot->get_gate(i)->get_id()] = gate_communities[i];
+    }
+    return result;
+}
@@ -2,6 +2,7 @@
 
 #include "core/log.h"
 
+#include "igraph_cache.h"
 #include "netlist/gate.h"
 #include "netlist/net.h"
 #include "netlist/netlist.h"
@@ -16,82 +17,120 @@ std::map<int, std::set<std::shared_ptr<gate>>> plugin_graph_algorithm::get_commu
         return std::map<int, std::set<std::shared_ptr<gate>>>();
     }
 
-    /* delete leaves */
-    bool deleted_leave;
-    do
+    auto cache               = get_igraph_directed(nl);
+    const igraph_t* directed = cache->get_graph();
+    const auto& vertex_gates = cache->get_vertex_gates();
+    u32 num_vertices         = vertex_gates.size();
+
+    /* collect the connections between gates, dummy vertices of nets without source or destination are left out */
+    std::vector<std::vector<u32>> predecessors(num_vertices), successors(num_vertices);
+    igraph_vector_t edge_list;
+    igraph_vector_init(&edge_list, 0);
+    igraph_get_edgelist(directed, &edge_list, false);
+    for (long i = 0; i + 1 < igraph_vector_size(&edge_list); i += 2)
     {
-        deleted_leave = false;
-        for (const auto& test_gate : nl->get_gates())
+        u32 src = (u32)VECTOR(edge_list)[i];
+        u32 dst = (u32)VECTOR(edge_list)[i + 1];
+        if (vertex_gates[src] != nullptr && vertex_gates[dst] != nullptr)
         {
-            u32 counter = test_gate->get_predecessors().size() + test_gate->get_successors().size();
-            if (counter < 2)
-            {
-                nl->delete_gate(test_gate);
-                deleted_leave = true;
-            }
-            /* delete leaves connected to a single gate as successor and predecessor */
-            else if ((counter == 2) && (test_gate->get_predecessors().size() == 1) && (test_gate->get_successors().size() == 1))
-            {
-                if (test_gate->get_predecessors()[0].get_gate() == test_gate->get_successors()[0].get_gate())
-                {
-                    nl->delete_gate(test_gate);
-                    deleted_leave = true;
-                }
-            }
+            successors[src].push_back(dst);
+            predecessors[dst].push_back(src);
         }
-    } while (deleted_leave);
+    }
+    igraph_vector_destroy(&edge_list);
 
-    /* map netlist to igraph IDs for both directions */
-    std::map<int, int> nl_igraph_id_match, igraph_nl_id_match;
-    u32 id_count = 0;
-    for (const auto& single_gate : nl->get_gates())
+    /* ignore leaves, the netlist itself is left untouched */
+    std::vector<bool> removed(num_vertices);
+    std::vector<u32> num_predecessors(num_vertices), num_successors(num_vertices);
+    std::vector<u32> worklist;
+    for (u32 v = 0; v < num_vertices; ++v)
     {
-        nl_igraph_id_match[single_gate->get_id()] = id_count;
-        igraph_nl_id_match[id_count]              = single_gate->get_id();
-        id_count++;
+        removed[v]          = (vertex_gates[v] == nullptr);
+        num_predecessors[v] = predecessors[v].size();
+        num_successors[v]   = successors[v].size();
+        worklist.push_back(v);
     }
 
-    /* count amount of nets, with all destinations of all nets */
-    u32 edge_counter = 0;
-    for (const auto& net : nl->get_nets())
+    auto first_remaining = [&](const std::vector<u32>& neighbors) {
+        for (u32 n : neighbors)
+        {
+            if (!removed[n])
+            {
+                return n;
+            }
+        }
+        return igraph_cache::invalid_vertex;
+    };
+
+    auto is_leaf = [&](u32 v) {
+        u32 counter = num_predecessors[v] + num_successors[v];
+        if (counter < 2)
+        {
+            return true;
+        }
+        /* leaves connected to a single gate as successor and predecessor */
+        return num_predecessors[v] == 1 && num_successors[v] == 1 && first_remaining(predecessors[v]) == first_remaining(successors[v]);
+    };
+
+    while (!worklist.empty())
     {
-        if (net->get_src().get_gate() == nullptr)
+        u32 v = worklist.back();
+        worklist.pop_back();
+        if (removed[v] || !is_leaf(v))
+        {
             continue;
-
-        for (const auto& successor : net->get_dsts())
+        }
+        removed[v] = true;
+        for (u32 p : predecessors[v])
         {
-            if (successor.get_gate() == nullptr)
-                continue;
-            edge_counter += 2;
+            num_successors[p]--;
+            worklist.push_back(p);
+        }
+        for (u32 s : successors[v])
+        {
+            num_predecessors[s]--;
+            worklist.push_back(s);
         }
     }
 
-    /* transform all nets to igraph_real_t */
-    igraph_real_t* edges     = new igraph_real_t[edge_counter];
-    u32 edge_vertice_counter = 0;
-    for (const auto& net : nl->get_nets())
+    /* map the remaining gates to consecutive vertices */
+    std::vector<u32> vertex_of(num_vertices, igraph_cache::invalid_vertex);
+    std::vector<std::shared_ptr<gate>> remaining_gates;
+    for (u32 v = 0; v < num_vertices; ++v)
     {
-        auto predecessor = net->get_src().get_gate();
-        if (predecessor == nullptr)
-            continue;
-        auto predecessor_id = nl_igraph_id_match[predecessor->get_id()];
+        if (!removed[v])
+        {
+            vertex_of[v] = remaining_gates.size();
+            remaining_gates.push_back(vertex_gates[v]);
+        }
+    }
+    if (remaining_gates.empty())
+    {
+        return std::map<int, std::set<std::shared_ptr<gate>>>();
+    }
 
-        for (const auto& successor : net->get_dsts())
+    std::vector<u32> edges;
+    for (u32 v = 0; v < num_vertices; ++v)
+    {
+        for (u32 s : successors[v])
         {
-            if (successor.get_gate() == nullptr)
-                continue;
-            auto successor_id             = nl_igraph_id_match[successor.get_gate()->get_id()];
-            edges[edge_vertice_counter++] = (igraph_real_t)predecessor_id;
-            edges[edge_vertice_counter++] = (igraph_real_t)successor_id;
+            if (!removed[v] && !removed[s])
+            {
+                edges.push_back(vertex_of[v]);
+                edges.push_back(vertex_of[s]);
+            }
         }
     }
 
     /* create and add edges to the graph */
     igraph_t graph;
     igraph_vector_t netlist_edges;
-    igraph_vector_init_copy(&netlist_edges, edges, edge_counter);
-    delete[] edges;
-    igraph_create(&graph, &netlist_edges, nl->get_gates().size(), IGRAPH_UNDIRECTED);
+    igraph_vector_init(&netlist_edges, edges.size());
+    for (u32 i = 0; i < edges.size(); ++i)
+    {
+        VECTOR(netlist_edges)[i] = edges[i];
+    }
+    igraph_create(&graph, &netlist_edges, remaining_gates.size(), IGRAPH_UNDIRECTED);
     igraph_vector_destroy(&netlist_edges);
 
     /* remove double edges */
@@ -109,11 +148,7 @@ std::map<int, std::set<std::shared_ptr<gate>>> plugin_graph_algorithm::get_commu
     igraph_destroy(&graph);
 
     /* group gates by community membership */
-    std::map<int, std::set<std::shared_ptr<gate>>> community_sets;
-    for (int i = 0; i < igraph_vector_size(&membership); i++)
-    {
-        community_sets[(int)VECTOR(membership)[i]].insert(nl->get_gate_by_id(igraph_nl_id_match[i]));
-    }
+    auto community_sets = get_memberships_for_hal(remaining_gates, membership);
     igraph_vector_destroy(&membership);
 
     return community_sets;
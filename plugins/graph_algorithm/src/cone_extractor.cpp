@@ -0,0 +1,210 @@
+#include "cone_extractor.h"
+
+#include "core/log.h"
+
+#include "netlist/gate.h"
+#include "netlist/gate_library/gate_type/gate_type.h"
+#include "netlist/netlist.h"
+#include "netlist/netlist_graph_snapshot.h"
+
+#include <unordered_map>
+
+namespace
+{
+    bool is_marked(const std::vector<u64>& bits, u32 i)
+    {
+        return (bits[i >> 6] >> (i & 63)) & 1;
+    }
+
+    void mark(std::vector<u64>& bits, u32 i)
+    {
+        bits[i >> 6] |= 1ull << (i & 63);
+    }
+
+    void unmark(std::vector<u64>& bits, u32 i)
+    {
+        bits[i >> 6] &= ~(1ull << (i & 63));
+    }
+}    // namespace
+
+cone_extractor::cone_extractor(const std::shared_ptr<netlist>& nl)
+{
+    m_snapshot    = nl->get_graph_snapshot();
+    u32 num_gates = m_snapshot->get_num_of_gates();
+
+    // gate types are numbered in the order of their first occurrence
+    std::unordered_map<const gate_type*, u32> type_ids;
+    m_gate_type_ids.resize(num_gates);
+    for (u32 i = 0; i < num_gates; ++i)
+    {
+        auto type = m_snapshot->get_gate(i)->get_type();
+        auto it   = type_ids.find(type.get());
+        if (it == type_ids.end())
+        {
+            it = type_ids.emplace(type.get(), m_types.size()).first;
+            m_types.push_back(type);
+        }
+        m_gate_type_ids[i] = it->second;
+    }
+
+    m_marked.assign((num_gates + 63) / 64, 0);
+}
+
+u32 cone_extractor::get_index(const std::shared_ptr<gate>& g) const
+{
+    return m_snapshot->get_gate_index(g);
+}
+
+const std::shared_ptr<gate>& cone_extractor::get_gate(u32 index) const
+{
+    return m_snapshot->get_gate(index);
+}
+
+const std::shared_ptr<const netlist_graph_snapshot>& cone_extractor::get_snapshot() const
+{
+    return m_snapshot;
+}
+
+u32 cone_extractor::get_type_id(u32 index) const
+{
+    return m_gate_type_ids[index];
+}
+
+u32 cone_extractor::get_num_of_types() const
+{
+    return m_types.size();
+}
+
+std::vector<u64> cone_extractor::get_type_filter(const std::set<std::string>& gate_types) const
+{
+    std::vector<u64> filter((m_types.size() + 63) / 64, 0);
+    for (u32 id = 0; id < m_types.size(); ++id)
+    {
+        if (gate_types.find(m_types[id]->get_name()) != gate_types.end())
+        {
+            mark(filter, id);
+        }
+    }
+    return filter;
+}
+
+std::vector<std::vector<u32>>
+    cone_extractor::get_cone(const std::vector<u32>& sources, bool forward, u32 max_depth, const std::vector<u64>& terminal_types, bool include_terminals, bool revisit)
+{
+    std::vector<std::vector<u32>> levels;
+    extract(m_marked, levels, sources, forward, max_depth, terminal_types, include_terminals, revisit);
+    return levels;
+}
+
+std::vector<std::vector<std::vector<u32>>> cone_extractor::get_cones(const std::vector<u32>& sources,
+                                                                     bool forward,
+                                                                     u32 max_depth,
+                                                                     const std::vector<u64>& terminal_types,
+                                                                     bool include_terminals,
+                                                                     bool revisit) const
+{
+    std::vector<std::vector<std::vector<u32>>> result(sources.size());
+    i32 num_sources = sources.size();
+
+#pragma omp parallel
+    {
+        std::vector<u64> marked((m_snapshot->get_num_of_gates() + 63) / 64, 0);
+
+#pragma omp for schedule(dynamic, 1)
+        for (i32 i = 0; i < num_sources; ++i)
+        {
+            extract(marked, result[i], {sources[i]}, forward, max_depth, terminal_types, include_terminals, revisit);
+        }
+    }
+    return result;
+}
+
+void cone_extractor::extract(std::vector<u64>& marked,
+                             std::vector<std::vector<u32>>& levels,
+                             const std::vector<u32>& sources,
+                             bool forward,
+                             u32 max_depth,
+                             const std::vector<u64>& terminal_types,
+                             bool include_terminals,
+                             bool revisit) const
+{
+    levels.clear();
+
+    u32 num_gates = m_snapshot->get_num_of_gates();
+    for (u32 s : sources)
+    {
+        if (s >= num_gates)
+        {
+            log_error("graph_algorithm", "source index {} exceeds the {} gates of the netlist.", s, num_gates);
+            return;
+        }
+    }
+
+    auto is_terminal = [&](u32 v) {
+        u32 type_id = m_gate_type_ids[v];
+        return (type_id >> 6) < terminal_types.size() && is_marked(terminal_types, type_id);
+    };
+
+    // without revisiting, the marks hold all gates of the cone, otherwise only the gates of the level that is being built
+    std::vector<u32> level;
+    for (u32 s : sources)
+    {
+        if (!is_marked(marked, s))
+        {
+            mark(marked, s);
+            level.push_back(s);
+        }
+    }
+
+    for (u32 depth = 0;; ++depth)
+    {
+        if (revisit)
+        {
+            for (u32 v : level)
+            {
+                unmark(marked, v);
+            }
+        }
+        levels.push_back(std::move(level));
+        level.clear();
+
+        if (depth >= max_depth)
+        {
+            break;
+        }
+
+        for (u32 v : levels.back())
+        {
+            if (depth > 0 && is_terminal(v))
+            {
+                continue;
+            }
+            auto edges = forward ? m_snapshot->get_successors(v) : m_snapshot->get_predecessors(v);
+            for (const auto& e : edges)
+            {
+                if (is_marked(marked, e.gate) || (!include_terminals && is_terminal(e.gate)))
+                {
+                    continue;
+                }
+                mark(marked, e.gate);
+                level.push_back(e.gate);
+            }
+        }
+
+        if (level.empty())
+        {
+            break;
+        }
+    }
+
+    if (!revisit)
+    {
+        for (const auto& cone_level : levels)
+        {
+            for (u32 v : cone_level)
+            {
+                unmark(marked, v);
+            }
+        }
+    }
+}
@@ -1,9 +1,12 @@
 #include "plugin_graph_algorithm.h"
 
+#include "cone_extractor.h"
+
 #include "core/log.h"
 
 #include "netlist/gate.h"
 #include "netlist/netlist.h"
+#include "netlist/netlist_graph_snapshot.h"
 
 std::vector<std::set<std::shared_ptr<gate>>>
     plugin_graph_algorithm::get_graph_cut(std::shared_ptr<netlist> const g, std::shared_ptr<gate> const current_gate, const u32 depth, const std::set<std::string> terminal_gate_type)
@@ -24,35 +27,44 @@ std::vector<std::set<std::shared_ptr<gate>>>
         return std::vector<std::set<std::shared_ptr<gate>>>();
     }
 
-    std::vector<std::set<std::shared_ptr<gate>>> result;
-    result.push_back({current_gate});
-
-    if (depth == 1)
+    auto cones = get_cone_extractor(g);
+    u32 start  = cones->get_index(current_gate);
+    if (start == cone_extractor::invalid_index)
     {
-        return result;
+        log_error(this->get_name(), "gate '{}' (id {}) is not part of the netlist.", current_gate->get_name(), current_gate->get_id());
+        return std::vector<std::set<std::shared_ptr<gate>>>();
     }
 
-    for (u32 i = 1; i < depth; i++)
+    // every level holds all predecessors of the previous one, so gates may appear in several levels
+    auto levels = cones->get_cone({start}, false, (depth > 0) ? depth - 1 : 0, cones->get_type_filter(terminal_gate_type), false, true);
+
+    std::vector<std::set<std::shared_ptr<gate>>> result;
+    result.reserve(levels.size());
+    for (const auto& level : levels)
     {
-        std::set<std::shared_ptr<gate>> previous_state = result.back(), next_state = std::set<std::shared_ptr<gate>>();
-        for (const auto& it : previous_state)
-        {
-            for (const auto& predecessor : it->get_predecessors())
-            {
-                if (terminal_gate_type.find(predecessor.gate->get_type()->get_name()) == terminal_gate_type.end())
-                {
-                    next_state.insert(predecessor.gate);
-                }
-            }
-        }
-        if (next_state.empty())
-        {
-            return result;
-        }
-        else
+        std::set<std::shared_ptr<gate>> gates;
+        for (u32 v : level)
         {
-            result.push_back(next_state);
+            gates.insert(cones->get_gate(v));
         }
+        result.push_back(std::move(gates));
     }
     return result;
 }
+
+std::shared_ptr<cone_extractor> plugin_graph_algorithm::get_cone_extractor(std::shared_ptr<netlist> const nl)
+{
+    if (nl == nullptr)
+    {
+        log_error(this->get_name(), "parameter 'nl' is nullptr.");
+        return nullptr;
+    }
+
+    // the snapshot of a netlist is only replaced on structural changes
+    auto snapshot = nl->get_graph_snapshot();
+    if (m_cone_extractor == nullptr || m_cone_extractor->get_snapshot() != snapshot)
+    {
+        m_cone_extractor = std::make_shared<cone_extractor>(nl);
+    }
+    return m_cone_extractor;
+}
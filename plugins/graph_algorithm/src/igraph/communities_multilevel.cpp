@@ -3,6 +3,7 @@
 #include "core/log.h"
 #include "core/plugin_manager.h"
 
+#include "igraph_cache.h"
 #include "netlist/gate.h"
 #include "netlist/net.h"
 #include "netlist/netlist.h"
@@ -18,11 +19,11 @@ std::map<int, std::set<std::shared_ptr<gate>>> plugin_graph_algorithm::get_commu
         return std::map<int, std::set<std::shared_ptr<gate>>>();
     }
 
-    std::tuple<igraph_t, std::map<int, std::shared_ptr<gate>>> igraph_tuple = get_igraph_directed(nl);
-    igraph_t graph                                                          = std::get<0>(igraph_tuple);
-    std::map<int, std::shared_ptr<gate>> vertex_to_gate                     = std::get<1>(igraph_tuple);
+    auto cache = get_igraph_directed(nl);
 
-    // convert to undirected
+    // convert a copy of the cached graph to undirected
+    igraph_t graph;
+    igraph_copy(&graph, cache->get_graph());
     igraph_to_undirected(&graph, IGRAPH_TO_UNDIRECTED_MUTUAL, 0);
 
     igraph_vector_t membership_vec, modularity;
@@ -39,11 +40,7 @@ std::map<int, std::set<std::shared_ptr<gate>>> plugin_graph_algorithm::get_commu
                                 &modularity);
 
     // map back to HAL structures
-    std::map<int, std::set<std::shared_ptr<gate>>> community_sets;
-    for (int i = 0; i < igraph_vector_size(&membership_vec); i++)
-    {
-        community_sets[(int)VECTOR(membership_vec)[i]].insert(vertex_to_gate[i]);
-    }
+    auto community_sets = get_memberships_for_hal(cache->get_vertex_gates(), membership_vec);
 
     igraph_destroy(&graph);
     igraph_vector_destroy(&membership_vec);
@@ -3,6 +3,7 @@
 #include "core/log.h"
 #include "core/plugin_manager.h"
 
+#include "igraph_cache.h"
 #include "netlist/gate.h"
 #include "netlist/net.h"
 #include "netlist/netlist.h"
@@ -18,19 +19,17 @@ std::map<int, std::set<std::shared_ptr<gate>>> plugin_graph_algorithm::get_commu
         return std::map<int, std::set<std::shared_ptr<gate>>>();
     }
 
-    log_info("graph_algorithm", "netlist has {} gates and {} nets", nl->get_gates().size(), nl->get_nets().size());
+    log_info("graph_algorithm", "netlist has {} gates and {} nets", nl->get_num_of_gates(), nl->get_nets().size());
 
-    std::tuple<igraph_t, std::map<int, std::shared_ptr<gate>>> igraph_tuple = get_igraph_directed(nl);
-
-    igraph_t graph                                                          = std::get<0>(igraph_tuple);
-    std::map<int, std::shared_ptr<gate>> vertex_to_gate                     = std::get<1>(igraph_tuple);
+    auto cache            = get_igraph_directed(nl);
+    const igraph_t* graph = cache->get_graph();
 
     igraph_real_t modularity, temperature;
     igraph_vector_t membership, csize;
 
     igraph_vector_init(&membership, 0);
     igraph_vector_init(&csize, 0);
-    igraph_community_spinglass(&graph,
+    igraph_community_spinglass(graph,
                                0, /* no weights */
                                &modularity,
                                &temperature,
@@ -57,9 +56,8 @@ std::map<int, std::set<std::shared_ptr<gate>>> plugin_graph_algorithm::get_commu
     }
 
     // map back to HAL structures
-    auto community_sets = get_memberships_for_hal(graph, membership, vertex_to_gate);
+    auto community_sets = get_memberships_for_hal(cache->get_vertex_gates(), membership);
 
-    igraph_destroy(&graph);
     igraph_vector_destroy(&membership);
     igraph_vector_destroy(&csize);
 
@@ -3,6 +3,7 @@
 #include "core/log.h"
 #include "core/plugin_manager.h"
 
+#include "igraph_cache.h"
 #include "netlist/gate.h"
 #include "netlist/net.h"
 #include "netlist/netlist.h"
@@ -20,9 +21,8 @@ std::set<std::set<std::shared_ptr<gate>>> plugin_graph_algorithm::get_scc(std::s
     }
 
     // get igraph
-    std::tuple<igraph_t, std::map<int, std::shared_ptr<gate>>> igraph_tuple = get_igraph_directed(nl);
-    igraph_t graph = std::get<0>(igraph_tuple);
-    std::map<int, std::shared_ptr<gate>> vertex_to_gate = std::get<1>(igraph_tuple);
+    auto cache            = get_igraph_directed(nl);
+    const igraph_t* graph = cache->get_graph();
 
     igraph_vector_t membership, csize;
     igraph_integer_t number_of_clusters;
@@ -30,10 +30,10 @@ std::set<std::set<std::shared_ptr<gate>>> plugin_graph_algorithm::get_scc(std::s
     igraph_vector_init(&csize, 0);
 
     // run scc
-    igraph_clusters(&graph, &membership, &csize, &number_of_clusters, IGRAPH_STRONG);
+    igraph_clusters(graph, &membership, &csize, &number_of_clusters, IGRAPH_STRONG);
 
     // map back to HAL structures
-    std::map<int, std::set<std::shared_ptr<gate>>> ssc_membership = get_memberships_for_hal(graph, membership, vertex_to_gate);
+    std::map<int, std::set<std::shared_ptr<gate>>> ssc_membership = get_memberships_for_hal(cache->get_vertex_gates(), membership);
 
     // convert to set
     std::set<std::set<std::shared_ptr<gate>>> sccs;
@@ -41,5 +41,8 @@ std::set<std::set<std::shared_ptr<gate>>> plugin_graph_algorithm::get_scc(std::s
     {
         sccs.insert(scc.second);
     }
+
+    igraph_vector_destroy(&membership);
+    igraph_vector_destroy(&csize);
     return sccs;
 }
@@ -0,0 +1,409 @@
+#include "igraph_cache.h"
+
+#include "core/log.h"
+
+#include "netlist/event_system/netlist_event_handler.h"
+#include "netlist/gate.h"
+#include "netlist/net.h"
+#include "netlist/netlist.h"
+
+#include <algorithm>
+
+igraph_cache::igraph_cache(const std::shared_ptr<netlist>& nl) : m_netlist(nl), m_netlist_raw(nl.get())
+{
+    m_graph_vertices  = 0;
+    m_edges_removed   = false;
+    m_netlist_changed = true;
+    igraph_empty(&m_graph, 0, IGRAPH_DIRECTED);
+
+    m_callback_name = "graph_algorithm_igraph_cache_" + std::to_string(reinterpret_cast<uintptr_t>(this));
+    gate_event_handler::register_callback(m_callback_name, [this](gate_event_handler::event e, std::shared_ptr<gate> g, u32) { handle_gate_event(e, g); });
+    net_event_handler::register_callback(m_callback_name, [this](net_event_handler::event e, std::shared_ptr<net> n, u32 associated_data) { handle_net_event(e, n, associated_data); });
+    netlist_event_handler::register_callback(m_callback_name, [this](netlist_event_handler::event e, std::shared_ptr<netlist> changed_nl, u32) {
+        if (e == netlist_event_handler::event::bulk_changes_committed && changed_nl.get() == m_netlist_raw)
+        {
+            m_netlist_changed = true;
+        }
+    });
+}
+
+igraph_cache::~igraph_cache()
+{
+    gate_event_handler::unregister_callback(m_callback_name);
+    net_event_handler::unregister_callback(m_callback_name);
+    netlist_event_handler::unregister_callback(m_callback_name);
+    igraph_destroy(&m_graph);
+}
+
+std::shared_ptr<netlist> igraph_cache::get_netlist() const
+{
+    return m_netlist.lock();
+}
+
+const igraph_t* igraph_cache::get_graph()
+{
+    auto nl = m_netlist.lock();
+    if (nl == nullptr)
+    {
+        log_error("graph_algorithm", "the netlist of the igraph cache does not exist anymore.");
+        return &m_graph;
+    }
+
+    // changes made while the event handlers were disabled are not tracked
+    if (m_vertex_of_gate.size() != nl->get_num_of_gates())
+    {
+        m_netlist_changed = true;
+    }
+
+    if (m_netlist_changed)
+    {
+        rebuild(nl);
+    }
+
+    if (m_edges_removed)
+    {
+        compact();
+
+        u32 num_edges = 0;
+        for (const auto& it : m_net_edges)
+        {
+            num_edges += it.second.dsts.size();
+        }
+
+        igraph_vector_t edges;
+        igraph_vector_init(&edges, 2 * num_edges);
+        u32 edge_vertex_counter = 0;
+        for (const auto& it : m_net_edges)
+        {
+            for (u32 dst : it.second.dsts)
+            {
+                VECTOR(edges)[edge_vertex_counter++] = it.second.src;
+                VECTOR(edges)[edge_vertex_counter++] = dst;
+            }
+        }
+
+        igraph_destroy(&m_graph);
+        igraph_create(&m_graph, &edges, m_vertex_gates.size(), IGRAPH_DIRECTED);
+        igraph_vector_destroy(&edges);
+    }
+    else
+    {
+        if (m_graph_vertices < m_vertex_gates.size())
+        {
+            igraph_add_vertices(&m_graph, m_vertex_gates.size() - m_graph_vertices, 0);
+        }
+        if (!m_added_edges.empty())
+        {
+            igraph_vector_t edges;
+            igraph_vector_init(&edges, m_added_edges.size());
+            for (u32 i = 0; i < m_added_edges.size(); ++i)
+            {
+                VECTOR(edges)[i] = m_added_edges[i];
+            }
+            igraph_add_edges(&m_graph, &edges, 0);
+            igraph_vector_destroy(&edges);
+        }
+    }
+
+    m_graph_vertices = m_vertex_gates.size();
+    m_edges_removed  = false;
+    m_added_edges.clear();
+
+    return &m_graph;
+}
+
+const std::vector<std::shared_ptr<gate>>& igraph_cache::get_vertex_gates() const
+{
+    return m_vertex_gates;
+}
+
+u32 igraph_cache::get_vertex(const std::shared_ptr<gate>& g) const
+{
+    if (g == nullptr)
+    {
+        return invalid_vertex;
+    }
+    auto it = m_vertex_of_gate.find(g->get_id());
+    if (it == m_vertex_of_gate.end() || m_vertex_gates[it->second] != g)
+    {
+        return invalid_vertex;
+    }
+    return it->second;
+}
+
+void igraph_cache::rebuild(const std::shared_ptr<netlist>& nl)
+{
+    m_vertex_gates.clear();
+    m_vertex_of_gate.clear();
+    m_free_vertices.clear();
+    m_net_edges.clear();
+
+    m_vertex_gates.reserve(nl->get_num_of_gates());
+    nl->for_each_gate([this](const std::shared_ptr<gate>& g) { add_vertex(g); });
+
+    // nets are processed by ID so that the dummy vertices are numbered deterministically
+    auto net_set = nl->get_nets();
+    std::vector<std::shared_ptr<net>> nets(net_set.begin(), net_set.end());
+    std::sort(nets.begin(), nets.end(), [](const auto& a, const auto& b) { return a->get_id() < b->get_id(); });
+
+    std::vector<u32> dsts;
+    for (const auto& n : nets)
+    {
+        dsts.clear();
+        for (const auto& dst : n->get_dsts())
+        {
+            dsts.push_back(m_vertex_of_gate.at(dst.get_gate()->get_id()));
+        }
+        auto src_gate = n->get_src().get_gate();
+        connect(m_net_edges[n->get_id()], (src_gate != nullptr) ? m_vertex_of_gate.at(src_gate->get_id()) : invalid_vertex, dsts);
+    }
+
+    m_netlist_changed = false;
+    m_edges_removed   = true;
+}
+
+void igraph_cache::compact()
+{
+    if (m_free_vertices.empty())
+    {
+        return;
+    }
+
+    std::vector<u32> new_index(m_vertex_gates.size(), 0);
+    for (u32 v : m_free_vertices)
+    {
+        new_index[v] = invalid_vertex;
+    }
+    u32 num_vertices = 0;
+    for (u32 v = 0; v < m_vertex_gates.size(); ++v)
+    {
+        if (new_index[v] != invalid_vertex)
+        {
+            new_index[v]                 = num_vertices;
+            m_vertex_gates[num_vertices] = std::move(m_vertex_gates[v]);
+            num_vertices++;
+        }
+    }
+    m_vertex_gates.resize(num_vertices);
+    m_free_vertices.clear();
+
+    for (auto& it : m_vertex_of_gate)
+    {
+        it.second = new_index[it.second];
+    }
+    for (auto& it : m_net_edges)
+    {
+        if (it.second.src != invalid_vertex)
+        {
+            it.second.src = new_index[it.second.src];
+        }
+        for (auto& dst : it.second.dsts)
+        {
+            dst = new_index[dst];
+        }
+    }
+}
+
+u32 igraph_cache::add_vertex(const std::shared_ptr<gate>& g)
+{
+    u32 vertex;
+    if (!m_free_vertices.empty())
+    {
+        vertex = m_free_vertices.back();
+        m_free_vertices.pop_back();
+        m_vertex_gates[vertex] = g;
+    }
+    else
+    {
+        vertex = m_vertex_gates.size();
+        m_vertex_gates.push_back(g);
+    }
+
+    if (g != nullptr)
+    {
+        m_vertex_of_gate[g->get_id()] = vertex;
+    }
+    return vertex;
+}
+
+void igraph_cache::remove_vertex(u32 vertex)
+{
+    if (m_vertex_gates[vertex] != nullptr)
+    {
+        m_vertex_of_gate.erase(m_vertex_gates[vertex]->get_id());
+        m_vertex_gates[vertex] = nullptr;
+    }
+    m_free_vertices.push_back(vertex);
+}
+
+void igraph_cache::add_edge(u32 src, u32 dst)
+{
+    m_added_edges.push_back(src);
+    m_added_edges.push_back(dst);
+}
+
+void igraph_cache::connect(net_edges& edges, u32 src, const std::vector<u32>& dsts)
+{
+    edges.has_src  = (src != invalid_vertex);
+    edges.has_dsts = !dsts.empty();
+    if (!edges.has_src && !edges.has_dsts)
+    {
+        edges.src = invalid_vertex;
+        edges.dsts.clear();
+        return;
+    }
+
+    // a net without source gets a dummy input vertex, a net without destinations a dummy output vertex
+    edges.src = edges.has_src ? src : add_vertex(nullptr);
+    if (edges.has_dsts)
+    {
+        edges.dsts = dsts;
+    }
+    else
+    {
+        edges.dsts = {add_vertex(nullptr)};
+    }
+
+    for (u32 dst : edges.dsts)
+    {
+        add_edge(edges.src, dst);
+    }
+}
+
+void igraph_cache::add_dst(net_edges& edges, u32 dst)
+{
+    if (!edges.has_dsts)
+    {
+        if (!edges.dsts.empty())
+        {
+            remove_vertex(edges.dsts[0]);
+            edges.dsts.clear();
+            m_edges_removed = true;
+        }
+        edges.has_dsts = true;
+    }
+    if (edges.src == invalid_vertex)
+    {
+        edges.src = add_vertex(nullptr);
+    }
+
+    edges.dsts.push_back(dst);
+    add_edge(edges.src, dst);
+}
+
+void igraph_cache::remove_dst(net_edges& edges, u32 dst)
+{
+    auto it = std::find(edges.dsts.begin(), edges.dsts.end(), dst);
+    if (!edges.has_dsts || it == edges.dsts.end())
+    {
+        return;
+    }
+    *it = edges.dsts.back();
+    edges.dsts.pop_back();
+    m_edges_removed = true;
+
+    if (edges.dsts.empty())
+    {
+        std::vector<u32> no_dsts;
+        u32 src = edges.has_src ? edges.src : invalid_vertex;
+        clear(edges);
+        connect(edges, src, no_dsts);
+    }
+}
+
+void igraph_cache::clear(net_edges& edges)
+{
+    if (edges.src != invalid_vertex && !edges.has_src)
+    {
+        remove_vertex(edges.src);
+    }
+    if (!edges.has_dsts && !edges.dsts.empty())
+    {
+        remove_vertex(edges.dsts[0]);
+    }
+    if (!edges.dsts.empty())
+    {
+        m_edges_removed = true;
+    }
+
+    edges.src      = invalid_vertex;
+    edges.has_src  = false;
+    edges.has_dsts = false;
+    edges.dsts.clear();
+}
+
+void igraph_cache::handle_gate_event(gate_event_handler::event e, const std::shared_ptr<gate>& g)
+{
+    if (m_netlist_changed || g->get_netlist().get() != m_netlist_raw)
+    {
+        return;
+    }
+
+    if (e == gate_event_handler::event::created)
+    {
+        add_vertex(g);
+    }
+    else if (e == gate_event_handler::event::removed)
+    {
+        // all connections of the gate have already been removed through net events
+        u32 vertex = get_vertex(g);
+        if (vertex != invalid_vertex)
+        {
+            remove_vertex(vertex);
+        }
+    }
+}
+
+void igraph_cache::handle_net_event(net_event_handler::event e, const std::shared_ptr<net>& n, u32 associated_data)
+{
+    if (m_netlist_changed || n->get_netlist().get() != m_netlist_raw)
+    {
+        return;
+    }
+
+    if (e == net_event_handler::event::removed)
+    {
+        auto it = m_net_edges.find(n->get_id());
+        if (it != m_net_edges.end())
+        {
+            clear(it->second);
+            m_net_edges.erase(it);
+        }
+        return;
+    }
+
+    if (e != net_event_handler::event::src_changed && e != net_event_handler::event::dst_added && e != net_event_handler::event::dst_removed)
+    {
+        return;
+    }
+
+    auto& edges = m_net_edges[n->get_id()];
+    if (e == net_event_handler::event::src_changed)
+    {
+        std::vector<u32> dsts;
+        if (edges.has_dsts)
+        {
+            dsts = edges.dsts;
+        }
+        auto src_gate = n->get_src().get_gate();
+        clear(edges);
+        connect(edges, (src_gate != nullptr) ? get_vertex(src_gate) : invalid_vertex, dsts);
+        return;
+    }
+
+    auto it = m_vertex_of_gate.find(associated_data);
+    if (it == m_vertex_of_gate.end())
+    {
+        m_netlist_changed = true;
+        return;
+    }
+
+    if (e == net_event_handler::event::dst_added)
+    {
+        add_dst(edges, it->second);
+    }
+    else
+    {
+        remove_dst(edges, it->second);
+    }
+}
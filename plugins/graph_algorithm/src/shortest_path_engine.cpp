@@ -0,0 +1,390 @@
+#include "shortest_path_engine.h"
+
+#include "core/log.h"
+
+#include "netlist/gate.h"
+#include "netlist/gate_library/gate_type/gate_type.h"
+#include "netlist/net.h"
+#include "netlist/netlist.h"
+#include "netlist/netlist_graph_snapshot.h"
+
+#include <algorithm>
+#include <queue>
+#include <unordered_set>
+
+namespace
+{
+    bool is_marked(const std::vector<u64>& bits, u32 i)
+    {
+        return (bits[i >> 6] >> (i & 63)) & 1;
+    }
+
+    void mark(std::vector<u64>& bits, u32 i)
+    {
+        bits[i >> 6] |= 1ull << (i & 63);
+    }
+
+    void unmark(std::vector<u64>& bits, u32 i)
+    {
+        bits[i >> 6] &= ~(1ull << (i & 63));
+    }
+}    // namespace
+
+shortest_path_engine::shortest_path_engine(const std::shared_ptr<netlist>& nl)
+{
+    m_snapshot = nl->get_graph_snapshot();
+    m_stop.assign((m_snapshot->get_num_of_gates() + 63) / 64, 0);
+    m_net_weights.assign(m_snapshot->get_num_of_nets(), 1.0);
+    init_state(m_state);
+}
+
+u32 shortest_path_engine::get_index(const std::shared_ptr<gate>& g) const
+{
+    return m_snapshot->get_gate_index(g);
+}
+
+const std::shared_ptr<gate>& shortest_path_engine::get_gate(u32 index) const
+{
+    return m_snapshot->get_gate(index);
+}
+
+const std::shared_ptr<const netlist_graph_snapshot>& shortest_path_engine::get_snapshot() const
+{
+    return m_snapshot;
+}
+
+void shortest_path_engine::set_stop_condition(const std::function<bool(const std::shared_ptr<gate>&)>& condition)
+{
+    std::fill(m_stop.begin(), m_stop.end(), 0);
+    if (condition == nullptr)
+    {
+        return;
+    }
+    for (u32 i = 0; i < m_snapshot->get_num_of_gates(); ++i)
+    {
+        if (condition(m_snapshot->get_gate(i)))
+        {
+            mark(m_stop, i);
+        }
+    }
+}
+
+void shortest_path_engine::set_stop_gate_types(const std::set<std::string>& gate_types)
+{
+    // gate types are compared by their objects, so the names are only looked up once per type
+    std::unordered_set<const gate_type*> stop_types, other_types;
+    set_stop_condition([&](const std::shared_ptr<gate>& g) {
+        const gate_type* type = g->get_type().get();
+        if (stop_types.find(type) != stop_types.end())
+        {
+            return true;
+        }
+        if (other_types.find(type) != other_types.end())
+        {
+            return false;
+        }
+        bool stop = gate_types.find(type->get_name()) != gate_types.end();
+        (stop ? stop_types : other_types).insert(type);
+        return stop;
+    });
+}
+
+bool shortest_path_engine::set_edge_weights(const std::function<double(const std::shared_ptr<net>&)>& weight)
+{
+    std::vector<double> net_weights(m_snapshot->get_num_of_nets(), 1.0);
+    if (weight != nullptr)
+    {
+        for (u32 i = 0; i < net_weights.size(); ++i)
+        {
+            net_weights[i] = weight(m_snapshot->get_net(i));
+            if (!(net_weights[i] >= 0))
+            {
+                log_error("graph_algorithm", "edge weight of net '{}' (id {}) is negative.", m_snapshot->get_net(i)->get_name(), m_snapshot->get_net(i)->get_id());
+                return false;
+            }
+        }
+    }
+    m_net_weights = std::move(net_weights);
+    return true;
+}
+
+u32 shortest_path_engine::bfs(const std::vector<u32>& sources, bool forward, u32 max_depth, const std::vector<u32>& targets)
+{
+    run_bfs(m_state, sources, forward, max_depth, targets);
+    return m_state.reached.size();
+}
+
+u32 shortest_path_engine::dijkstra(const std::vector<u32>& sources, bool forward, u32 max_depth, const std::vector<u32>& targets, const std::function<double(u32)>& heuristic)
+{
+    run_dijkstra(m_state, sources, forward, max_depth, targets, heuristic);
+    return m_state.reached.size();
+}
+
+const std::vector<u32>& shortest_path_engine::get_reached() const
+{
+    return m_state.reached;
+}
+
+bool shortest_path_engine::is_reached(u32 index) const
+{
+    return index < m_snapshot->get_num_of_gates() && is_marked(m_state.settled, index);
+}
+
+double shortest_path_engine::get_distance(u32 index) const
+{
+    return is_reached(index) ? m_state.labels[m_state.best[index]].distance : -1;
+}
+
+u32 shortest_path_engine::get_depth(u32 index) const
+{
+    return is_reached(index) ? m_state.labels[m_state.best[index]].depth : invalid_index;
+}
+
+std::vector<u32> shortest_path_engine::get_path(u32 index) const
+{
+    std::vector<u32> path;
+    if (!is_reached(index))
+    {
+        return path;
+    }
+    for (u32 l = m_state.best[index]; l != invalid_index; l = m_state.labels[l].predecessor)
+    {
+        path.push_back(m_state.labels[l].gate);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+std::vector<std::vector<double>> shortest_path_engine::get_distance_matrix(const std::vector<u32>& sources, const std::vector<u32>& targets, bool forward, u32 max_depth, bool weighted) const
+{
+    std::vector<std::vector<double>> result(sources.size(), std::vector<double>(targets.size(), -1));
+    i32 num_sources = sources.size();
+
+#pragma omp parallel
+    {
+        search_state state;
+        init_state(state);
+
+#pragma omp for schedule(dynamic, 1)
+        for (i32 i = 0; i < num_sources; ++i)
+        {
+            if (weighted)
+            {
+                run_dijkstra(state, {sources[i]}, forward, max_depth, targets, nullptr);
+            }
+            else
+            {
+                run_bfs(state, {sources[i]}, forward, max_depth, targets);
+            }
+
+            for (u32 j = 0; j < targets.size(); ++j)
+            {
+                if (targets[j] < m_snapshot->get_num_of_gates() && is_marked(state.settled, targets[j]))
+                {
+                    result[i][j] = state.labels[state.best[targets[j]]].distance;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+void shortest_path_engine::init_state(search_state& state) const
+{
+    u32 num_gates = m_snapshot->get_num_of_gates();
+    state.seen.assign((num_gates + 63) / 64, 0);
+    state.settled.assign((num_gates + 63) / 64, 0);
+    state.target.assign((num_gates + 63) / 64, 0);
+    state.best.resize(num_gates);
+    state.expanded_depth.resize(num_gates);
+}
+
+bool shortest_path_engine::prepare(search_state& state, const std::vector<u32>& sources, const std::vector<u32>& targets, u32& num_targets) const
+{
+    // only the entries touched by the previous search have to be reset
+    for (u32 v : state.touched)
+    {
+        unmark(state.seen, v);
+        unmark(state.settled, v);
+        unmark(state.target, v);
+    }
+    state.touched.clear();
+    state.reached.clear();
+    state.labels.clear();
+
+    u32 num_gates = m_snapshot->get_num_of_gates();
+    for (u32 s : sources)
+    {
+        if (s >= num_gates)
+        {
+            log_error("graph_algorithm", "source index {} exceeds the {} gates of the netlist.", s, num_gates);
+            return false;
+        }
+    }
+
+    num_targets = 0;
+    for (u32 t : targets)
+    {
+        if (t < num_gates && !is_marked(state.target, t))
+        {
+            mark(state.target, t);
+            state.touched.push_back(t);
+            num_targets++;
+        }
+    }
+    return true;
+}
+
+void shortest_path_engine::run_bfs(search_state& state, const std::vector<u32>& sources, bool forward, u32 max_depth, const std::vector<u32>& targets) const
+{
+    u32 remaining;
+    if (!prepare(state, sources, targets, remaining))
+    {
+        return;
+    }
+    bool stop_at_targets = !targets.empty();
+
+    auto discover = [&](u32 v, u32 predecessor, u32 depth) {
+        mark(state.seen, v);
+        mark(state.settled, v);
+        state.touched.push_back(v);
+        state.reached.push_back(v);
+        state.best[v] = state.labels.size();
+        state.labels.push_back({v, depth, (double)depth, predecessor});
+        if (is_marked(state.target, v))
+        {
+            remaining--;
+        }
+    };
+
+    for (u32 s : sources)
+    {
+        if (!is_marked(state.seen, s))
+        {
+            discover(s, invalid_index, 0);
+        }
+    }
+
+    // the reached gates double as the queue
+    for (u32 head = 0; head < state.reached.size(); ++head)
+    {
+        if (stop_at_targets && remaining == 0)
+        {
+            return;
+        }
+
+        u32 v     = state.reached[head];
+        u32 depth = state.labels[state.best[v]].depth;
+        if (depth >= max_depth || (depth > 0 && is_marked(m_stop, v)))
+        {
+            continue;
+        }
+
+        auto edges = forward ? m_snapshot->get_successors(v) : m_snapshot->get_predecessors(v);
+        for (const auto& e : edges)
+        {
+            if (!is_marked(state.seen, e.gate))
+            {
+                discover(e.gate, state.best[v], depth + 1);
+            }
+        }
+    }
+}
+
+void shortest_path_engine::run_dijkstra(search_state& state,
+                                        const std::vector<u32>& sources,
+                                        bool forward,
+                                        u32 max_depth,
+                                        const std::vector<u32>& targets,
+                                        const std::function<double(u32)>& heuristic) const
+{
+    u32 remaining;
+    if (!prepare(state, sources, targets, remaining))
+    {
+        return;
+    }
+    bool stop_at_targets = !targets.empty();
+    bool depth_limited   = (max_depth != unlimited);
+
+    // entries are (distance + heuristic, label). A label is dropped if another label of its gate is neither longer nor deeper.
+    // Without a depth limit that is the case for all but the first settled label of a gate, otherwise a gate is expanded
+    // again whenever it is settled with fewer edges, since only that can reach gates that were cut off by the limit.
+    using entry = std::pair<double, u32>;
+    std::priority_queue<entry, std::vector<entry>, std::greater<entry>> queue;
+
+    auto relax = [&](u32 v, u32 predecessor, double distance, u32 depth) {
+        if (!is_marked(state.seen, v))
+        {
+            mark(state.seen, v);
+            state.touched.push_back(v);
+            state.best[v] = state.labels.size();
+        }
+        else if (is_marked(state.settled, v))
+        {
+            if (!depth_limited || depth >= state.expanded_depth[v])
+            {
+                return;
+            }
+        }
+        else
+        {
+            const auto& best = state.labels[state.best[v]];
+            if (distance >= best.distance && (!depth_limited || depth >= best.depth))
+            {
+                return;
+            }
+            if (distance < best.distance)
+            {
+                state.best[v] = state.labels.size();
+            }
+        }
+        queue.emplace(distance + ((heuristic != nullptr) ? heuristic(v) : 0.0), state.labels.size());
+        state.labels.push_back({v, depth, distance, predecessor});
+    };
+
+    for (u32 s : sources)
+    {
+        if (!is_marked(state.seen, s))
+        {
+            relax(s, invalid_index, 0.0, 0);
+        }
+    }
+
+    while (!queue.empty())
+    {
+        u32 l = queue.top().second;
+        queue.pop();
+        auto [v, depth, distance, predecessor] = state.labels[l];
+        if (is_marked(state.settled, v))
+        {
+            if (!depth_limited || depth >= state.expanded_depth[v])
+            {
+                continue;
+            }
+        }
+        else
+        {
+            // the first settled label of a gate is its shortest path
+            mark(state.settled, v);
+            state.best[v] = l;
+            state.reached.push_back(v);
+
+            if (is_marked(state.target, v) && --remaining == 0 && stop_at_targets)
+            {
+                return;
+            }
+        }
+        state.expanded_depth[v] = depth;
+
+        if (depth >= max_depth || (depth > 0 && is_marked(m_stop, v)))
+        {
+            continue;
+        }
+
+        auto edges = forward ? m_snapshot->get_successors(v) : m_snapshot->get_predecessors(v);
+        for (const auto& e : edges)
+        {
+            relax(e.gate, l, distance + m_net_weights[e.net], depth + 1);
+        }
+    }
+}
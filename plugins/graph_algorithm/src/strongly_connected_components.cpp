@@ -5,97 +5,403 @@
 #include "netlist/gate.h"
 #include "netlist/net.h"
 #include "netlist/netlist.h"
+#include "netlist/netlist_graph_snapshot.h"
 
-#include <boost/graph/graphviz.hpp>
-#include <boost/graph/strong_components.hpp>
+#include <algorithm>
+#include <atomic>
 
-std::set<std::set<std::shared_ptr<gate>>> plugin_graph_algorithm::get_strongly_connected_components(std::shared_ptr<netlist> g, std::set<std::shared_ptr<gate>> gates)
+namespace
 {
-    if (g == nullptr)
+    /* marks vertices whose component has been found */
+    const u32 DONE = netlist_graph_snapshot::invalid_index;
+
+    /* colors of vertices that are not part of any partition */
+    const u32 EXCLUDED = netlist_graph_snapshot::invalid_index;
+    const u32 TRIMMED  = netlist_graph_snapshot::invalid_index - 1;
+
+    /* partitions below this size are handled by Tarjan's algorithm */
+    const u32 SEQUENTIAL_THRESHOLD = 1 << 14;
+
+    /* rounds of trimming vertices without incoming or outgoing edges */
+    const u32 TRIM_ROUNDS = 3;
+
+    /**
+     * Iterative variant of Tarjan's algorithm following Pearce's space-efficient formulation.
+     * Only the given vertices and the edges between vertices accepted by 'in_subgraph' are considered.
+     * 'rindex' has to be 0 for all of these vertices and is DONE for them afterwards.
+     */
+    template<typename F>
+    void find_components(const netlist_graph_snapshot& snapshot, const std::vector<u32>& vertices, const F& in_subgraph, std::vector<u32>& rindex, std::vector<std::vector<u32>>& components)
     {
-        log_error(this->get_name(), "{}", "parameter 'g' is nullptr");
-        return std::set<std::set<std::shared_ptr<gate>>>();
+        struct frame
+        {
+            u32 vertex;
+            u32 edge;
+            bool root;
+        };
+
+        std::vector<frame> call_stack;
+        std::vector<u32> component_stack;
+        u32 index = 1;
+
+        for (u32 start : vertices)
+        {
+            if (rindex[start] != 0)
+            {
+                continue;
+            }
+
+            rindex[start] = index++;
+            call_stack.push_back({start, 0, true});
+            while (!call_stack.empty())
+            {
+                auto& top       = call_stack.back();
+                auto successors = snapshot.get_successors(top.vertex);
+                if (top.edge < successors.size())
+                {
+                    u32 w = successors[top.edge++].gate;
+                    if (!in_subgraph(w))
+                    {
+                        continue;
+                    }
+                    if (rindex[w] == 0)
+                    {
+                        rindex[w] = index++;
+                        call_stack.push_back({w, 0, true});
+                    }
+                    else if (rindex[w] < rindex[top.vertex])
+                    {
+                        rindex[top.vertex] = rindex[w];
+                        top.root           = false;
+                    }
+                    continue;
+                }
+
+                u32 v     = top.vertex;
+                bool root = top.root;
+                call_stack.pop_back();
+
+                if (root)
+                {
+                    std::vector<u32> component = {v};
+                    while (!component_stack.empty() && rindex[v] <= rindex[component_stack.back()])
+                    {
+                        component.push_back(component_stack.back());
+                        rindex[component_stack.back()] = DONE;
+                        component_stack.pop_back();
+                    }
+                    rindex[v] = DONE;
+                    components.push_back(std::move(component));
+                }
+                else
+                {
+                    component_stack.push_back(v);
+                }
+
+                if (!call_stack.empty() && rindex[v] < rindex[call_stack.back().vertex])
+                {
+                    rindex[call_stack.back().vertex] = rindex[v];
+                    call_stack.back().root           = false;
+                }
+            }
+        }
     }
-    /* check validity of gates */
-    if (gates.empty())
+
+    /**
+     * Marks all vertices of color 'from' that are reachable from the pivot by color 'to'.
+     * Vertices of color 'meet' that are reached instead get color 'both'.
+     */
+    void color_reachable(const netlist_graph_snapshot& snapshot, std::vector<std::atomic<u32>>& colors, u32 pivot, bool forward, u32 from, u32 to, u32 meet, u32 both)
     {
-        gates = g->get_gates();
+        std::vector<u32> queue = {pivot};
+        for (u32 i = 0; i < queue.size(); ++i)
+        {
+            u32 v      = queue[i];
+            auto edges = forward ? snapshot.get_successors(v) : snapshot.get_predecessors(v);
+            for (const auto& e : edges)
+            {
+                u32 color = colors[e.gate].load(std::memory_order_relaxed);
+                if (color == from || (color == meet && meet != from))
+                {
+                    colors[e.gate].store((color == from) ? to : both, std::memory_order_relaxed);
+                    queue.push_back(e.gate);
+                }
+            }
+        }
     }
-    for (const auto& current_gate : gates)
+
+    /**
+     * Parallel forward-backward algorithm with trimming.
+     * The vertices reachable from a pivot in both directions form its component, the vertices reachable in only one or in
+     * neither direction form three partitions that cannot share a component and are processed independently.
+     */
+    void find_components_parallel(const netlist_graph_snapshot& snapshot, const std::vector<u32>& vertices, std::vector<std::vector<u32>>& components)
     {
-        if (current_gate != nullptr)
-            continue;
-        log_error(this->get_name(), "{}", "parameter 'gates' contains a nullptr");
-        return std::set<std::set<std::shared_ptr<gate>>>();
+        struct partition
+        {
+            std::vector<u32> vertices;
+            u32 color;
+        };
+
+        u32 num_gates = snapshot.get_num_of_gates();
+        std::vector<std::atomic<u32>> colors(num_gates);
+        std::vector<u32> rindex(num_gates, 0);
+        for (u32 v = 0; v < num_gates; ++v)
+        {
+            colors[v].store(EXCLUDED, std::memory_order_relaxed);
+        }
+        for (u32 v : vertices)
+        {
+            colors[v].store(0, std::memory_order_relaxed);
+        }
+
+        // vertices without incoming or outgoing edges inside the subgraph are components on their own
+        i32 num_vertices = vertices.size();
+        for (u32 round = 0; round < TRIM_ROUNDS; ++round)
+        {
+            bool trimmed = false;
+
+#pragma omp parallel reduction(|| : trimmed)
+            {
+                std::vector<std::vector<u32>> local_components;
+
+#pragma omp for schedule(dynamic, 1024)
+                for (i32 i = 0; i < num_vertices; ++i)
+                {
+                    u32 v = vertices[i];
+                    if (colors[v].load(std::memory_order_relaxed) != 0)
+                    {
+                        continue;
+                    }
+
+                    auto is_active = [&](const netlist_graph_snapshot::edge& e) { return e.gate != v && colors[e.gate].load(std::memory_order_relaxed) == 0; };
+                    auto successors   = snapshot.get_successors(v);
+                    auto predecessors = snapshot.get_predecessors(v);
+                    if (std::none_of(successors.begin(), successors.end(), is_active) || std::none_of(predecessors.begin(), predecessors.end(), is_active))
+                    {
+                        colors[v].store(TRIMMED, std::memory_order_relaxed);
+                        local_components.push_back({v});
+                        trimmed = true;
+                    }
+                }
+
+#pragma omp critical
+                std::move(local_components.begin(), local_components.end(), std::back_inserter(components));
+            }
+
+            if (!trimmed)
+            {
+                break;
+            }
+        }
+
+        std::vector<partition> current(1);
+        for (u32 v : vertices)
+        {
+            if (colors[v].load(std::memory_order_relaxed) == 0)
+            {
+                current[0].vertices.push_back(v);
+            }
+        }
+        current[0].color = 0;
+
+        std::atomic<u32> next_color(1);
+        while (!current.empty())
+        {
+            std::vector<partition> next;
+            i32 num_partitions = current.size();
+
+#pragma omp parallel
+            {
+                std::vector<partition> local_next;
+                std::vector<std::vector<u32>> local_components;
+
+#pragma omp for schedule(dynamic, 1)
+                for (i32 p = 0; p < num_partitions; ++p)
+                {
+                    auto& part = current[p];
+                    if (part.vertices.empty())
+                    {
+                        continue;
+                    }
+
+                    u32 color = part.color;
+                    if (part.vertices.size() < SEQUENTIAL_THRESHOLD)
+                    {
+                        find_components(
+                            snapshot, part.vertices, [&](u32 w) { return colors[w].load(std::memory_order_relaxed) == color; }, rindex, local_components);
+                        continue;
+                    }
+
+                    // the vertex with the most connections is likely to be part of a large component
+                    u32 pivot    = part.vertices[0];
+                    u32 max_size = 0;
+                    for (u32 v : part.vertices)
+                    {
+                        u32 size = snapshot.get_successors(v).size() + snapshot.get_predecessors(v).size();
+                        if (size > max_size)
+                        {
+                            max_size = size;
+                            pivot    = v;
+                        }
+                    }
+
+                    u32 fw_color   = next_color.fetch_add(3, std::memory_order_relaxed);
+                    u32 bw_color   = fw_color + 1;
+                    u32 both_color = fw_color + 2;
+
+                    colors[pivot].store(fw_color, std::memory_order_relaxed);
+                    color_reachable(snapshot, colors, pivot, true, color, fw_color, color, color);
+                    colors[pivot].store(both_color, std::memory_order_relaxed);
+                    color_reachable(snapshot, colors, pivot, false, color, bw_color, fw_color, both_color);
+
+                    std::vector<u32> component;
+                    partition fw_part{{}, fw_color}, bw_part{{}, bw_color}, rest_part{{}, color};
+                    for (u32 v : part.vertices)
+                    {
+                        u32 c = colors[v].load(std::memory_order_relaxed);
+                        if (c == both_color)
+                        {
+                            component.push_back(v);
+                        }
+                        else if (c == fw_color)
+                        {
+                            fw_part.vertices.push_back(v);
+                        }
+                        else if (c == bw_color)
+                        {
+                            bw_part.vertices.push_back(v);
+                        }
+                        else
+                        {
+                            rest_part.vertices.push_back(v);
+                        }
+                    }
+                    std::vector<u32>().swap(part.vertices);
+
+                    local_components.push_back(std::move(component));
+                    local_next.push_back(std::move(fw_part));
+                    local_next.push_back(std::move(bw_part));
+                    local_next.push_back(std::move(rest_part));
+                }
+
+#pragma omp critical
+                {
+                    std::move(local_components.begin(), local_components.end(), std::back_inserter(components));
+                    std::move(local_next.begin(), local_next.end(), std::back_inserter(next));
+                }
+            }
+
+            current = std::move(next);
+        }
     }
+}    // namespace
 
-    boost::adjacency_list<boost::vecS, boost::vecS, boost::directedS> boost_graph;
-    typedef boost::graph_traits<boost::adjacency_list<boost::vecS, boost::vecS, boost::directedS>>::vertex_descriptor vertex_t;
+std::vector<std::vector<u32>> plugin_graph_algorithm::get_strongly_connected_component_ids(std::shared_ptr<netlist> const nl, const std::vector<u32>& gate_ids, const bool parallel)
+{
+    if (nl == nullptr)
+    {
+        log_error(this->get_name(), "{}", "parameter 'nl' is nullptr");
+        return std::vector<std::vector<u32>>();
+    }
 
-    /* add ordered gates to directed boost graph */
-    std::set<u32> gate_ids;
-    for (const auto& current_gate : gates)
-        gate_ids.insert(current_gate->get_id());
+    auto snapshot = nl->get_graph_snapshot();
+    u32 num_gates = snapshot->get_num_of_gates();
 
-    std::map<u32, vertex_t> gate_id_to_vertex;
-    std::map<vertex_t, u32> vertex_id_to_gate_id;
-    u32 vertex_id_cnt = 0;
-    for (const auto& gate_id : gate_ids)
+    /* resolve the subgraph to dense gate indices */
+    std::vector<u32> vertices;
+    std::vector<bool> in_subgraph;
+    if (gate_ids.empty())
     {
-        auto vertex_descriptor                = boost::add_vertex(boost_graph);
-        gate_id_to_vertex[gate_id]            = vertex_descriptor;
-        vertex_id_to_gate_id[vertex_id_cnt++] = gate_id;
+        vertices.resize(num_gates);
+        for (u32 i = 0; i < num_gates; ++i)
+        {
+            vertices[i] = i;
+        }
+    }
+    else
+    {
+        in_subgraph.assign(num_gates, false);
+        vertices.reserve(gate_ids.size());
+        for (u32 id : gate_ids)
+        {
+            u32 index = snapshot->get_gate_index(nl->get_gate_by_id(id));
+            if (index == netlist_graph_snapshot::invalid_index)
+            {
+                log_error(this->get_name(), "gate with id {:08x} is not part of the netlist", id);
+                return std::vector<std::vector<u32>>();
+            }
+            if (!in_subgraph[index])
+            {
+                in_subgraph[index] = true;
+                vertices.push_back(index);
+            }
+        }
     }
 
-    /* add ordered edges to directed boost graph */
-    std::map<u32, std::shared_ptr<net>> ordered_nets;
-    for (const auto& current_gate : gates)
+    std::vector<std::vector<u32>> components;
+    if (parallel)
     {
-        for (const auto& net : current_gate->get_fan_out_nets())
-            ordered_nets[net->get_id()] = net;
+        find_components_parallel(*snapshot, vertices, components);
+    }
+    else
+    {
+        std::vector<u32> rindex(num_gates, 0);
+        if (in_subgraph.empty())
+        {
+            find_components(*snapshot, vertices, [](u32) { return true; }, rindex, components);
+        }
+        else
+        {
+            find_components(*snapshot, vertices, [&in_subgraph](u32 w) { return in_subgraph[w]; }, rindex, components);
+        }
     }
 
-    for (auto it_net : ordered_nets)
+    /* both algorithms produce the same order */
+    for (auto& component : components)
     {
-        auto src = it_net.second->get_src();
-        if (src.gate == nullptr)
-            continue;
+        for (auto& v : component)
+        {
+            v = snapshot->get_gate(v)->get_id();
+        }
+        std::sort(component.begin(), component.end());
+    }
+    std::sort(components.begin(), components.end(), [](const auto& a, const auto& b) { return a[0] < b[0]; });
 
-        std::set<u32> dst_ids;
-        for (auto dst : it_net.second->get_dsts())
-            dst_ids.insert(dst.gate->get_id());
+    return components;
+}
 
-        for (const auto& dst_id : dst_ids)
-            boost::add_edge(gate_id_to_vertex[src.gate->get_id()], gate_id_to_vertex[dst_id], boost_graph);
+std::set<std::set<std::shared_ptr<gate>>> plugin_graph_algorithm::get_strongly_connected_components(std::shared_ptr<netlist> g, std::set<std::shared_ptr<gate>> gates)
+{
+    if (g == nullptr)
+    {
+        log_error(this->get_name(), "{}", "parameter 'g' is nullptr");
+        return std::set<std::set<std::shared_ptr<gate>>>();
     }
 
-    /* initialize parameters for strong_components() */
-    std::vector<int> component(g->get_gates().size());
-    std::vector<int> discover_time(g->get_gates().size());
-    std::vector<boost::default_color_type> color(g->get_gates().size());
-    std::vector<vertex_t> root(g->get_gates().size());
-    int num = strong_components(boost_graph,
-                                make_iterator_property_map(component.begin(), boost::get(boost::vertex_index, boost_graph)),
-                                root_map(make_iterator_property_map(root.begin(), boost::get(boost::vertex_index, boost_graph)))
-                                    .color_map(make_iterator_property_map(color.begin(), boost::get(boost::vertex_index, boost_graph)))
-                                    .discover_time_map(make_iterator_property_map(discover_time.begin(), boost::get(boost::vertex_index, boost_graph))));
-    
-    log("SCC BOOST: {}", num);
-
-    /* post process boost result */
-    std::map<int, std::set<u32>> component_to_gate_ids;
-    for (std::vector<int>::size_type i = 0; i != component.size(); ++i)
-        component_to_gate_ids[component[i]].insert(vertex_id_to_gate_id[i]);
+    /* check validity of gates */
+    std::vector<u32> gate_ids;
+    gate_ids.reserve(gates.size());
+    for (const auto& current_gate : gates)
+    {
+        if (current_gate == nullptr)
+        {
+            log_error(this->get_name(), "{}", "parameter 'gates' contains a nullptr");
+            return std::set<std::set<std::shared_ptr<gate>>>();
+        }
+        gate_ids.push_back(current_gate->get_id());
+    }
 
     std::set<std::set<std::shared_ptr<gate>>> result;
-    for (auto it_component : component_to_gate_ids)
+    for (const auto& component : get_strongly_connected_component_ids(g, gate_ids))
     {
         std::set<std::shared_ptr<gate>> component_set;
-        for (const auto& gate_id : it_component.second)
-            component_set.insert(g->get_gate_by_id(gate_id));
-        if (!component_set.empty())
-            result.insert(component_set);
+        for (u32 id : component)
+        {
+            component_set.insert(g->get_gate_by_id(id));
+        }
+        result.insert(component_set);
     }
-    log_debug(this->get_name(), "found {} components in graph ", num);
+    log_debug(this->get_name(), "found {} components in graph ", result.size());
     return result;
 }
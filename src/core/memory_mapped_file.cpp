@@ -0,0 +1,129 @@
+#include "core/memory_mapped_file.h"
+#include "core/log.h"
+
+#ifdef _WIN32
+#include <fstream>
+#include <sstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+memory_mapped_file::memory_mapped_file()
+{
+    m_data = nullptr;
+    m_size = 0;
+}
+
+memory_mapped_file::~memory_mapped_file()
+{
+    if (m_data != nullptr)
+    {
+        this->unmap_file();
+    }
+}
+
+bool memory_mapped_file::map_file(const std::string& file_name)
+{
+    if (m_data != nullptr)
+    {
+        this->unmap_file();
+    }
+
+#ifdef _WIN32
+    std::ifstream ifs(file_name, std::ios::in | std::ios::binary);
+    if (!ifs.is_open())
+    {
+        log_error("core", "cannot open '{}'", file_name);
+        return false;
+    }
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    m_content = ss.str();
+    m_data    = m_content.data();
+    m_size    = m_content.size();
+#else
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        log_error("core", "cannot open '{}'", file_name);
+        return false;
+    }
+
+    struct stat file_stats;
+    if (fstat(fd, &file_stats) != 0)
+    {
+        log_error("core", "cannot determine the size of '{}'", file_name);
+        close(fd);
+        return false;
+    }
+    m_size = file_stats.st_size;
+
+    // an empty file cannot be mapped, its content is simply empty
+    if (m_size == 0)
+    {
+        m_data = "";
+    }
+    else
+    {
+        void* address = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            log_error("core", "cannot map '{}' into memory", file_name);
+            close(fd);
+            m_size = 0;
+            return false;
+        }
+        madvise(address, m_size, MADV_SEQUENTIAL);
+        m_data = static_cast<const char*>(address);
+    }
+
+    // the mapping stays valid after closing the file descriptor
+    close(fd);
+#endif
+
+    log_debug("core", "mapped file '{}' ({} bytes)", file_name, m_size);
+    m_file_name = file_name;
+    return true;
+}
+
+bool memory_mapped_file::unmap_file()
+{
+    if (m_data == nullptr)
+    {
+        log_error("core", "file '{}' already unmapped", m_file_name);
+        return false;
+    }
+
+#ifdef _WIN32
+    m_content.clear();
+    m_content.shrink_to_fit();
+#else
+    if (m_size != 0 && munmap(const_cast<char*>(m_data), m_size) != 0)
+    {
+        log_error("core", "cannot unmap file '{}'", m_file_name);
+        return false;
+    }
+#endif
+
+    log_debug("core", "unmapped file '{}'", m_file_name);
+    m_data = nullptr;
+    m_size = 0;
+    return true;
+}
+
+std::string memory_mapped_file::get_file_name() const
+{
+    return m_file_name;
+}
+
+std::string_view memory_mapped_file::get_data() const
+{
+    if (m_data == nullptr)
+    {
+        return std::string_view();
+    }
+    return std::string_view(m_data, m_size);
+}
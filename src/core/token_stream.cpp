@@ -1,37 +1,37 @@
 #include "core/token_stream.h"
-#include "core/utils.h"
 
-token::token(u32 n, const std::string s, bool cs) : number(n), string(s), case_sensitive(cs)
+#include <cctype>
+
+static bool equals_ignore_case(std::string_view a, std::string_view b)
 {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) { return std::tolower(x) == std::tolower(y); });
 }
 
-token::operator std::string() const
+token::token(u32 n, std::string_view s, bool cs) : number(n), string(s), case_sensitive(cs)
 {
-    return string;
 }
 
-token& token::operator=(const std::string& s)
+token::operator std::string() const
 {
-    this->string = s;
-    return *this;
+    return std::string(string);
 }
 
-token& token::operator+=(const std::string& s)
+token& token::operator=(std::string_view s)
 {
-    this->string += s;
+    this->string = s;
     return *this;
 }
 
-bool token::operator==(const std::string& s) const
+bool token::operator==(std::string_view s) const
 {
     if (!case_sensitive)
     {
-        return core_utils::equals_ignore_case(string, s);
+        return equals_ignore_case(string, s);
     }
     return string == s;
 }
 
-bool token::operator!=(const std::string& s) const
+bool token::operator!=(std::string_view s) const
 {
     return !(*this == s);
 }
@@ -39,43 +39,77 @@ bool token::operator!=(const std::string& s) const
 ///////////////////////////////////////
 ///////////////////////////////////////
 
-token_stream::token_stream(const std::vector<std::string>& increase_level_tokens, const std::vector<std::string>& decrease_level_tokens)
+token_stream::text_storage::text_storage()
 {
-    m_pos                   = 0;
-    m_increase_level_tokens = increase_level_tokens;
-    m_decrease_level_tokens = decrease_level_tokens;
+    m_current   = nullptr;
+    m_remaining = 0;
 }
 
-token_stream::token_stream(const token_stream& other)
+std::string_view token_stream::text_storage::store(std::string_view s)
 {
-    m_pos                   = other.m_pos;
-    m_data                  = other.m_data;
-    m_increase_level_tokens = other.m_increase_level_tokens;
-    m_decrease_level_tokens = other.m_decrease_level_tokens;
+    if (s.size() > m_remaining)
+    {
+        // strings that exceed the block size get a block of their own
+        u64 size = std::max((u64)BLOCK_SIZE, (u64)s.size());
+        m_blocks.push_back(std::make_unique<char[]>(size));
+        m_current   = m_blocks.back().get();
+        m_remaining = size;
+    }
+
+    std::copy(s.begin(), s.end(), m_current);
+    std::string_view result(m_current, s.size());
+    m_current += s.size();
+    m_remaining -= s.size();
+    return result;
+}
+
+///////////////////////////////////////
+///////////////////////////////////////
+
+token_stream::token_stream(const std::vector<std::string>& increase_level_tokens, const std::vector<std::string>& decrease_level_tokens)
+{
+    m_buffer                        = std::make_shared<shared_buffer>();
+    m_buffer->increase_level_tokens = increase_level_tokens;
+    m_buffer->decrease_level_tokens = decrease_level_tokens;
+    m_begin                         = 0;
+    m_end                           = 0;
+    m_pos                           = 0;
 }
 
 token_stream::token_stream(const std::vector<token>& init, const std::vector<std::string>& increase_level_tokens, const std::vector<std::string>& decrease_level_tokens)
     : token_stream(increase_level_tokens, decrease_level_tokens)
 {
-    m_data = init;
+    m_buffer->tokens = init;
+    m_end            = init.size();
+}
+
+token_stream::token_stream(std::vector<token>&& init,
+                           text_storage&& storage,
+                           const std::vector<std::string>& increase_level_tokens,
+                           const std::vector<std::string>& decrease_level_tokens)
+    : token_stream(increase_level_tokens, decrease_level_tokens)
+{
+    m_buffer->tokens  = std::move(init);
+    m_buffer->storage = std::move(storage);
+    m_end             = m_buffer->tokens.size();
 }
 
 token& token_stream::at(u32 position)
 {
-    if (position > m_data.size())
+    if (position >= size())
     {
         throw token_stream_exception({"reached the end of the stream", get_current_line_number()});
     }
-    return m_data[position];
+    return m_buffer->tokens[m_begin + position];
 }
 
 const token& token_stream::at(u32 position) const
 {
-    if (position > m_data.size())
+    if (position >= size())
     {
         throw token_stream_exception({"reached the end of the stream", get_current_line_number()});
     }
-    return m_data[position];
+    return m_buffer->tokens[m_begin + position];
 }
 
 token& token_stream::peek(i32 offset)
@@ -108,7 +142,7 @@ bool token_stream::consume(const std::string& expected, bool throw_on_error)
     {
         if (throw_on_error)
         {
-            throw token_stream_exception({"expected token '" + expected + "' but got '" + at(m_pos).string + "'", get_current_line_number()});
+            throw token_stream_exception({"expected token '" + expected + "' but got '" + std::string(at(m_pos).string) + "'", get_current_line_number()});
         }
         return false;
     }
@@ -130,7 +164,7 @@ token token_stream::consume_until(const std::string& match, u32 end, bool level_
 
 u32 token_stream::size() const
 {
-    return m_data.size();
+    return m_end - m_begin;
 }
 u32 token_stream::consumed() const
 {
@@ -150,22 +184,33 @@ void token_stream::set_position(u32 p)
     m_pos = p;
 }
 
+bool token_stream::is_increase_level_token(const token& t) const
+{
+    const auto& level_tokens = m_buffer->increase_level_tokens;
+    return std::find_if(level_tokens.begin(), level_tokens.end(), [&t](const auto& x) { return t == x; }) != level_tokens.end();
+}
+
+bool token_stream::is_decrease_level_token(const token& t) const
+{
+    const auto& level_tokens = m_buffer->decrease_level_tokens;
+    return std::find_if(level_tokens.begin(), level_tokens.end(), [&t](const auto& x) { return t == x; }) != level_tokens.end();
+}
+
 u32 token_stream::find_next(const std::string& match, u32 end, bool level_aware) const
 {
     u32 level = 0;
     for (u32 i = m_pos; i < size() && i < end; ++i)
     {
-        const auto& token = at(i);
-        if ((!level_aware || level == 0) && core_utils::equals_ignore_case(token, match))
+        const auto& token = m_buffer->tokens[m_begin + i];
+        if ((!level_aware || level == 0) && equals_ignore_case(token.string, match))
         {
             return i;
         }
-        else if (level_aware && std::find_if(m_increase_level_tokens.begin(), m_increase_level_tokens.end(), [&token](const auto& x) { return token == x; }) != m_increase_level_tokens.end())
+        else if (level_aware && is_increase_level_token(token))
         {
             level++;
         }
-        else if (level_aware && level > 0
-                 && std::find_if(m_decrease_level_tokens.begin(), m_decrease_level_tokens.end(), [&token](const auto& x) { return token == x; }) != m_decrease_level_tokens.end())
+        else if (level_aware && level > 0 && is_decrease_level_token(token))
         {
             level--;
         }
@@ -189,9 +234,9 @@ token token_stream::join_until(const std::string& match, const std::string& join
         {
             result += joiner;
         }
-        result += consume();
+        result += consume().string;
     }
-    return {start_line, result};
+    return {start_line, m_buffer->storage.store(result)};
 }
 
 token token_stream::join(const std::string& joiner)
@@ -204,9 +249,9 @@ token token_stream::join(const std::string& joiner)
         {
             result += joiner;
         }
-        result += consume();
+        result += consume().string;
     }
-    return {start_line, result};
+    return {start_line, m_buffer->storage.store(result)};
 }
 
 token_stream token_stream::extract_until(const std::string& match, u32 end, bool level_aware, bool throw_on_error)
@@ -217,21 +262,26 @@ token_stream token_stream::extract_until(const std::string& match, u32 end, bool
         throw token_stream_exception({"match token '" + match + "' not found", get_current_line_number()});
     }
     auto end_pos = std::min(size(), found);
-    token_stream res(m_increase_level_tokens, m_decrease_level_tokens);
-    res.m_data.insert(res.m_data.begin(), m_data.begin() + m_pos, m_data.begin() + end_pos);
+
+    // the extracted stream is a range of the shared tokens
+    token_stream res(*this);
+    res.m_begin = m_begin + m_pos;
+    res.m_end   = m_begin + end_pos;
+    res.m_pos   = 0;
+
     m_pos = end_pos;
     return res;
 }
 
 u32 token_stream::get_current_line_number() const
 {
-    if (m_pos < m_data.size())
+    if (m_pos < size())
     {
-        return m_data[m_pos].number;
+        return m_buffer->tokens[m_begin + m_pos].number;
     }
-    else if (!m_data.empty())
+    else if (size() > 0)
     {
-        return m_data.back().number;
+        return m_buffer->tokens[m_end - 1].number;
     }
     return END_OF_STREAM;
 }
@@ -224,6 +224,11 @@ void netlist_relay::relay_netlist_event(netlist_event_handler::event ev, std::sh
             ///< associated_data = id of net
             break;
         }
+        case netlist_event_handler::event::bulk_changes_committed:
+        {
+            ///< no associated_data
+            break;
+        }
     }
 }
 
@@ -0,0 +1,342 @@
+#include "netlist/bdd_manager.h"
+
+#include "core/log.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    // variable index of the terminal nodes, i.e., below all variables
+    const u32 TERMINAL_VAR = std::numeric_limits<u32>::max();
+}    // namespace
+
+bdd_manager::bdd_manager()
+{
+    m_nodes.push_back({TERMINAL_VAR, ZERO, ZERO});
+    m_nodes.push_back({TERMINAL_VAR, ONE, ONE});
+}
+
+bdd_manager::node bdd_manager::get_variable(const std::string& name)
+{
+    auto it = m_variable_indices.find(name);
+    if (it == m_variable_indices.end())
+    {
+        it = m_variable_indices.emplace(name, m_variables.size()).first;
+        m_variables.push_back(name);
+    }
+    return make_node(it->second, ZERO, ONE);
+}
+
+const std::vector<std::string>& bdd_manager::get_variables() const
+{
+    return m_variables;
+}
+
+u32 bdd_manager::get_num_nodes() const
+{
+    return m_nodes.size();
+}
+
+bdd_manager::node bdd_manager::make_node(u32 var, node low, node high)
+{
+    if (low == high)
+    {
+        return low;
+    }
+
+    auto key = std::make_tuple(var, low, high);
+    auto it  = m_unique_table.find(key);
+    if (it != m_unique_table.end())
+    {
+        return it->second;
+    }
+
+    node result = m_nodes.size();
+    m_nodes.push_back({var, low, high});
+    m_unique_table.emplace(key, result);
+    return result;
+}
+
+bdd_manager::node bdd_manager::cofactor(node f, u32 var, bool value) const
+{
+    const auto& entry = m_nodes[f];
+    if (entry.var != var)
+    {
+        return f;
+    }
+    return value ? entry.high : entry.low;
+}
+
+bdd_manager::node bdd_manager::ite(node f, node g, node h)
+{
+    // terminal cases
+    if (f == ONE)
+    {
+        return g;
+    }
+    if (f == ZERO)
+    {
+        return h;
+    }
+    if (g == h)
+    {
+        return g;
+    }
+    if (g == ONE && h == ZERO)
+    {
+        return f;
+    }
+
+    auto key = std::make_tuple(f, g, h);
+    auto it  = m_ite_cache.find(key);
+    if (it != m_ite_cache.end())
+    {
+        return it->second;
+    }
+
+    u32 var    = std::min({m_nodes[f].var, m_nodes[g].var, m_nodes[h].var});
+    node low   = ite(cofactor(f, var, false), cofactor(g, var, false), cofactor(h, var, false));
+    node high  = ite(cofactor(f, var, true), cofactor(g, var, true), cofactor(h, var, true));
+    node result = make_node(var, low, high);
+
+    if (m_ite_cache.size() >= m_cache_limit)
+    {
+        m_ite_cache.clear();
+    }
+    m_ite_cache.emplace(key, result);
+    return result;
+}
+
+bdd_manager::node bdd_manager::apply_and(node a, node b)
+{
+    return ite(a, b, ZERO);
+}
+
+bdd_manager::node bdd_manager::apply_or(node a, node b)
+{
+    return ite(a, ONE, b);
+}
+
+bdd_manager::node bdd_manager::apply_xor(node a, node b)
+{
+    return ite(a, negate(b), b);
+}
+
+bdd_manager::node bdd_manager::negate(node a)
+{
+    return ite(a, ZERO, ONE);
+}
+
+bdd_manager::node bdd_manager::restrict(node f, const std::string& name, bool value)
+{
+    auto it = m_variable_indices.find(name);
+    if (it == m_variable_indices.end())
+    {
+        return f;
+    }
+    std::unordered_map<node, node> cache;
+    return restrict_internal(f, it->second, value, cache);
+}
+
+bdd_manager::node bdd_manager::restrict_internal(node f, u32 var, bool value, std::unordered_map<node, node>& cache)
+{
+    // nodes below the variable cannot depend on it
+    if (m_nodes[f].var == TERMINAL_VAR || m_nodes[f].var > var)
+    {
+        return f;
+    }
+    if (m_nodes[f].var == var)
+    {
+        return value ? m_nodes[f].high : m_nodes[f].low;
+    }
+
+    auto it = cache.find(f);
+    if (it != cache.end())
+    {
+        return it->second;
+    }
+
+    auto entry  = m_nodes[f];
+    node result = make_node(entry.var, restrict_internal(entry.low, var, value, cache), restrict_internal(entry.high, var, value, cache));
+    cache.emplace(f, result);
+    return result;
+}
+
+bdd_manager::node bdd_manager::compose(node f, const std::string& name, node g)
+{
+    return ite(g, restrict(f, name, true), restrict(f, name, false));
+}
+
+bdd_manager::function bdd_manager::apply_and(const function& a, const function& b)
+{
+    // a known ZERO dominates, otherwise X dominates
+    node zeros    = apply_or(negate(apply_or(a.ones, a.unknowns)), negate(apply_or(b.ones, b.unknowns)));
+    node unknowns = apply_and(apply_or(a.unknowns, b.unknowns), negate(zeros));
+    return {apply_and(a.ones, b.ones), unknowns};
+}
+
+bdd_manager::function bdd_manager::apply_or(const function& a, const function& b)
+{
+    // a known ONE dominates, otherwise X dominates
+    node ones = apply_or(a.ones, b.ones);
+    return {ones, apply_and(apply_or(a.unknowns, b.unknowns), negate(ones))};
+}
+
+bdd_manager::function bdd_manager::apply_xor(const function& a, const function& b)
+{
+    // X dominates
+    node unknowns = apply_or(a.unknowns, b.unknowns);
+    return {apply_and(apply_xor(a.ones, b.ones), negate(unknowns)), unknowns};
+}
+
+bdd_manager::function bdd_manager::negate(const function& a)
+{
+    return {negate(apply_or(a.ones, a.unknowns)), a.unknowns};
+}
+
+bdd_manager::function bdd_manager::compose(const function& f, const std::string& name, const function& g)
+{
+    function f0 = {restrict(f.ones, name, false), restrict(f.unknowns, name, false)};
+    function f1 = {restrict(f.ones, name, true), restrict(f.unknowns, name, true)};
+
+    // where g is X, the result is only known if both cofactors agree on a known value
+    node agree    = apply_and(negate(apply_xor(f0.ones, f1.ones)), negate(apply_or(f0.unknowns, f1.unknowns)));
+    node ones     = ite(g.unknowns, apply_and(f0.ones, agree), ite(g.ones, f1.ones, f0.ones));
+    node unknowns = ite(g.unknowns, negate(agree), ite(g.ones, f1.unknowns, f0.unknowns));
+    return {ones, unknowns};
+}
+
+bdd_manager::function bdd_manager::from_boolean_function(const boolean_function& f)
+{
+    return from_boolean_function(f, {});
+}
+
+bdd_manager::function bdd_manager::from_boolean_function(const boolean_function& f, const std::unordered_map<std::string, function>& inputs)
+{
+    function result = {ZERO, ONE};
+    if (f.m_content == boolean_function::content_type::VARIABLE)
+    {
+        if (auto it = inputs.find(f.m_variable); it != inputs.end())
+        {
+            result = it->second;
+        }
+        else
+        {
+            result = {get_variable(f.m_variable), ZERO};
+        }
+    }
+    else if (f.m_content == boolean_function::content_type::CONSTANT)
+    {
+        if (f.m_constant == boolean_function::ONE)
+        {
+            result = {ONE, ZERO};
+        }
+        else if (f.m_constant == boolean_function::ZERO)
+        {
+            result = {ZERO, ZERO};
+        }
+    }
+    else if (!f.m_operands.empty())
+    {
+        result = from_boolean_function(f.m_operands[0], inputs);
+        for (u32 i = 1; i < f.m_operands.size(); ++i)
+        {
+            auto next = from_boolean_function(f.m_operands[i], inputs);
+            if (f.m_op == boolean_function::operation::AND)
+            {
+                result = apply_and(result, next);
+            }
+            else if (f.m_op == boolean_function::operation::OR)
+            {
+                result = apply_or(result, next);
+            }
+            else if (f.m_op == boolean_function::operation::XOR)
+            {
+                result = apply_xor(result, next);
+            }
+        }
+    }
+
+    if (f.m_invert)
+    {
+        return negate(result);
+    }
+    return result;
+}
+
+boolean_function bdd_manager::to_boolean_function(const function& f)
+{
+    std::unordered_map<u64, boolean_function> cache;
+    return to_boolean_function_internal(f.ones, f.unknowns, cache);
+}
+
+boolean_function bdd_manager::to_boolean_function_internal(node ones, node unknowns, std::unordered_map<u64, boolean_function>& cache)
+{
+    if (unknowns == ONE)
+    {
+        return boolean_function::X;
+    }
+    if (unknowns == ZERO && (ones == ZERO || ones == ONE))
+    {
+        return (ones == ONE) ? boolean_function::ONE : boolean_function::ZERO;
+    }
+
+    // shared nodes are expanded only once
+    u64 key = ((u64)ones << 32) | unknowns;
+    if (auto it = cache.find(key); it != cache.end())
+    {
+        return it->second;
+    }
+
+    // expand by the topmost variable of both diagrams
+    u32 var = std::min(m_nodes[ones].var, m_nodes[unknowns].var);
+    boolean_function v(m_variables[var]);
+    node ones_0 = cofactor(ones, var, false), unknowns_0 = cofactor(unknowns, var, false);
+    node ones_1 = cofactor(ones, var, true), unknowns_1 = cofactor(unknowns, var, true);
+    auto f0     = to_boolean_function_internal(ones_0, unknowns_0, cache);
+    auto f1     = to_boolean_function_internal(ones_1, unknowns_1, cache);
+
+    boolean_function result;
+    if (ones_0 == ZERO && unknowns_0 == ZERO)
+    {
+        result = v & f1;
+    }
+    else if (ones_1 == ZERO && unknowns_1 == ZERO)
+    {
+        result = (!v) & f0;
+    }
+    else if (ones_0 == ONE)
+    {
+        result = (!v) | f1;
+    }
+    else if (ones_1 == ONE)
+    {
+        result = v | f0;
+    }
+    else
+    {
+        result = ((!v) & f0) | (v & f1);
+    }
+    cache.emplace(key, result);
+    return result;
+}
+
+void bdd_manager::clear_cache()
+{
+    m_ite_cache.clear();
+}
+
+void bdd_manager::set_cache_limit(u32 max_entries)
+{
+    m_cache_limit = std::max(max_entries, 1u);
+    if (m_ite_cache.size() > m_cache_limit)
+    {
+        m_ite_cache.clear();
+    }
+}
+
+u32 bdd_manager::get_cache_size() const
+{
+    return m_ite_cache.size();
+}
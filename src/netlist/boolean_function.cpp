@@ -1,7 +1,19 @@
 #include "netlist/boolean_function.h"
+#include "netlist/bdd_manager.h"
+#include "netlist/compiled_boolean_function.h"
+#include "netlist/truth_table.h"
 
+#include "core/log.h"
 #include "core/utils.h"
 
+#include <bitset>
+#include <cctype>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <string_view>
+
 std::string boolean_function::to_string(const operation& op)
 {
     switch (op)
@@ -237,273 +249,282 @@ std::set<std::string> boolean_function::get_variables() const
     return {};
 }
 
-boolean_function boolean_function::from_string(std::string expression, const std::vector<std::string>& variable_names)
+namespace
 {
-    auto sorted_variable_names = variable_names;
-    std::sort(sorted_variable_names.begin(), sorted_variable_names.end(), [](const auto& a, const auto& b) { return a.size() > b.size(); });
+    // a node of the parse tree, all nodes of an expression live in a single vector
+    struct parse_node
+    {
+        enum class type
+        {
+            EMPTY,
+            CONSTANT,
+            VARIABLE,
+            AND,
+            OR,
+            XOR
+        } node_type = type::EMPTY;
+        boolean_function::value constant = boolean_function::X;
+        std::string_view name;
+        bool negated     = false;
+        i32 first_child  = -1;
+        i32 next_sibling = -1;
+    };
 
-    for (u32 i = 0; i < sorted_variable_names.size(); ++i)
+    // single-pass recursive descent parser, only the nesting of brackets leads to recursion
+    class expression_parser
     {
-        auto pos = expression.find(sorted_variable_names[i]);
-        if (pos != std::string::npos)
+    public:
+        expression_parser(std::string_view expression, const std::vector<std::string>& variable_names, std::vector<parse_node>& nodes)
+            : m_expression(expression), m_variable_names(variable_names), m_nodes(nodes)
         {
-            expression.replace(pos, sorted_variable_names[i].size(), "__v_" + std::to_string(i));
         }
-    }
 
-    return from_string_internal(expression, sorted_variable_names);
-}
+        // returns the index of the root node or -1 on a bracket mismatch
+        i32 parse()
+        {
+            i32 root = parse_or();
+            if (m_error || m_pos < m_expression.size())
+            {
+                return -1;
+            }
+            return root;
+        }
 
-boolean_function boolean_function::from_string_internal(std::string expression, const std::vector<std::string>& variable_names)
-{
-    expression = core_utils::trim(expression);
+    private:
+        std::string_view m_expression;
+        const std::vector<std::string>& m_variable_names;
+        std::vector<parse_node>& m_nodes;
+        u32 m_pos    = 0;
+        bool m_error = false;
 
-    if (expression.empty())
-    {
-        return boolean_function();
-    }
+        static bool is_space(char c)
+        {
+            return std::isspace(static_cast<unsigned char>(c));
+        }
 
-    const std::string delimiters = "!^&|'+* ";
+        static bool is_delimiter(char c)
+        {
+            return is_space(c) || c == '!' || c == '^' || c == '&' || c == '|' || c == '\'' || c == '+' || c == '*' || c == '(' || c == ')';
+        }
 
-    // check for constants
-    if (expression == "0")
-    {
-        return boolean_function(ZERO);
-    }
-    else if (expression == "1")
-    {
-        return boolean_function(ONE);
-    }
-    else if (expression == "X")
-    {
-        return boolean_function(X);
-    }
-    else
-    {
-        // check for variable
-        bool is_term = false;
-        for (const auto& d : delimiters + "()")
+        // returns the next character that is not a space or 0 at the end of the expression
+        char peek()
         {
-            if (expression.find(d) != std::string::npos)
+            while (m_pos < m_expression.size() && is_space(m_expression[m_pos]))
             {
-                is_term = true;
-                break;
+                m_pos++;
             }
+            return (m_pos < m_expression.size()) ? m_expression[m_pos] : 0;
         }
-        if (!is_term)
+
+        i32 add_node(parse_node::type t)
+        {
+            m_nodes.emplace_back();
+            m_nodes.back().node_type = t;
+            return m_nodes.size() - 1;
+        }
+
+        // collects the operands of an operation as children of a single node
+        template<typename Operand, typename IsOperator>
+        i32 parse_operation(parse_node::type t, Operand parse_operand, IsOperator is_operator)
         {
-            if (core_utils::starts_with(expression, "__v_"))
+            i32 first = parse_operand();
+            if (!is_operator(peek()))
             {
-                u32 idx    = std::stoul(expression.substr(4));
-                expression = variable_names[idx];
+                return first;
             }
 
-            return boolean_function(expression);
+            i32 result                  = add_node(t);
+            m_nodes[result].first_child = first;
+            i32 last                    = first;
+            do
+            {
+                i32 next                   = parse_operand();
+                m_nodes[last].next_sibling = next;
+                last                       = next;
+            } while (is_operator(peek()));
+            return result;
         }
-    }
 
-    // simple bracket check
-    i32 level = 0;
-    for (const auto& c : expression)
-    {
-        if (c == '(')
+        i32 parse_or()
         {
-            level += 1;
+            return parse_operation(
+                parse_node::type::OR, [this] { return parse_xor(); }, [this](char c) {
+                    if (c == '|' || c == '+')
+                    {
+                        m_pos++;
+                        return true;
+                    }
+                    return false;
+                });
         }
-        else if (c == ')')
+
+        i32 parse_xor()
         {
-            level -= 1;
-            if (level < 0)
-            {
-                return value::X;
-            }
+            return parse_operation(
+                parse_node::type::XOR, [this] { return parse_and(); }, [this](char c) {
+                    if (c == '^')
+                    {
+                        m_pos++;
+                        return true;
+                    }
+                    return false;
+                });
         }
-    }
-    if (level != 0)
-    {
-        return value::X;
-    }
 
-    // parse expression
-    std::vector<std::string> terms;
-    {
-        std::string current_term;
-        u32 bracket_level = 0;
-        for (u32 i = 0; i < expression.size(); i++)
+        i32 parse_and()
         {
-            if (expression[i] == '(')
-            {
-                // if this is a top-level term, store everything before the bracket
-                if (bracket_level == 0)
-                {
-                    current_term = core_utils::trim(current_term);
-                    if (!current_term.empty())
+            return parse_operation(
+                parse_node::type::AND, [this] { return parse_unary(); }, [this](char c) {
+                    if (c == '&' || c == '*')
                     {
-                        terms.push_back(current_term);
-                        current_term.clear();
+                        m_pos++;
+                        return true;
                     }
-                }
+                    // juxtaposed terms are implicitly combined by AND
+                    return c != 0 && c != ')' && c != '^' && c != '|' && c != '+';
+                });
+        }
 
-                bracket_level++;
+        i32 parse_unary()
+        {
+            bool negated = false;
+            while (peek() == '!')
+            {
+                negated = !negated;
+                m_pos++;
             }
 
-            if (bracket_level == 0 && delimiters.find(expression[i]) != std::string::npos)
+            i32 result = parse_atom();
+
+            while (peek() == '\'')
             {
-                // not in brackets and there was a delimiter -> save term and operation
-                current_term = core_utils::trim(current_term);
-                if (!current_term.empty())
-                {
-                    terms.push_back(current_term);
-                    current_term.clear();
-                }
-                if (expression[i] != ' ')
+                negated = !negated;
+                m_pos++;
+            }
+
+            m_nodes[result].negated ^= negated;
+            return result;
+        }
+
+        i32 parse_atom()
+        {
+            char c = peek();
+            if (c == '(')
+            {
+                m_pos++;
+                i32 result = parse_or();
+                if (peek() != ')')
                 {
-                    terms.push_back(std::string(1, expression[i]));
+                    m_error = true;
                 }
+                m_pos++;
+                return result;
             }
-            else
+            if (c == 0 || is_delimiter(c))
             {
-                // no special conditions -> char is term of current term
-                current_term += expression[i];
+                // missing operand, e.g., in "A & | B"
+                return add_node(parse_node::type::EMPTY);
             }
 
-            if (expression[i] == ')')
-            {
-                bracket_level--;
+            std::string_view remaining = m_expression.substr(m_pos);
 
-                if (bracket_level == 0)
+            // known variable names take precedence over the tokenization
+            for (const auto& name : m_variable_names)
+            {
+                if (remaining.substr(0, name.size()) == name && (remaining.size() == name.size() || is_delimiter(remaining[name.size()])))
                 {
-                    // if we are back at top-level, store everything that was in the brackets
-                    current_term = core_utils::trim(current_term);
-                    if (!current_term.empty())
-                    {
-                        terms.push_back(current_term);
-                        current_term.clear();
-                    }
+                    m_pos += name.size();
+                    i32 result           = add_node(parse_node::type::VARIABLE);
+                    m_nodes[result].name = name;
+                    return result;
                 }
             }
-        }
-        current_term = core_utils::trim(current_term);
-        if (!current_term.empty())
-        {
-            terms.push_back(current_term);
-        }
-    }
 
-    // process terms
-    if (terms.size() == 1)
-    {
-        // only a single term but not filtered before?
-        // -> was of the form "(...)" so remove the outer brackets and repeat
-        return from_string_internal(terms[0].substr(1, terms[0].size() - 2), variable_names);
-    }
+            u32 length = 0;
+            while (length < remaining.size() && !is_delimiter(remaining[length]))
+            {
+                length++;
+            }
+            m_pos += length;
 
-    // small mutable datastructure for parsing
-    struct op_term
-    {
-        operation op;
-        boolean_function term;
+            std::string_view token = remaining.substr(0, length);
+            if (token == "0" || token == "1" || token == "X")
+            {
+                i32 result               = add_node(parse_node::type::CONSTANT);
+                m_nodes[result].constant = (token == "0") ? boolean_function::ZERO : ((token == "1") ? boolean_function::ONE : boolean_function::X);
+                return result;
+            }
+
+            i32 result           = add_node(parse_node::type::VARIABLE);
+            m_nodes[result].name = token;
+            return result;
+        }
     };
-    std::vector<op_term> parsed_terms;
+}    // namespace
+
+boolean_function boolean_function::from_string(std::string expression, const std::vector<std::string>& variable_names)
+{
+    auto sorted_variable_names = variable_names;
+    std::sort(sorted_variable_names.begin(), sorted_variable_names.end(), [](const auto& a, const auto& b) { return a.size() > b.size(); });
+    sorted_variable_names.erase(std::remove(sorted_variable_names.begin(), sorted_variable_names.end(), ""), sorted_variable_names.end());
 
-    bool negate_next  = false;
-    operation next_op = operation::AND;
+    std::vector<parse_node> nodes;
+    nodes.reserve(expression.size() / 2 + 1);
 
+    i32 root = expression_parser(expression, sorted_variable_names, nodes).parse();
+    if (root < 0)
     {
-        // multiple terms available -> initialize return value with first term
-        u32 i = 0;
-        while (terms[i] == "!")
+        return value::X;
+    }
+
+    // operands of the same operation are merged, just like the operators do when combining functions
+    std::function<boolean_function(i32)> build = [&](i32 index) -> boolean_function {
+        const parse_node& node = nodes[index];
+        boolean_function result;
+        if (node.node_type == parse_node::type::CONSTANT)
         {
-            negate_next = !negate_next;
-            ++i;
+            result = boolean_function(node.constant);
         }
-        boolean_function first_term = from_string_internal(terms[i], variable_names);
-        while (i + 1 < terms.size() && terms[i + 1] == "'")
+        else if (node.node_type == parse_node::type::VARIABLE)
         {
-            negate_next = !negate_next;
-            ++i;
+            result = boolean_function(std::string(node.name));
         }
-        if (negate_next)
+        else if (node.node_type != parse_node::type::EMPTY)
         {
-            first_term  = !first_term;
-            negate_next = false;
-        }
-
-        parsed_terms.push_back({operation::AND, first_term});
+            operation op = (node.node_type == parse_node::type::AND) ? operation::AND : ((node.node_type == parse_node::type::OR) ? operation::OR : operation::XOR);
 
-        // process the remaining terms
-        while (++i < terms.size())
-        {
-            if (terms[i] == "!")
+            std::vector<boolean_function> operands;
+            for (i32 child = node.first_child; child >= 0; child = nodes[child].next_sibling)
             {
-                negate_next = !negate_next;
-            }
-            else if (terms[i] == "&" || terms[i] == "*")
-            {
-                next_op = operation::AND;
-            }
-            else if (terms[i] == "|" || terms[i] == "+")
-            {
-                next_op = operation::OR;
-            }
-            else if (terms[i] == "^")
-            {
-                next_op = operation::XOR;
-            }
-            else
-            {
-                auto next_term = from_string_internal(terms[i], variable_names);
-                while (i + 1 < terms.size() && terms[i + 1] == "'")
+                auto operand = build(child);
+                if (operand.is_empty())
                 {
-                    negate_next = !negate_next;
-                    ++i;
+                    continue;
                 }
-                if (negate_next)
+                if (operand.m_content == content_type::TERMS && operand.m_op == op && !operand.m_invert)
                 {
-                    next_term = !next_term;
+                    operands.insert(operands.end(), operand.m_operands.begin(), operand.m_operands.end());
+                }
+                else
+                {
+                    operands.push_back(std::move(operand));
                 }
-
-                parsed_terms.push_back({next_op, next_term});
-
-                negate_next = false;
-                next_op     = operation::AND;
             }
-        }
-    }
-
-    // assemble terms in order of operator precedence
-
-    for (u32 i = 1; i < parsed_terms.size(); ++i)
-    {
-        if (parsed_terms[i].op == operation::AND)
-        {
-            parsed_terms[i - 1].term = parsed_terms[i - 1].term & parsed_terms[i].term;
-            parsed_terms.erase(parsed_terms.begin() + i);
-            --i;
-        }
-    }
-
-    for (u32 i = 1; i < parsed_terms.size(); ++i)
-    {
-        if (parsed_terms[i].op == operation::XOR)
-        {
-            parsed_terms[i - 1].term = parsed_terms[i - 1].term ^ parsed_terms[i].term;
-            parsed_terms.erase(parsed_terms.begin() + i);
-            --i;
-        }
-    }
 
-    for (u32 i = 1; i < parsed_terms.size(); ++i)
-    {
-        if (parsed_terms[i].op == operation::OR)
-        {
-            parsed_terms[i - 1].term = parsed_terms[i - 1].term | parsed_terms[i].term;
-            parsed_terms.erase(parsed_terms.begin() + i);
-            --i;
+            if (operands.size() == 1)
+            {
+                result = operands[0];
+            }
+            else if (operands.size() > 1)
+            {
+                result = boolean_function(op, operands);
+            }
         }
-    }
+        return node.negated ? !result : result;
+    };
 
-    return parsed_terms[0].term;
+    return build(root);
 }
 
 std::string boolean_function::to_string() const
@@ -638,12 +659,38 @@ boolean_function boolean_function::operator!() const
 
 bool boolean_function::operator==(const boolean_function& other) const
 {
-    if (m_content != other.m_content)
-        return false;
-    if (m_invert != other.m_invert)
+    // structurally equal functions are equal in any case
+    if (m_content == other.m_content && m_invert == other.m_invert)
+    {
+        if ((m_content == content_type::VARIABLE && m_variable == other.m_variable) || (m_content == content_type::CONSTANT && m_constant == other.m_constant)
+            || (m_content == content_type::TERMS && m_op == other.m_op && m_operands == other.m_operands))
+        {
+            return true;
+        }
+    }
+
+    // an empty function only equals another empty function
+    if (is_empty() || other.is_empty())
+    {
         return false;
-    return (m_content == content_type::VARIABLE && m_variable == other.m_variable) || (m_content == content_type::CONSTANT && m_constant == other.m_constant)
-           || (m_content == content_type::TERMS && m_op == other.m_op && m_operands == other.m_operands);
+    }
+
+    auto variables       = get_variables();
+    auto other_variables = other.get_variables();
+    variables.insert(other_variables.begin(), other_variables.end());
+    if (variables.size() > truth_table::MAX_VARIABLES)
+    {
+        // canonical diagrams do not grow with the number of input assignments
+        bdd_manager manager;
+        for (const auto& var : variables)
+        {
+            manager.get_variable(var);
+        }
+        return manager.from_boolean_function(*this) == manager.from_boolean_function(other);
+    }
+
+    std::vector<std::string> ordered_variables(variables.begin(), variables.end());
+    return to_truth_table(ordered_variables) == other.to_truth_table(ordered_variables);
 }
 bool boolean_function::operator!=(const boolean_function& other) const
 {
@@ -1052,6 +1099,11 @@ std::vector<boolean_function::value> boolean_function::get_truth_table(const std
         variables.insert(variables.end(), unique_vars.begin(), unique_vars.end());
     }
 
+    if (variables.size() <= truth_table::MAX_VARIABLES)
+    {
+        return to_truth_table(variables).to_vector();
+    }
+
     for (u32 values = 0; values < (u32)(1 << variables.size()); ++values)
     {
         std::map<std::string, boolean_function::value> inputs;
@@ -1066,6 +1118,563 @@ std::vector<boolean_function::value> boolean_function::get_truth_table(const std
     return result;
 }
 
+truth_table boolean_function::to_truth_table(const std::vector<std::string>& ordered_variables) const
+{
+    if (ordered_variables.size() > truth_table::MAX_VARIABLES)
+    {
+        log_error("netlist", "truth tables support at most {} variables, {} given.", truth_table::MAX_VARIABLES, ordered_variables.size());
+        return truth_table(0, X);
+    }
+
+    std::map<std::string, u32> variable_indices;
+    for (u32 i = 0; i < ordered_variables.size(); ++i)
+    {
+        variable_indices[ordered_variables[i]] = i;
+    }
+    return to_truth_table_internal(variable_indices, ordered_variables.size());
+}
+
+truth_table boolean_function::to_truth_table_internal(const std::map<std::string, u32>& variable_indices, u32 num_variables) const
+{
+    truth_table result(num_variables, X);
+    if (m_content == content_type::VARIABLE)
+    {
+        auto it = variable_indices.find(m_variable);
+        if (it != variable_indices.end())
+        {
+            result = truth_table::variable(num_variables, it->second);
+        }
+    }
+    else if (m_content == content_type::CONSTANT)
+    {
+        result = truth_table(num_variables, m_constant);
+    }
+    else if (!m_operands.empty())
+    {
+        result = m_operands[0].to_truth_table_internal(variable_indices, num_variables);
+        for (u32 i = 1; i < m_operands.size(); ++i)
+        {
+            auto next = m_operands[i].to_truth_table_internal(variable_indices, num_variables);
+            if (m_op == operation::AND)
+            {
+                result &= next;
+            }
+            else if (m_op == operation::OR)
+            {
+                result |= next;
+            }
+            else if (m_op == operation::XOR)
+            {
+                result ^= next;
+            }
+        }
+    }
+
+    if (m_invert)
+    {
+        return !result;
+    }
+    return result;
+}
+
+boolean_function boolean_function::from_truth_table(const truth_table& table, const std::vector<std::string>& variables)
+{
+    if (variables.size() != table.get_num_variables())
+    {
+        log_error("netlist", "truth table has {} variables but {} names were given.", table.get_num_variables(), variables.size());
+        return boolean_function();
+    }
+    return from_truth_table_internal(table, variables, variables.size());
+}
+
+boolean_function boolean_function::from_truth_table_internal(const truth_table& table, const std::vector<std::string>& variables, u32 num_remaining)
+{
+    for (auto constant : {ZERO, ONE, X})
+    {
+        if (table.is_constant(constant))
+        {
+            return constant;
+        }
+    }
+
+    // expand the table by the last remaining variable it depends on
+    u32 index = num_remaining - 1;
+    while (!table.depends_on(index))
+    {
+        index--;
+    }
+
+    boolean_function var(variables[index]);
+    auto negative = table.cofactor(index, false);
+    auto positive = table.cofactor(index, true);
+    auto f0       = from_truth_table_internal(negative, variables, index);
+    auto f1       = from_truth_table_internal(positive, variables, index);
+
+    if (negative.is_constant(ZERO))
+    {
+        return var & f1;
+    }
+    if (positive.is_constant(ZERO))
+    {
+        return (!var) & f0;
+    }
+    if (negative.is_constant(ONE))
+    {
+        return (!var) | f1;
+    }
+    if (positive.is_constant(ONE))
+    {
+        return var | f0;
+    }
+    return ((!var) & f0) | (var & f1);
+}
+
+compiled_boolean_function boolean_function::compile(const std::vector<std::string>& var_order) const
+{
+    return compiled_boolean_function(*this, var_order);
+}
+
+namespace
+{
+    // functions with up to this many variables are minimized exactly from all of their prime implicants, larger ones heuristically
+    const u32 EXACT_MINIMIZATION_THRESHOLD = 8;
+
+    // maximum number of branches of the exact cover search, the best cover found so far is used once it is exhausted
+    const u64 EXACT_COVER_SEARCH_BUDGET = 1 << 16;
+
+    // minimized covers are shared between identical truth tables of all netlists, e.g., LUTs with the same configuration,
+    // since optimize() has no netlist to scope them to
+    const u64 MINIMIZATION_CACHE_BYTES = 16 << 20;
+
+    // the cover selection falls back to all candidates if the cover matrix would hold more entries
+    const u64 MAX_COVER_MATRIX_ENTRIES = 1 << 22;
+
+    // a product term, variable i occurs if bit i of mask is set and is negated if bit i of polarity is cleared
+    struct cube
+    {
+        u32 mask;
+        u32 polarity;
+    };
+
+    truth_table get_cube_table(const cube& c, const std::vector<truth_table>& variable_tables)
+    {
+        truth_table result(variable_tables.size(), boolean_function::ONE);
+        for (u32 i = 0; i < variable_tables.size(); ++i)
+        {
+            if ((c.mask >> i) & 1)
+            {
+                result &= ((c.polarity >> i) & 1) ? variable_tables[i] : !variable_tables[i];
+            }
+        }
+        return result;
+    }
+
+    // expands a minterm of the ON-set to a prime implicant by removing literals as long as it does not hit the OFF-set
+    cube expand(u32 minterm, const truth_table& off_set, const std::vector<truth_table>& variable_tables)
+    {
+        u32 num_variables = variable_tables.size();
+        cube c            = {(1u << num_variables) - 1, minterm};
+        for (u32 i = 0; i < num_variables; ++i)
+        {
+            cube candidate = {c.mask & ~(1u << i), c.polarity & ~(1u << i)};
+            if ((get_cube_table(candidate, variable_tables) & off_set).is_constant(boolean_function::ZERO))
+            {
+                c = candidate;
+            }
+        }
+        return c;
+    }
+
+    // generates all prime implicants by merging cubes that differ in a single literal
+    std::vector<cube> get_prime_implicants(const truth_table& on_set)
+    {
+        u32 num_variables = on_set.get_num_variables();
+        std::vector<cube> implicants;
+        for (u32 i = 0; i < on_set.size(); ++i)
+        {
+            if (on_set.get_value(i) == boolean_function::ONE)
+            {
+                implicants.push_back({(1u << num_variables) - 1, i});
+            }
+        }
+
+        auto less  = [](const cube& a, const cube& b) { return a.mask < b.mask || (a.mask == b.mask && a.polarity < b.polarity); };
+        auto equal = [](const cube& a, const cube& b) { return a.mask == b.mask && a.polarity == b.polarity; };
+
+        std::vector<cube> primes;
+        while (!implicants.empty())
+        {
+            std::vector<cube> merged;
+            std::vector<bool> used(implicants.size(), false);
+            for (u32 i = 0; i < implicants.size(); ++i)
+            {
+                for (u32 j = i + 1; j < implicants.size(); ++j)
+                {
+                    u32 difference = implicants[i].polarity ^ implicants[j].polarity;
+                    if (implicants[i].mask == implicants[j].mask && (difference & (difference - 1)) == 0)
+                    {
+                        merged.push_back({implicants[i].mask & ~difference, implicants[i].polarity & ~difference});
+                        used[i] = used[j] = true;
+                    }
+                }
+            }
+            for (u32 i = 0; i < implicants.size(); ++i)
+            {
+                if (!used[i])
+                {
+                    primes.push_back(implicants[i]);
+                }
+            }
+            std::sort(merged.begin(), merged.end(), less);
+            merged.erase(std::unique(merged.begin(), merged.end(), equal), merged.end());
+            implicants = merged;
+        }
+        return primes;
+    }
+
+    // enumerates the minterms of a cube, all of them are part of the ON-set since candidates never hit the OFF-set
+    template<typename F>
+    void for_each_minterm(const cube& c, u32 num_variables, F f)
+    {
+        u32 free_variables = ~c.mask & ((1u << num_variables) - 1);
+        u32 base           = c.polarity & c.mask;
+        u32 subset         = 0;
+        do
+        {
+            f(base | subset);
+            subset = (subset - free_variables) & free_variables;
+        } while (subset != 0);
+    }
+
+    // branch and bound search for a cover with the fewest cubes and, among those, the fewest literals
+    class exact_cover_search
+    {
+    public:
+        exact_cover_search(const std::vector<cube>& candidates, const std::vector<std::vector<u32>>& minterms, const std::vector<bool>& uncovered)
+            : m_candidates(candidates), m_minterms(minterms), m_covering(uncovered.size()), m_times_covered(uncovered.size(), 1), m_excluded(candidates.size(), false),
+              m_stamps(candidates.size(), 0)
+        {
+            for (u32 m = 0; m < uncovered.size(); ++m)
+            {
+                if (uncovered[m])
+                {
+                    m_times_covered[m] = 0;
+                    m_open.push_back(m);
+                }
+            }
+            for (u32 i = 0; i < candidates.size(); ++i)
+            {
+                for (u32 m : minterms[i])
+                {
+                    m_covering[m].push_back(i);
+                }
+            }
+        }
+
+        // improves upon the given cover of the open minterms
+        std::vector<u32> run(const std::vector<u32>& initial)
+        {
+            m_best      = initial;
+            m_best_cost = 0;
+            for (u32 i : initial)
+            {
+                m_best_cost += get_cost(i);
+            }
+            m_budget = EXACT_COVER_SEARCH_BUDGET;
+            search();
+            return m_best;
+        }
+
+    private:
+        // a cube costs more than all literals of any cover, so the number of cubes is minimized first
+        static constexpr u64 CUBE_COST = 1 << 16;
+
+        u64 get_cost(u32 i) const
+        {
+            return CUBE_COST + std::bitset<32>(m_candidates[i].mask).count();
+        }
+
+        void search()
+        {
+            if (m_budget == 0)
+            {
+                return;
+            }
+            --m_budget;
+
+            // branch on the open minterm with the fewest candidates, minterms without shared candidates bound the remaining cubes
+            u32 branch_minterm = 0;
+            u32 fewest         = std::numeric_limits<u32>::max();
+            u64 lower_bound    = 0;
+            ++m_epoch;
+            for (u32 m : m_open)
+            {
+                if (m_times_covered[m] != 0)
+                {
+                    continue;
+                }
+                u32 count       = 0;
+                bool independent = true;
+                for (u32 i : m_covering[m])
+                {
+                    if (!m_excluded[i])
+                    {
+                        ++count;
+                        independent &= (m_stamps[i] != m_epoch);
+                    }
+                }
+                if (count < fewest)
+                {
+                    fewest         = count;
+                    branch_minterm = m;
+                }
+                if (independent)
+                {
+                    lower_bound += CUBE_COST;
+                    for (u32 i : m_covering[m])
+                    {
+                        m_stamps[i] = m_epoch;
+                    }
+                }
+            }
+
+            if (fewest == std::numeric_limits<u32>::max())
+            {
+                if (m_cost < m_best_cost)
+                {
+                    m_best      = m_current;
+                    m_best_cost = m_cost;
+                }
+                return;
+            }
+            if (fewest == 0 || m_cost + lower_bound >= m_best_cost)
+            {
+                return;
+            }
+
+            std::vector<std::pair<u32, u32>> branches;
+            for (u32 i : m_covering[branch_minterm])
+            {
+                if (!m_excluded[i])
+                {
+                    branches.emplace_back(std::count_if(m_minterms[i].begin(), m_minterms[i].end(), [&](u32 m) { return m_times_covered[m] == 0; }), i);
+                }
+            }
+            std::sort(branches.begin(), branches.end(), [](const auto& a, const auto& b) { return a.first > b.first || (a.first == b.first && a.second < b.second); });
+
+            // once all covers with a candidate have been searched, the remaining branches exclude it
+            for (const auto& branch : branches)
+            {
+                select(branch.second, true);
+                search();
+                select(branch.second, false);
+                m_excluded[branch.second] = true;
+            }
+            for (const auto& branch : branches)
+            {
+                m_excluded[branch.second] = false;
+            }
+        }
+
+        void select(u32 i, bool selected)
+        {
+            if (selected)
+            {
+                for (u32 m : m_minterms[i])
+                {
+                    m_times_covered[m]++;
+                }
+                m_current.push_back(i);
+                m_cost += get_cost(i);
+            }
+            else
+            {
+                for (u32 m : m_minterms[i])
+                {
+                    m_times_covered[m]--;
+                }
+                m_current.pop_back();
+                m_cost -= get_cost(i);
+            }
+        }
+
+        const std::vector<cube>& m_candidates;
+        const std::vector<std::vector<u32>>& m_minterms;
+        std::vector<std::vector<u32>> m_covering;
+        std::vector<u32> m_open;
+        std::vector<u32> m_times_covered;
+        std::vector<bool> m_excluded;
+        std::vector<u32> m_stamps;
+        u32 m_epoch = 0;
+
+        std::vector<u32> m_current;
+        u64 m_cost = 0;
+        std::vector<u32> m_best;
+        u64 m_best_cost = 0;
+        u64 m_budget    = 0;
+    };
+
+    // selects the essential cubes first and then the cubes that cover the remaining ON-set, exactly or greedily by their number of covered minterms
+    std::vector<cube> select_cover(const std::vector<cube>& candidates, const truth_table& on_set, bool exact)
+    {
+        u32 num_variables = on_set.get_num_variables();
+
+        u64 num_entries = 0;
+        for (const auto& c : candidates)
+        {
+            num_entries += 1ull << (num_variables - std::bitset<32>(c.mask).count());
+        }
+        if (num_entries > MAX_COVER_MATRIX_ENTRIES)
+        {
+            return candidates;
+        }
+
+        // cover matrix: the minterms of each candidate and the number of candidates that cover each minterm
+        std::vector<std::vector<u32>> minterms(candidates.size());
+        std::vector<u32> num_covering(on_set.size(), 0);
+        for (u32 i = 0; i < candidates.size(); ++i)
+        {
+            for_each_minterm(candidates[i], num_variables, [&](u32 m) {
+                minterms[i].push_back(m);
+                num_covering[m]++;
+            });
+        }
+
+        std::vector<cube> result;
+        std::vector<bool> uncovered(on_set.size(), false);
+        for (u32 i = 0; i < on_set.size(); ++i)
+        {
+            uncovered[i] = (num_covering[i] > 0);
+        }
+        auto select = [&](u32 i) {
+            result.push_back(candidates[i]);
+            for (u32 m : minterms[i])
+            {
+                uncovered[m] = false;
+            }
+        };
+
+        std::vector<bool> selected(candidates.size(), false);
+        for (u32 i = 0; i < candidates.size(); ++i)
+        {
+            if (std::any_of(minterms[i].begin(), minterms[i].end(), [&](u32 m) { return num_covering[m] == 1; }))
+            {
+                selected[i] = true;
+                select(i);
+            }
+        }
+
+        // the greedy cover of the minterms left by the essential cubes is the initial bound of the exact search
+        std::vector<bool> remaining = uncovered;
+        std::vector<u32> greedy;
+
+        // lazy greedy: the number of uncovered minterms of a cube only decreases, so a cube whose recounted value is still
+        // the largest in the queue is the best one
+        auto worse = [](const std::pair<u32, u32>& a, const std::pair<u32, u32>& b) { return a.first < b.first || (a.first == b.first && a.second > b.second); };
+        std::priority_queue<std::pair<u32, u32>, std::vector<std::pair<u32, u32>>, decltype(worse)> queue(worse);
+        for (u32 i = 0; i < candidates.size(); ++i)
+        {
+            if (!selected[i])
+            {
+                queue.emplace(minterms[i].size(), i);
+            }
+        }
+        while (!queue.empty())
+        {
+            auto [count, i] = queue.top();
+            queue.pop();
+            u32 current = std::count_if(minterms[i].begin(), minterms[i].end(), [&](u32 m) { return uncovered[m]; });
+            if (current == 0)
+            {
+                continue;
+            }
+            if (current < count)
+            {
+                queue.emplace(current, i);
+                continue;
+            }
+            greedy.push_back(i);
+            select(i);
+        }
+
+        if (exact && !greedy.empty())
+        {
+            result.resize(result.size() - greedy.size());
+            for (u32 i : exact_cover_search(candidates, minterms, remaining).run(greedy))
+            {
+                result.push_back(candidates[i]);
+            }
+        }
+        return result;
+    }
+
+    // computes a small sum of products for a truth table without X outputs
+    std::vector<cube> minimize(const truth_table& on_set)
+    {
+        u32 num_variables = on_set.get_num_variables();
+        std::vector<truth_table> variable_tables;
+        for (u32 i = 0; i < num_variables; ++i)
+        {
+            variable_tables.push_back(truth_table::variable(num_variables, i));
+        }
+
+        std::vector<cube> candidates;
+        if (num_variables <= EXACT_MINIMIZATION_THRESHOLD)
+        {
+            candidates = get_prime_implicants(on_set);
+        }
+        else
+        {
+            // Espresso-style: expand uncovered minterms to primes, the cover selection then drops redundant ones
+            truth_table off_set = !on_set;
+            truth_table covered(num_variables);
+            for (u32 i = 0; i < on_set.size(); ++i)
+            {
+                if (on_set.get_value(i) == boolean_function::ONE && covered.get_value(i) == boolean_function::ZERO)
+                {
+                    candidates.push_back(expand(i, off_set, variable_tables));
+                    covered |= get_cube_table(candidates.back(), variable_tables);
+                }
+            }
+        }
+        return select_cover(candidates, on_set, num_variables <= EXACT_MINIMIZATION_THRESHOLD);
+    }
+
+    std::vector<cube> minimize_cached(const truth_table& on_set)
+    {
+        static std::mutex cache_mutex;
+        static std::map<std::pair<u32, std::vector<u64>>, std::vector<cube>> cache;
+        static u64 cache_bytes = 0;
+
+        auto key = std::make_pair(on_set.get_num_variables(), on_set.get_ones());
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            auto it = cache.find(key);
+            if (it != cache.end())
+            {
+                return it->second;
+            }
+        }
+
+        auto result = minimize(on_set);
+
+        // the cache is bounded by the size of its truth tables and covers rather than by the number of entries
+        u64 entry_bytes = sizeof(key) + key.second.size() * sizeof(u64) + sizeof(result) + result.size() * sizeof(cube);
+
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        if (cache_bytes + entry_bytes > MINIMIZATION_CACHE_BYTES)
+        {
+            cache.clear();
+            cache_bytes = 0;
+        }
+        if (cache.emplace(key, result).second)
+        {
+            cache_bytes += entry_bytes;
+        }
+        return result;
+    }
+}    // namespace
+
 boolean_function boolean_function::optimize() const
 {
     if (m_content != content_type::TERMS)
@@ -1073,6 +1682,36 @@ boolean_function boolean_function::optimize() const
         return *this;
     }
 
+    auto vars_set = get_variables();
+    std::vector<std::string> vars(vars_set.begin(), vars_set.end());
+
+    // two-valued functions of few variables are minimized on their truth table
+    if (vars.size() <= truth_table::MAX_VARIABLES)
+    {
+        auto table = to_truth_table(vars);
+        if (table.is_constant(ZERO) || table.is_constant(ONE))
+        {
+            return table.get_value(0);
+        }
+        if (std::all_of(table.get_unknowns().begin(), table.get_unknowns().end(), [](u64 w) { return w == 0; }))
+        {
+            boolean_function result;
+            for (const auto& c : minimize_cached(table))
+            {
+                boolean_function tmp;
+                for (u32 i = 0; i < vars.size(); ++i)
+                {
+                    if ((c.mask >> i) & 1)
+                    {
+                        tmp &= ((c.polarity >> i) & 1) ? boolean_function(vars[i]) : !boolean_function(vars[i]);
+                    }
+                }
+                result |= tmp;
+            }
+            return result;
+        }
+    }
+
     boolean_function result = to_dnf().propagate_negations().optimize_constants();
 
     if (result.m_content != content_type::TERMS || result.m_op == operation::AND)
@@ -1082,8 +1721,6 @@ boolean_function boolean_function::optimize() const
 
     // result is a OR-chain of *multiple* AND-chains of *only variables*
     std::vector<std::vector<value>> terms;
-    auto vars_set = get_variables();
-    std::vector<std::string> vars(vars_set.begin(), vars_set.end());
     for (const auto& or_term : result.m_operands)
     {
         std::vector<value> term(vars.size(), value::X);
@@ -0,0 +1,181 @@
+#include "netlist/compiled_boolean_function.h"
+
+#include "core/log.h"
+
+namespace
+{
+    // stack entries up to this depth are kept on the call stack during evaluation
+    const u32 LOCAL_STACK_SIZE = 64;
+}    // namespace
+
+compiled_boolean_function::compiled_boolean_function()
+{
+    m_num_variables = 0;
+    m_max_depth     = 0;
+    emit(opcode::CONSTANT, (u32)boolean_function::X, 1);
+}
+
+compiled_boolean_function::compiled_boolean_function(const boolean_function& function, const std::vector<std::string>& var_order)
+{
+    m_num_variables = var_order.size();
+    m_max_depth     = 0;
+
+    std::map<std::string, u32> variable_indices;
+    for (u32 i = 0; i < var_order.size(); ++i)
+    {
+        variable_indices[var_order[i]] = i;
+    }
+    compile(function, variable_indices, 0);
+}
+
+void compiled_boolean_function::compile(const boolean_function& function, const std::map<std::string, u32>& variable_indices, u32 depth)
+{
+    if (function.m_content == boolean_function::content_type::VARIABLE)
+    {
+        auto it = variable_indices.find(function.m_variable);
+        if (it != variable_indices.end())
+        {
+            emit(opcode::VARIABLE, it->second, depth + 1);
+        }
+        else
+        {
+            emit(opcode::CONSTANT, (u32)boolean_function::X, depth + 1);
+        }
+    }
+    else if (function.m_content == boolean_function::content_type::CONSTANT)
+    {
+        emit(opcode::CONSTANT, (u32)function.m_constant, depth + 1);
+    }
+    else if (function.m_operands.empty())
+    {
+        emit(opcode::CONSTANT, (u32)boolean_function::X, depth + 1);
+    }
+    else
+    {
+        opcode op = opcode::AND;
+        if (function.m_op == boolean_function::operation::OR)
+        {
+            op = opcode::OR;
+        }
+        else if (function.m_op == boolean_function::operation::XOR)
+        {
+            op = opcode::XOR;
+        }
+
+        // operands are folded into the first one as soon as they are computed, so the stack stays shallow
+        compile(function.m_operands[0], variable_indices, depth);
+        for (u32 i = 1; i < function.m_operands.size(); ++i)
+        {
+            compile(function.m_operands[i], variable_indices, depth + 1);
+            emit(op, 0, depth + 1);
+        }
+    }
+
+    if (function.m_invert)
+    {
+        emit(opcode::NOT, 0, depth + 1);
+    }
+}
+
+void compiled_boolean_function::emit(opcode op, u32 operand, u32 depth)
+{
+    m_program.push_back({op, operand});
+    m_max_depth = std::max(m_max_depth, depth);
+}
+
+u32 compiled_boolean_function::get_num_variables() const
+{
+    return m_num_variables;
+}
+
+template<typename Load>
+std::pair<u64, u64> compiled_boolean_function::run(const Load& load) const
+{
+    // deep programs use a per-thread buffer that is kept across calls, so evaluation never allocates in the steady state
+    thread_local std::vector<u64> deep_stack;
+
+    u64 local_ones[LOCAL_STACK_SIZE];
+    u64 local_unknowns[LOCAL_STACK_SIZE];
+    u64* stack_ones     = local_ones;
+    u64* stack_unknowns = local_unknowns;
+    if (m_max_depth > LOCAL_STACK_SIZE)
+    {
+        if (deep_stack.size() < 2 * m_max_depth)
+        {
+            deep_stack.resize(2 * m_max_depth);
+        }
+        stack_ones     = deep_stack.data();
+        stack_unknowns = deep_stack.data() + m_max_depth;
+    }
+
+    // the stack holds the bit planes of intermediate results, the X plane always masks the ONE plane
+    u32 top = 0;
+    for (const auto& inst : m_program)
+    {
+        switch (inst.op)
+        {
+            case opcode::VARIABLE:
+            {
+                auto [ones, unknowns] = load(inst.operand);
+                stack_unknowns[top]   = unknowns;
+                stack_ones[top]       = ones & ~unknowns;
+                top++;
+                break;
+            }
+            case opcode::CONSTANT:
+                stack_ones[top]     = (inst.operand == (u32)boolean_function::ONE) ? ~0ull : 0ull;
+                stack_unknowns[top] = (inst.operand == (u32)boolean_function::X) ? ~0ull : 0ull;
+                top++;
+                break;
+            case opcode::AND:
+            {
+                top--;
+                u64 zeros                 = ~(stack_ones[top - 1] | stack_unknowns[top - 1]) | ~(stack_ones[top] | stack_unknowns[top]);
+                stack_unknowns[top - 1]   = (stack_unknowns[top - 1] | stack_unknowns[top]) & ~zeros;
+                stack_ones[top - 1]       = stack_ones[top - 1] & stack_ones[top];
+                break;
+            }
+            case opcode::OR:
+                top--;
+                stack_ones[top - 1]     = stack_ones[top - 1] | stack_ones[top];
+                stack_unknowns[top - 1] = (stack_unknowns[top - 1] | stack_unknowns[top]) & ~stack_ones[top - 1];
+                break;
+            case opcode::XOR:
+                top--;
+                stack_unknowns[top - 1] = stack_unknowns[top - 1] | stack_unknowns[top];
+                stack_ones[top - 1]     = (stack_ones[top - 1] ^ stack_ones[top]) & ~stack_unknowns[top - 1];
+                break;
+            case opcode::NOT:
+                stack_ones[top - 1] = ~(stack_ones[top - 1] | stack_unknowns[top - 1]);
+                break;
+        }
+    }
+    return {stack_ones[0], stack_unknowns[0]};
+}
+
+boolean_function::value compiled_boolean_function::evaluate(const std::vector<boolean_function::value>& inputs) const
+{
+    if (inputs.size() < m_num_variables)
+    {
+        log_error("netlist", "compiled function expects {} inputs, {} given.", m_num_variables, inputs.size());
+        return boolean_function::X;
+    }
+
+    auto [out_ones, out_unknowns] = run([&inputs](u32 i) -> std::pair<u64, u64> { return {inputs[i] == boolean_function::ONE, inputs[i] == boolean_function::X}; });
+    if (out_unknowns & 1)
+    {
+        return boolean_function::X;
+    }
+    return (out_ones & 1) ? boolean_function::ONE : boolean_function::ZERO;
+}
+
+std::pair<u64, u64> compiled_boolean_function::evaluate_bitsliced(const std::vector<u64>& ones, const std::vector<u64>& unknowns) const
+{
+    if (ones.size() < m_num_variables || unknowns.size() < m_num_variables)
+    {
+        log_error("netlist", "compiled function expects {} inputs, {} given.", m_num_variables, std::min(ones.size(), unknowns.size()));
+        return {0, ~0ull};
+    }
+
+    return run([&ones, &unknowns](u32 i) -> std::pair<u64, u64> { return {ones[i], unknowns[i]}; });
+}
@@ -11,7 +11,7 @@ bool data_container::set_data(const std::string& category, const std::string& ke
 
     m_data[std::make_tuple(category, key)] = std::make_tuple(value_data_type, value);
 
-    //notify_updated();
+    notify_updated();
 
     if (log_with_info_level)
     {
@@ -43,7 +43,7 @@ bool data_container::delete_data(const std::string& category, const std::string&
     auto deleted_value = std::get<1>(it->second);
     m_data.erase(it);
 
-    //notify_updated();
+    notify_updated();
 
     if (log_with_info_level)
     {
@@ -0,0 +1,36 @@
+#include "netlist/endpoint.h"
+
+#include <mutex>
+#include <ostream>
+#include <unordered_set>
+
+const std::string& interned_pin_type::str() const
+{
+    static const std::string empty_pin_type;
+
+    if (m_type == nullptr)
+    {
+        return empty_pin_type;
+    }
+    return *m_type;
+}
+
+const std::string* interned_pin_type::intern(const std::string& type)
+{
+    // node based container, hence the addresses of the stored names remain stable
+    static std::unordered_set<std::string> pool;
+    static std::mutex pool_mutex;
+
+    if (type.empty())
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    return &(*pool.insert(type).first);
+}
+
+std::ostream& operator<<(std::ostream& os, const interned_pin_type& type)
+{
+    return os << type.str();
+}
@@ -146,6 +146,10 @@ namespace event_log
                 auto net = netlist->get_net_by_id(associated_data);
                 log_info("event", "unmarked net '{}' (id {:08x}) as a global inout net in netlist with id {:08x}", net->get_name(), net->get_id(), netlist->get_id());
             }
+            else if (event == netlist_event_handler::event::bulk_changes_committed)
+            {
+                log_info("event", "committed bulk changes to netlist with id {:08x}", netlist->get_id());
+            }
             else
             {
                 log_error("event", "unknown netlist event");
@@ -4,6 +4,7 @@
 #include "netlist/module.h"
 #include "netlist/net.h"
 #include "netlist/netlist.h"
+#include "netlist/truth_table.h"
 
 #include "netlist/event_system/gate_event_handler.h"
 
@@ -11,6 +12,7 @@
 
 #include <assert.h>
 #include <iomanip>
+#include <shared_mutex>
 #include <sstream>
 
 gate::gate(std::shared_ptr<netlist> const g, const u32 id, std::shared_ptr<const gate_type> gt, const std::string& name, float x, float y)
@@ -22,6 +24,9 @@ gate::gate(std::shared_ptr<netlist> const g, const u32 id, std::shared_ptr<const
     m_name    = name;
     m_x       = x;
     m_y       = y;
+
+    m_in_nets.resize(gt->get_input_pins().size());
+    m_out_nets.resize(gt->get_output_pins().size());
 }
 
 u32 gate::get_id() const
@@ -165,55 +170,89 @@ std::unordered_map<std::string, boolean_function> gate::get_boolean_functions(bo
 
 boolean_function gate::get_lut_function() const
 {
+    // gates may be evaluated concurrently, so the cached functions are only read and written under the netlist's lock
+    auto& mutex = m_netlist->m_lut_function_mutex;
+    u64 version;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        if (m_lut_function != nullptr)
+        {
+            return *m_lut_function;
+        }
+        version = m_lut_config_version;
+    }
+
     auto lut_type = std::static_pointer_cast<const gate_type_lut>(m_type);
 
     std::string category   = lut_type->get_config_data_category();
     std::string key        = lut_type->get_config_data_identifier();
     std::string config_str = std::get<1>(get_data_by_key(category, key));
 
+    std::shared_ptr<const boolean_function> function;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto type_it = m_netlist->m_lut_function_cache.find(m_type.get());
+        if (type_it != m_netlist->m_lut_function_cache.end())
+        {
+            auto it = type_it->second.find(config_str);
+            if (it != type_it->second.end())
+            {
+                function = it->second;
+            }
+        }
+    }
+
+    // the function is minimized without holding the lock, if another thread was faster its result is used
+    if (function == nullptr)
+    {
+        function = std::make_shared<const boolean_function>(compute_lut_function(config_str));
+    }
+
+    // the configuration may have changed since it was read, then the function is returned but not stored for this gate
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    function = m_netlist->m_lut_function_cache[m_type.get()].emplace(config_str, function).first->second;
+    if (version == m_lut_config_version)
+    {
+        m_lut_function = function;
+    }
+    return *function;
+}
+
+boolean_function gate::compute_lut_function(const std::string& config_str) const
+{
+    auto lut_type = std::static_pointer_cast<const gate_type_lut>(m_type);
+
     if (config_str.empty())
     {
         return boolean_function::ZERO;
     }
-    u64 config      = std::stoull(config_str, nullptr, 16);
-    u32 config_size = 1 << get_input_pins().size();
-
-    boolean_function result;
+    auto input_pins = get_input_pins();
+    if (input_pins.size() > truth_table::MAX_VARIABLES)
+    {
+        log_error("netlist", "LUT gate '{}' has too many inputs for its function to be computed.", get_name());
+        return boolean_function::X;
+    }
 
-    for (u32 i = 0; config != 0; i++)
+    // in ascending order the most significant configuration bit belongs to the first input assignment
+    auto table = truth_table::from_hex_string(input_pins.size(), config_str);
+    if (lut_type->is_config_data_ascending_order())
     {
-        u8 bit;
-        if (lut_type->is_config_data_ascending_order())
-        {
-            bit = (config >> (config_size - 1)) & 1;
-            config <<= 1;
-        }
-        else
-        {
-            bit = (config & 1);
-            config >>= 1;
-        }
-        if (bit == 1)
-        {
-            boolean_function clause;
-            auto input_values = i;
-            for (auto input : get_input_pins())
-            {
-                if ((input_values & 1) == 1)
-                {
-                    clause &= boolean_function(input);
-                }
-                else
-                {
-                    clause &= !boolean_function(input);
-                }
-                input_values >>= 1;
-            }
-            result |= clause;
-        }
+        table = table.reverse();
     }
 
-    return result.optimize();
+    // identical configurations share the minimized function
+    return boolean_function::from_truth_table(table, input_pins).optimize();
+}
+
+void gate::notify_updated()
+{
+    if (m_type->get_base_type() != gate_type::base_type::lut)
+    {
+        return;
+    }
+    std::unique_lock<std::shared_mutex> lock(m_netlist->m_lut_function_mutex);
+    m_lut_config_version++;
+    m_lut_function.reset();
 }
 
 void gate::add_boolean_function(const std::string& name, const boolean_function& func)
@@ -223,31 +262,32 @@ void gate::add_boolean_function(const std::string& name, const boolean_function&
         auto output_pins = m_type->get_output_pins();
         if (!output_pins.empty() && name == output_pins[0])
         {
-            auto lut_type = std::static_pointer_cast<const gate_type_lut>(m_type);
-            auto tt       = func.get_truth_table(get_input_pins());
-
-            u64 config_value = 0;
-            if (lut_type->is_config_data_ascending_order())
+            auto lut_type   = std::static_pointer_cast<const gate_type_lut>(m_type);
+            auto input_pins = get_input_pins();
+            if (input_pins.size() > truth_table::MAX_VARIABLES)
             {
-                std::reverse(tt.begin(), tt.end());
+                log_error("netlist", "LUT gate '{}' has too many inputs for its configuration to be computed.", get_name());
+                return;
             }
-            for (auto v : tt)
+
+            auto table = func.to_truth_table(input_pins);
+            for (auto word : table.get_unknowns())
             {
-                if (v == boolean_function::X)
+                if (word != 0)
                 {
                     log_error("netlist", "function truth table contained undefined values");
                     return;
                 }
-                config_value <<= 1;
-                config_value |= v;
+            }
+            if (lut_type->is_config_data_ascending_order())
+            {
+                table = table.reverse();
             }
 
             std::string category = lut_type->get_config_data_category();
             std::string key      = lut_type->get_config_data_identifier();
 
-            std::stringstream stream;
-            stream << std::hex << config_value;
-            set_data(category, key, "bit_vector", stream.str());
+            set_data(category, key, "bit_vector", table.to_hex_string());
 
             return;
         }
@@ -300,9 +340,12 @@ std::set<std::shared_ptr<net>> gate::get_fan_in_nets() const
 {
     std::set<std::shared_ptr<net>> nets;
 
-    for (const auto& it : m_in_nets)
+    for (const auto& n : m_in_nets)
     {
-        nets.insert(it.second);
+        if (n != nullptr)
+        {
+            nets.insert(n);
+        }
     }
 
     return nets;
@@ -310,24 +353,27 @@ std::set<std::shared_ptr<net>> gate::get_fan_in_nets() const
 
 std::shared_ptr<net> gate::get_fan_in_net(const std::string& pin_type) const
 {
-    auto it = m_in_nets.find(pin_type);
+    auto index = m_type->get_input_pin_index(pin_type);
 
-    if (it == m_in_nets.end())
+    if (index >= m_in_nets.size() || m_in_nets[index] == nullptr)
     {
         log_debug("netlist.internal", "gate ('{},  type = {}) has no net connected to input pin '{}'.", get_name(), get_type()->get_name(), pin_type);
         return nullptr;
     }
 
-    return it->second;
+    return m_in_nets[index];
 }
 
 std::set<std::shared_ptr<net>> gate::get_fan_out_nets() const
 {
     std::set<std::shared_ptr<net>> nets;
 
-    for (const auto& it : m_out_nets)
+    for (const auto& n : m_out_nets)
     {
-        nets.insert(it.second);
+        if (n != nullptr)
+        {
+            nets.insert(n);
+        }
     }
 
     return nets;
@@ -335,15 +381,15 @@ std::set<std::shared_ptr<net>> gate::get_fan_out_nets() const
 
 std::shared_ptr<net> gate::get_fan_out_net(const std::string& pin_type) const
 {
-    auto it = m_out_nets.find(pin_type);
+    auto index = m_type->get_output_pin_index(pin_type);
 
-    if (it == m_out_nets.end())
+    if (index >= m_out_nets.size() || m_out_nets[index] == nullptr)
     {
         log_debug("netlist.internal", "gate ('{},  type = {}) has no net connected to output pin '{}'.", get_name(), get_type()->get_name(), pin_type);
         return nullptr;
     }
 
-    return it->second;
+    return m_out_nets[index];
 }
 
 std::set<endpoint> gate::get_unique_predecessors(const std::function<bool(const std::string& starting_pin, const endpoint&)>& filter) const
@@ -355,11 +401,15 @@ std::set<endpoint> gate::get_unique_predecessors(const std::function<bool(const
 std::vector<endpoint> gate::get_predecessors(const std::function<bool(const std::string& starting_pin, const endpoint&)>& filter) const
 {
     std::vector<endpoint> result;
-    for (const auto& it : m_in_nets)
+    for (u32 i : m_type->get_input_pin_order())
     {
-        auto& net = it.second;
-        auto& pin = it.first;
-        auto pred = net->get_src();
+        if (i >= m_in_nets.size() || m_in_nets[i] == nullptr)
+        {
+            continue;
+        }
+        auto& net        = m_in_nets[i];
+        auto& pin        = m_type->get_input_pin(i);
+        const auto& pred = net->m_src;
         if (pred.gate == nullptr)
         {
             log_debug("netlist", "predecessor on pin '{}' of gate '{}' (id = {:08x}) is unrouted.", pin, this->get_name(), this->get_id());
@@ -399,11 +449,15 @@ std::set<endpoint> gate::get_unique_successors(const std::function<bool(const st
 std::vector<endpoint> gate::get_successors(const std::function<bool(const std::string& starting_pin, const endpoint&)>& filter) const
 {
     std::vector<endpoint> result;
-    for (const auto& it : m_out_nets)
+    for (u32 i : m_type->get_output_pin_order())
     {
-        auto& pin       = it.first;
-        auto& net       = it.second;
-        auto successors = net->get_dsts();
+        if (i >= m_out_nets.size() || m_out_nets[i] == nullptr)
+        {
+            continue;
+        }
+        auto& net              = m_out_nets[i];
+        auto& pin              = m_type->get_output_pin(i);
+        const auto& successors = net->m_dsts;
         if (!filter)
         {
             result.insert(result.end(), successors.begin(), successors.end());
@@ -52,7 +52,9 @@ bool gate_library_parser_liberty::tokenize()
     bool in_string          = false;
     bool multi_line_comment = false;
 
+    // lines are read into a temporary string, so all tokens are copied to the storage of the stream
     std::vector<token> parsed_tokens;
+    token_stream::text_storage storage;
 
     while (std::getline(m_fs, line))
     {
@@ -80,24 +82,24 @@ bool gate_library_parser_liberty::tokenize()
             {
                 if (!current_token.empty())
                 {
-                    parsed_tokens.emplace_back(line_number, current_token);
+                    parsed_tokens.emplace_back(line_number, storage.store(current_token));
                     current_token.clear();
                 }
 
                 if (!std::isspace(c))
                 {
-                    parsed_tokens.emplace_back(line_number, std::string(1, c));
+                    parsed_tokens.emplace_back(line_number, storage.store(std::string(1, c)));
                 }
             }
         }
         if (!current_token.empty())
         {
-            parsed_tokens.emplace_back(line_number, current_token);
+            parsed_tokens.emplace_back(line_number, storage.store(current_token));
             current_token.clear();
         }
     }
 
-    m_token_stream = token_stream(parsed_tokens, {"(", "{"}, {")", "}"});
+    m_token_stream = token_stream(std::move(parsed_tokens), std::move(storage), {"(", "{"}, {")", "}"});
     return true;
 }
 
@@ -108,7 +110,7 @@ bool gate_library_parser_liberty::parse_tokens()
     auto lib_name = m_token_stream.consume();
     m_token_stream.consume(")", true);
     m_token_stream.consume("{", true);
-    m_gate_lib          = std::make_shared<gate_library>(lib_name.string);
+    m_gate_lib          = std::make_shared<gate_library>(std::string(lib_name.string));
     auto library_stream = m_token_stream.extract_until("}", token_stream::END_OF_STREAM, true, true);
     m_token_stream.consume("}", true);
 
@@ -194,7 +196,7 @@ bool gate_library_parser_liberty::parse_pin(token_stream& cell_stream)
 {
     cell_stream.consume("pin", true);
     cell_stream.consume("(", true);
-    auto pin_name = cell_stream.consume().string;
+    std::string pin_name = cell_stream.consume();
     cell_stream.consume(")", true);
     cell_stream.consume("{", true);
     auto pin_stream = cell_stream.extract_until("}", token_stream::END_OF_STREAM, true, true);
@@ -1,5 +1,9 @@
 #include "netlist/gate_library/gate_type/gate_type.h"
 
+#include "core/log.h"
+
+#include <algorithm>
+
 gate_type::gate_type(const std::string& name)
 {
     m_name      = name;
@@ -41,22 +45,34 @@ bool gate_type::do_compare(const gate_type& other) const
 
 void gate_type::add_input_pin(std::string input_pin)
 {
+    u32 index = m_input_pins.size();
+    m_input_pin_indices.emplace(input_pin, index);
     m_input_pins.push_back(input_pin);
+    insert_by_name(m_input_pins, m_input_pin_order, index);
 }
 
 void gate_type::add_input_pins(const std::vector<std::string>& input_pins)
 {
-    m_input_pins.insert(m_input_pins.end(), input_pins.begin(), input_pins.end());
+    for (const auto& pin : input_pins)
+    {
+        add_input_pin(pin);
+    }
 }
 
 void gate_type::add_output_pin(std::string output_pin)
 {
+    u32 index = m_output_pins.size();
+    m_output_pin_indices.emplace(output_pin, index);
     m_output_pins.push_back(output_pin);
+    insert_by_name(m_output_pins, m_output_pin_order, index);
 }
 
 void gate_type::add_output_pins(const std::vector<std::string>& output_pins)
 {
-    m_output_pins.insert(m_output_pins.end(), output_pins.begin(), output_pins.end());
+    for (const auto& pin : output_pins)
+    {
+        add_output_pin(pin);
+    }
 }
 
 void gate_type::add_boolean_function(std::string pin_name, boolean_function bf)
@@ -79,11 +95,69 @@ std::vector<std::string> gate_type::get_input_pins() const
     return m_input_pins;
 }
 
+u32 gate_type::get_input_pin_index(const std::string& input_pin) const
+{
+    if (auto it = m_input_pin_indices.find(input_pin); it != m_input_pin_indices.end())
+    {
+        return it->second;
+    }
+    return invalid_pin_index;
+}
+
+const std::string& gate_type::get_input_pin(u32 index) const
+{
+    static const std::string empty_pin;
+
+    if (index >= m_input_pins.size())
+    {
+        log_error("netlist", "gate type '{}' has no input pin with index {}.", m_name, index);
+        return empty_pin;
+    }
+    return m_input_pins[index];
+}
+
+const std::vector<u32>& gate_type::get_input_pin_order() const
+{
+    return m_input_pin_order;
+}
+
 std::vector<std::string> gate_type::get_output_pins() const
 {
     return m_output_pins;
 }
 
+u32 gate_type::get_output_pin_index(const std::string& output_pin) const
+{
+    if (auto it = m_output_pin_indices.find(output_pin); it != m_output_pin_indices.end())
+    {
+        return it->second;
+    }
+    return invalid_pin_index;
+}
+
+const std::string& gate_type::get_output_pin(u32 index) const
+{
+    static const std::string empty_pin;
+
+    if (index >= m_output_pins.size())
+    {
+        log_error("netlist", "gate type '{}' has no output pin with index {}.", m_name, index);
+        return empty_pin;
+    }
+    return m_output_pins[index];
+}
+
+const std::vector<u32>& gate_type::get_output_pin_order() const
+{
+    return m_output_pin_order;
+}
+
+void gate_type::insert_by_name(const std::vector<std::string>& pins, std::vector<u32>& order, u32 index)
+{
+    auto it = std::upper_bound(order.begin(), order.end(), index, [&pins](u32 a, u32 b) { return pins[a] < pins[b]; });
+    order.insert(it, index);
+}
+
 std::unordered_map<std::string, boolean_function> gate_type::get_boolean_functions() const
 {
     return m_functions;
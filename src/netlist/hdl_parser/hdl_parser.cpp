@@ -1,6 +1,111 @@
 #include "netlist/hdl_parser/hdl_parser.h"
 
-hdl_parser::hdl_parser(std::stringstream& stream) : m_fs(stream)
+#include "core/log.h"
+
+#include <algorithm>
+
+hdl_parser::hdl_parser(std::stringstream& stream) : m_buffer_storage(stream.str())
+{
+    m_netlist = nullptr;
+    m_buffer  = m_buffer_storage;
+}
+
+hdl_parser::hdl_parser(std::string_view buffer) : m_buffer(buffer)
 {
     m_netlist = nullptr;
 }
+
+std::string hdl_parser::get_bits_from_digits(const std::string& digits, u32 base)
+{
+    if (base == 10)
+    {
+        // decimal digits do not map to groups of bits, so the number is halved digit by digit until it is zero
+        std::vector<u32> decimal;
+        for (char c : digits)
+        {
+            if (c < '0' || c > '9')
+            {
+                log_error("hdl_parser", "invalid digit '{}' in number '{}' of base {}.", c, digits, base);
+                return "0";
+            }
+            decimal.push_back(c - '0');
+        }
+
+        std::string result;
+        while (std::any_of(decimal.begin(), decimal.end(), [](u32 d) { return d != 0; }))
+        {
+            u32 remainder = 0;
+            for (auto& d : decimal)
+            {
+                u32 current = remainder * 10 + d;
+                d           = current / 2;
+                remainder   = current % 2;
+            }
+            result.push_back(remainder ? '1' : '0');
+        }
+        if (result.empty())
+        {
+            result = "0";
+        }
+        return std::string(result.rbegin(), result.rend());
+    }
+
+    u32 bits_per_digit = (base == 2) ? 1 : ((base == 8) ? 3 : 4);
+
+    std::string result;
+    result.reserve(digits.size() * bits_per_digit);
+    for (char c : digits)
+    {
+        u32 digit = base;
+        if (c >= '0' && c <= '9')
+        {
+            digit = c - '0';
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            digit = c - 'a' + 10;
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            digit = c - 'A' + 10;
+        }
+
+        if (digit >= base)
+        {
+            log_error("hdl_parser", "invalid digit '{}' in number '{}' of base {}.", c, digits, base);
+            return "0";
+        }
+
+        for (u32 i = bits_per_digit; i > 0; --i)
+        {
+            result.push_back(((digit >> (i - 1)) & 1) ? '1' : '0');
+        }
+    }
+    return result;
+}
+
+std::string hdl_parser::get_hex_from_bits(const std::string& bits)
+{
+    std::string result;
+
+    // hex digits are built from the least significant bit on
+    for (i32 end = bits.size(); end > 0; end -= 4)
+    {
+        u32 digit = 0;
+        for (i32 i = std::max(0, end - 4); i < end; ++i)
+        {
+            digit = (digit << 1) | (bits[i] == '1');
+        }
+        result.push_back("0123456789abcdef"[digit]);
+    }
+
+    while (result.size() > 1 && result.back() == '0')
+    {
+        result.pop_back();
+    }
+    if (result.empty())
+    {
+        result = "0";
+    }
+    return std::string(result.rbegin(), result.rend());
+}
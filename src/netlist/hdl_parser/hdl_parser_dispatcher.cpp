@@ -1,6 +1,7 @@
 #include "netlist/hdl_parser/hdl_parser_dispatcher.h"
 
 #include "core/log.h"
+#include "core/memory_mapped_file.h"
 
 #include "netlist/netlist.h"
 #include "netlist/netlist_factory.h"
@@ -75,25 +76,22 @@ namespace hdl_parser_dispatcher
 
         log_info("hdl_parser", "parsing '{}' using gate library '{}'...", file_name.string(), gate_library);
 
-        std::ifstream ifs;
-        ifs.open(file_name.c_str(), std::ifstream::in);
-        if (!ifs.is_open())
+        // the parsers work directly on the mapped file, so it is never copied as a whole
+        memory_mapped_file file;
+        if (!file.map_file(file_name.string()))
         {
             log_error("hdl_parser", "cannot open '{}'", file_name.string());
             return nullptr;
         }
-        std::stringstream ss;
-        ss << ifs.rdbuf();
-        ifs.close();
 
         std::shared_ptr<netlist> g = nullptr;
 
         // event_controls::enable_all(false);
 
         if (parser_name == "vhdl")
-            g = hdl_parser_vhdl(ss).parse(gate_library);
+            g = hdl_parser_vhdl(file.get_data()).parse(gate_library);
         else if (parser_name == "verilog")
-            g = hdl_parser_verilog(ss).parse(gate_library);
+            g = hdl_parser_verilog(file.get_data()).parse(gate_library);
         else
             log_error("hdl_parser", "parser '{}' is unkown", parser_name);
 
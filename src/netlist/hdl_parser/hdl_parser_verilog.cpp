@@ -9,12 +9,17 @@
 
 #include "netlist/netlist_factory.h"
 
+#include <exception>
 #include <queue>
 
 hdl_parser_verilog::hdl_parser_verilog(std::stringstream& stream) : hdl_parser(stream)
 {
 }
 
+hdl_parser_verilog::hdl_parser_verilog(std::string_view buffer) : hdl_parser(buffer)
+{
+}
+
 // ###########################################################################
 // ###########          Parse HDL into intermediate format          ##########
 // ###########################################################################
@@ -29,6 +34,8 @@ std::shared_ptr<netlist> hdl_parser_verilog::parse(const std::string& gate_libra
         return nullptr;
     }
 
+    m_builder = std::make_unique<netlist_builder>(m_netlist);
+
     // tokenize file
     if (!tokenize())
     {
@@ -142,81 +149,235 @@ std::shared_ptr<netlist> hdl_parser_verilog::parse(const std::string& gate_libra
         }
     }
 
+    m_builder->commit();
+
     return m_netlist;
 }
 
 bool hdl_parser_verilog::tokenize()
 {
-    std::string delimiters = ",()[]{}\\#: ;=.";
-    std::string current_token;
-    u32 line_number = 0;
+    struct chunk
+    {
+        u32 first_line;
+        bool multi_line_comment;
+        bool multi_line_property;
+    };
+
+    std::vector<std::string_view> lines;
+    std::vector<chunk> chunks;
 
-    std::string line;
-    bool escaped             = false;
     bool multi_line_comment  = false;
     bool multi_line_property = false;
 
-    std::vector<token> parsed_tokens;
-    while (std::getline(m_fs, line))
+    // comments may span multiple lines, hence they are detected sequentially
+    // on the way, the file is split into chunks at every line that starts a new module
+    std::vector<std::string_view> parts;
+    u64 line_begin = 0;
+    while (line_begin < m_buffer.size())
     {
-        line_number++;
-        this->remove_comments(line, multi_line_comment, multi_line_property);
+        auto line_end = m_buffer.find('\n', line_begin);
+        if (line_end == std::string_view::npos)
+        {
+            line_end = m_buffer.size();
+        }
+        auto line  = m_buffer.substr(line_begin, line_end - line_begin);
+        line_begin = line_end + 1;
+
+        chunk current = {(u32)lines.size(), multi_line_comment, multi_line_property};
+        this->remove_comments(line, multi_line_comment, multi_line_property, parts);
 
-        for (char c : line)
+        for (const auto& part : parts)
         {
-            if (c == '\\')
+            auto first = part.find_first_not_of(" \t\r");
+            if (first == std::string_view::npos)
             {
-                escaped = true;
                 continue;
             }
-            else if (escaped && std::isspace(c))
+            if (part.compare(first, 6, "module") == 0)
             {
-                escaped = false;
+                auto next = first + 6;
+                if (next == part.size() || std::isspace(part[next]) || part[next] == '(' || part[next] == '#' || part[next] == ';')
+                {
+                    chunks.push_back(current);
+                }
             }
+            break;
+        }
 
-            if ((!std::isspace(c) && delimiters.find(c) == std::string::npos) || escaped)
-            {
-                current_token += c;
-            }
-            else
+        lines.push_back(line);
+    }
+
+    if (chunks.empty() || chunks.front().first_line != 0)
+    {
+        chunks.insert(chunks.begin(), {0, false, false});
+    }
+
+    // modules are independent of each other, so the chunks are tokenized in parallel
+    // tokens are views into the buffer, only tokens that are interrupted by a comment are copied to the storage of the chunk
+    i32 num_of_chunks = chunks.size();
+    m_entity_streams.resize(num_of_chunks);
+
+#pragma omp parallel for schedule(dynamic)
+    for (i32 i = 0; i < num_of_chunks; i++)
+    {
+        u32 end = (i + 1 < num_of_chunks) ? chunks[i + 1].first_line : lines.size();
+        token_stream::text_storage storage;
+        auto tokens = tokenize_lines(lines, chunks[i].first_line, end, chunks[i].multi_line_comment, chunks[i].multi_line_property, storage);
+
+        m_entity_streams[i] = token_stream(std::move(tokens), std::move(storage), {"(", "["}, {")", "]"});
+    }
+
+    return true;
+}
+
+std::vector<token> hdl_parser_verilog::tokenize_lines(const std::vector<std::string_view>& lines,
+                                                      u32 begin,
+                                                      u32 end,
+                                                      bool multi_line_comment,
+                                                      bool multi_line_property,
+                                                      token_stream::text_storage& storage)
+{
+    std::string delimiters = ",()[]{}\\#: ;=.";
+    bool escaped           = false;
+
+    std::vector<token> parsed_tokens;
+
+    // the current token is a slice of the buffer as long as its characters are adjacent
+    // once it is interrupted, e.g., by an escape character or a comment, it is continued as a copy
+    std::string_view current_token;
+    std::string current_token_copy;
+
+    auto extend_current_token = [&](const char* c) {
+        if (!current_token_copy.empty())
+        {
+            current_token_copy += *c;
+        }
+        else if (current_token.empty())
+        {
+            current_token = std::string_view(c, 1);
+        }
+        else if (current_token.data() + current_token.size() == c)
+        {
+            current_token = std::string_view(current_token.data(), current_token.size() + 1);
+        }
+        else
+        {
+            current_token_copy = std::string(current_token) + *c;
+        }
+    };
+
+    auto finish_current_token = [&](u32 line_number) {
+        if (!current_token_copy.empty())
+        {
+            parsed_tokens.emplace_back(line_number, storage.store(current_token_copy));
+            current_token_copy.clear();
+        }
+        else if (!current_token.empty())
+        {
+            parsed_tokens.emplace_back(line_number, current_token);
+        }
+        current_token = std::string_view();
+    };
+
+    std::vector<std::string_view> parts;
+    for (u32 line_index = begin; line_index < end; line_index++)
+    {
+        u32 line_number = line_index + 1;
+
+        this->remove_comments(lines[line_index], multi_line_comment, multi_line_property, parts);
+
+        for (const auto& part : parts)
+        {
+            for (const char& c : part)
             {
-                if (!current_token.empty())
+                if (c == '\\')
                 {
-                    parsed_tokens.emplace_back(line_number, current_token);
-                    current_token.clear();
+                    escaped = true;
+                    continue;
+                }
+                else if (escaped && std::isspace(c))
+                {
+                    escaped = false;
                 }
 
-                if (c == '(' && parsed_tokens.back() == "#")
+                if ((!std::isspace(c) && delimiters.find(c) == std::string::npos) || escaped)
                 {
-                    parsed_tokens.back() = "#(";
+                    extend_current_token(&c);
                 }
-                else if (!std::isspace(c))
+                else
                 {
-                    parsed_tokens.emplace_back(line_number, std::string(1, c));
+                    finish_current_token(line_number);
+
+                    if (c == '(' && !parsed_tokens.empty() && parsed_tokens.back() == "#")
+                    {
+                        parsed_tokens.back() = "#(";
+                    }
+                    else if (!std::isspace(c))
+                    {
+                        parsed_tokens.emplace_back(line_number, std::string_view(&c, 1));
+                    }
                 }
             }
         }
-        if (!current_token.empty())
-        {
-            parsed_tokens.emplace_back(line_number, current_token);
-            current_token.clear();
-        }
+        finish_current_token(line_number);
     }
 
-    m_token_stream = token_stream(parsed_tokens, {"(", "["}, {")", "]"});
-    return true;
+    return parsed_tokens;
 }
 
 bool hdl_parser_verilog::parse_tokens()
 {
-    std::string last_entity;
+    i32 num_of_chunks = m_entity_streams.size();
 
-    while (m_token_stream.remaining() > 0)
+    std::vector<std::vector<entity>> chunk_entities(num_of_chunks);
+    std::vector<u8> chunk_failed(num_of_chunks, 0);
+    std::vector<std::exception_ptr> chunk_exceptions(num_of_chunks);
+
+    // every chunk holds complete modules, so they can be parsed into entities in parallel
+#pragma omp parallel for schedule(dynamic)
+    for (i32 i = 0; i < num_of_chunks; i++)
     {
-        if (!parse_entity_definiton())
+        try
+        {
+            while (m_entity_streams[i].remaining() > 0)
+            {
+                entity e;
+                if (!parse_entity_definiton(m_entity_streams[i], e))
+                {
+                    chunk_failed[i] = 1;
+                    break;
+                }
+                chunk_entities[i].push_back(std::move(e));
+            }
+        }
+        catch (...)
+        {
+            chunk_failed[i]     = 1;
+            chunk_exceptions[i] = std::current_exception();
+        }
+    }
+    m_entity_streams.clear();
+
+    // merge in file order, so that the first error and the last entity are the same as for sequential parsing
+    for (i32 i = 0; i < num_of_chunks; i++)
+    {
+        if (chunk_exceptions[i] != nullptr)
+        {
+            std::rethrow_exception(chunk_exceptions[i]);
+        }
+        if (chunk_failed[i])
         {
             return false;
         }
+
+        for (auto& e : chunk_entities[i])
+        {
+            if (!e.name.empty())
+            {
+                m_last_entity      = e.name;
+                m_entities[e.name] = std::move(e);
+            }
+        }
     }
 
     if (!connect_instances())
@@ -227,33 +388,32 @@ bool hdl_parser_verilog::parse_tokens()
     return true;
 }
 
-bool hdl_parser_verilog::parse_entity_definiton()
+bool hdl_parser_verilog::parse_entity_definiton(token_stream& ts, entity& e)
 {
-    entity e;
-    e.line_number = m_token_stream.peek().number;
-    m_token_stream.consume("module", true);
-    e.name = m_token_stream.consume();
+    e.line_number = ts.peek().number;
+    ts.consume("module", true);
+    e.name = ts.consume();
 
-    if (m_token_stream.peek() == "#(")
+    if (ts.peek() == "#(")
     {
         // TODO generics
-        m_token_stream.consume_until(")", token_stream::END_OF_STREAM, true, true);
-        m_token_stream.consume(")", true);
+        ts.consume_until(")", token_stream::END_OF_STREAM, true, true);
+        ts.consume(")", true);
     }
 
-    if (!parse_port_list(e))
+    if (!parse_port_list(ts, e))
     {
         return false;
     }
 
-    m_token_stream.consume(";", true);
+    ts.consume(";", true);
 
-    auto next_token = m_token_stream.peek();
+    auto next_token = ts.peek();
     while (next_token != "endmodule")
     {
         if (next_token == "input" || next_token == "output")
         {
-            if (!parse_port_definition(e))
+            if (!parse_port_definition(ts, e))
             {
                 return false;
             }
@@ -266,44 +426,38 @@ bool hdl_parser_verilog::parse_entity_definiton()
         }
         else if (next_token == "wire")
         {
-            if (!parse_signal_definition(e))
+            if (!parse_signal_definition(ts, e))
             {
                 return false;
             }
         }
         else if (next_token == "assign")
         {
-            if (!parse_assign(e))
+            if (!parse_assign(ts, e))
             {
                 return false;
             }
         }
         else
         {
-            if (!parse_instance(e))
+            if (!parse_instance(ts, e))
             {
                 return false;
             }
         }
 
-        next_token = m_token_stream.peek();
+        next_token = ts.peek();
     }
 
-    m_token_stream.consume("endmodule", true);
-
-    if (!e.name.empty())
-    {
-        m_entities[e.name] = e;
-        m_last_entity      = e.name;
-    }
+    ts.consume("endmodule", true);
 
     return true;
 }
 
-bool hdl_parser_verilog::parse_port_list(entity& e)
+bool hdl_parser_verilog::parse_port_list(token_stream& ts, entity& e)
 {
-    m_token_stream.consume("(", true);
-    auto ports = m_token_stream.extract_until(")", token_stream::END_OF_STREAM, true, true);
+    ts.consume("(", true);
+    auto ports = ts.extract_until(")", token_stream::END_OF_STREAM, true, true);
 
     while (ports.remaining() > 0)
     {
@@ -311,17 +465,17 @@ bool hdl_parser_verilog::parse_port_list(entity& e)
         ports.consume(",", ports.remaining() > 0);
     }
 
-    m_token_stream.consume(")", true);
+    ts.consume(")", true);
 
     return true;
 }
 
-bool hdl_parser_verilog::parse_port_definition(entity& e)
+bool hdl_parser_verilog::parse_port_definition(token_stream& ts, entity& e)
 {
-    auto direction = m_token_stream.consume();
-    auto port_str  = m_token_stream.extract_until(";", token_stream::END_OF_STREAM, true, true);
+    auto direction = ts.consume();
+    auto port_str  = ts.extract_until(";", token_stream::END_OF_STREAM, true, true);
 
-    m_token_stream.consume(";", true);
+    ts.consume(";", true);
 
     // expand port on bit-level
     for (const auto& expanded_port : get_expanded_signals(port_str))
@@ -344,12 +498,12 @@ bool hdl_parser_verilog::parse_port_definition(entity& e)
     return true;
 }
 
-bool hdl_parser_verilog::parse_signal_definition(entity& e)
+bool hdl_parser_verilog::parse_signal_definition(token_stream& ts, entity& e)
 {
-    m_token_stream.consume("wire", true);
-    auto signal_str = m_token_stream.extract_until(";");
+    ts.consume("wire", true);
+    auto signal_str = ts.extract_until(";");
 
-    m_token_stream.consume(";", true);
+    ts.consume(";", true);
 
     // expand wire on bit-level
     for (const auto& expanded_signal : get_expanded_signals(signal_str))
@@ -365,17 +519,17 @@ bool hdl_parser_verilog::parse_signal_definition(entity& e)
     return true;
 }
 
-bool hdl_parser_verilog::parse_assign(entity& e)
+bool hdl_parser_verilog::parse_assign(token_stream& ts, entity& e)
 {
     std::unordered_map<std::string, std::string> direct_assignment;
 
-    auto assign_line = m_token_stream.peek().number;
+    auto assign_line = ts.peek().number;
 
-    m_token_stream.consume("assign", true);
-    auto left_str = m_token_stream.extract_until("=", token_stream::END_OF_STREAM, true, true);
-    m_token_stream.consume("=", true);
-    auto right_str = m_token_stream.extract_until(";", token_stream::END_OF_STREAM, true, true);
-    m_token_stream.consume(";", true);
+    ts.consume("assign", true);
+    auto left_str = ts.extract_until("=", token_stream::END_OF_STREAM, true, true);
+    ts.consume("=", true);
+    auto right_str = ts.extract_until(";", token_stream::END_OF_STREAM, true, true);
+    ts.consume(";", true);
 
     // extract assignments for each bit
     auto left_parts  = get_assignment_signals(left_str, e, false);
@@ -415,15 +569,15 @@ bool hdl_parser_verilog::parse_assign(entity& e)
     return true;
 }
 
-bool hdl_parser_verilog::parse_instance(entity& e)
+bool hdl_parser_verilog::parse_instance(token_stream& ts, entity& e)
 {
     instance inst;
-    inst.type = m_token_stream.consume();
+    inst.type = ts.consume();
 
     // parse generics map
-    if (m_token_stream.consume("#("))
+    if (ts.consume("#("))
     {
-        auto generic_str = m_token_stream.extract_until(")", token_stream::END_OF_STREAM, true, true);
+        auto generic_str = ts.extract_until(")", token_stream::END_OF_STREAM, true, true);
 
         while (generic_str.remaining() > 0)
         {
@@ -445,15 +599,15 @@ bool hdl_parser_verilog::parse_instance(entity& e)
             }
         }
 
-        m_token_stream.consume(")", true);
+        ts.consume(")", true);
     }
 
     // parse instance name
-    inst.name = m_token_stream.consume();
+    inst.name = ts.consume();
 
     // parse port map
-    m_token_stream.consume("(", true);
-    auto port_str = m_token_stream.extract_until(")", token_stream::END_OF_STREAM, true, true);
+    ts.consume("(", true);
+    auto port_str = ts.extract_until(")", token_stream::END_OF_STREAM, true, true);
 
     while (port_str.remaining() > 0)
     {
@@ -475,8 +629,8 @@ bool hdl_parser_verilog::parse_instance(entity& e)
         }
     }
 
-    m_token_stream.consume(")", true);
-    m_token_stream.consume(";", true);
+    ts.consume(")", true);
+    ts.consume(";", true);
 
     // add to vector of instances of current entity
     e.instances.push_back(inst);
@@ -620,7 +774,7 @@ bool hdl_parser_verilog::build_netlist(const std::string& top_module)
                 return false;
             }
 
-            auto new_net = m_netlist->create_net(expanded_port_name);
+            auto new_net = m_builder->create_net(expanded_port_name);
             if (new_net == nullptr)
             {
                 return false;
@@ -768,7 +922,7 @@ std::shared_ptr<module> hdl_parser_verilog::instantiate(const entity& e, std::sh
     {
         // create new net for the signal
         aliases[name] = get_unique_alias(name);
-        auto new_net  = m_netlist->create_net(aliases[name]);
+        auto new_net  = m_builder->create_net(aliases[name]);
         if (new_net == nullptr)
         {
             return nullptr;
@@ -803,8 +957,8 @@ std::shared_ptr<module> hdl_parser_verilog::instantiate(const entity& e, std::sh
     }
 
     // cache global vcc/gnd types
-    auto vcc_gate_types = m_netlist->get_gate_library()->get_vcc_gate_types();
-    auto gnd_gate_types = m_netlist->get_gate_library()->get_gnd_gate_types();
+    const auto& vcc_gate_types = m_netlist->get_gate_library()->get_vcc_gate_types();
+    const auto& gnd_gate_types = m_netlist->get_gate_library()->get_gnd_gate_types();
 
     // process instances i.e. gates or other entities
     for (const auto& inst : e.instances)
@@ -855,7 +1009,7 @@ std::shared_ptr<module> hdl_parser_verilog::instantiate(const entity& e, std::sh
             aliases[inst.name] = get_unique_alias(inst.name);
 
             std::shared_ptr<gate> new_gate;
-            auto gate_types = m_netlist->get_gate_library()->get_gate_types();
+            const auto& gate_types = m_netlist->get_gate_library()->get_gate_types();
 
             if (auto gate_type_it = gate_types.find(inst.type); gate_type_it == gate_types.end())
             {
@@ -863,7 +1017,7 @@ std::shared_ptr<module> hdl_parser_verilog::instantiate(const entity& e, std::sh
             }
             else
             {
-                new_gate = m_netlist->create_gate(gate_type_it->second, aliases[inst.name]);
+                new_gate = m_builder->create_gate(gate_type_it->second, aliases[inst.name]);
             }
 
             if (new_gate == nullptr)
@@ -871,7 +1025,7 @@ std::shared_ptr<module> hdl_parser_verilog::instantiate(const entity& e, std::sh
                 return nullptr;
             }
 
-            module->assign_gate(new_gate);
+            m_builder->assign_gate(module, new_gate);
             container = new_gate.get();
 
             // if gate is a global type, register it as such
@@ -936,13 +1090,13 @@ std::shared_ptr<module> hdl_parser_verilog::instantiate(const entity& e, std::sh
                                       new_gate->get_name(),
                                       new_gate->get_type()->get_name());
                         }
-                        if (!current_net->set_src(new_gate, pin))
+                        if (!m_builder->set_src(current_net, new_gate, pin))
                         {
                             return nullptr;
                         }
                     }
 
-                    if (is_input && !current_net->add_dst(new_gate, pin))
+                    if (is_input && !m_builder->add_dst(current_net, new_gate, pin))
                     {
                         return nullptr;
                     }
@@ -998,103 +1152,53 @@ std::shared_ptr<module> hdl_parser_verilog::instantiate(const entity& e, std::sh
 // ###################          Helper functions          ####################
 // ###########################################################################
 
-void hdl_parser_verilog::remove_comments(std::string& line, bool& multi_line_comment, bool& multi_line_property)
+void hdl_parser_verilog::remove_comments(std::string_view line, bool& multi_line_comment, bool& multi_line_property, std::vector<std::string_view>& parts)
 {
-    bool repeat = true;
+    parts.clear();
 
-    while (repeat)
+    u64 pos = 0;
+    while (pos < line.size())
     {
-        repeat = false;
-
-        // skip empty lines
-        if (line.empty())
+        if (multi_line_comment || multi_line_property)
         {
-            break;
+            auto end = line.find(multi_line_comment ? "*/" : "*)", pos);
+            if (end == std::string_view::npos)
+            {
+                // rest of the line is within a multi-line comment or property
+                break;
+            }
+
+            // multi-line comment or property ends in current line
+            multi_line_comment  = false;
+            multi_line_property = false;
+            pos                 = end + 2;
+            continue;
         }
 
-        auto single_line_comment_begin = line.find("//");
-        auto multi_line_comment_begin  = line.find("/*");
-        auto multi_line_comment_end    = line.find("*/");
-        auto multi_line_property_begin = line.find("(*");
-        auto multi_line_property_end   = line.find("*)");
+        auto single_line_comment_begin = line.find("//", pos);
+        auto multi_line_comment_begin  = line.find("/*", pos);
+        auto multi_line_property_begin = line.find("(*", pos);
+        auto begin                     = std::min({single_line_comment_begin, multi_line_comment_begin, multi_line_property_begin});
 
-        std::string begin = "";
-        std::string end   = "";
+        if (begin != pos)
+        {
+            parts.push_back(line.substr(pos, begin - pos));
+        }
 
-        if (multi_line_comment == true)
+        if (begin == std::string_view::npos || begin == single_line_comment_begin)
         {
-            if (multi_line_comment_end != std::string::npos)
-            {
-                // multi-line comment ends in current line
-                multi_line_comment = false;
-                line               = line.substr(multi_line_comment_end + 2);
-                repeat             = true;
-            }
-            else
-            {
-                // current line entirely within multi-line comment
-                line = "";
-                break;
-            }
+            // no more comments or the rest of the line is a single-line comment
+            break;
         }
-        else if (multi_line_property == true)
+        else if (begin == multi_line_comment_begin)
         {
-            if (multi_line_property_end != std::string::npos)
-            {
-                // multi-line property ends in current line
-                multi_line_property = false;
-                line                = line.substr(multi_line_property_end + 2);
-                repeat              = true;
-            }
-            else
-            {
-                // current line entirely in multi-line property
-                line = "";
-                break;
-            }
+            multi_line_comment = true;
         }
         else
         {
-            if (single_line_comment_begin != std::string::npos)
-            {
-                if (multi_line_comment_begin == std::string::npos || (multi_line_comment_begin != std::string::npos && multi_line_comment_begin > single_line_comment_begin))
-                {
-                    // single-line comment
-                    line   = line.substr(0, single_line_comment_begin);
-                    repeat = true;
-                }
-            }
-            else if (multi_line_comment_begin != std::string::npos)
-            {
-                if (multi_line_comment_end != std::string::npos)
-                {
-                    // multi-line comment entirely in current line
-                    line   = line.substr(0, multi_line_comment_begin) + line.substr(multi_line_comment_end + 2);
-                    repeat = true;
-                }
-                else
-                {
-                    // multi-line comment starts in current line
-                    multi_line_comment = true;
-                    line               = line.substr(0, multi_line_comment_begin);
-                }
-            }
-            else if (multi_line_property_begin != std::string::npos)
-            {
-                if (multi_line_property_end != std::string::npos)
-                {
-                    // multi-line property entirely in current line
-                    line   = line.substr(0, multi_line_property_begin) + line.substr(multi_line_property_end + 2);
-                    repeat = true;
-                }
-                else
-                {
-                    // multi-line property starts in current line
-                    multi_line_property = true;
-                    line                = line.substr(0, multi_line_property_begin);
-                }
-            }
+            multi_line_property = true;
         }
+        pos = begin + 2;
     }
 }
 
@@ -1149,7 +1253,7 @@ std::unordered_map<std::string, std::vector<std::string>> hdl_parser_verilog::ge
 
         try
         {
-            bounds.emplace_back(std::stoi(lower.string), std::stoi(upper.string));
+            bounds.emplace_back(std::stoi(lower), std::stoi(upper));
         }
         catch (std::invalid_argument& e)
         {
@@ -1225,7 +1329,7 @@ std::vector<std::string> hdl_parser_verilog::get_assignment_signals(token_stream
     for (auto& s : parts)
     {
         auto stream_backup = s;
-        auto signal_name   = s.consume().string;
+        std::string signal_name = s.consume();
 
         // (3) NUMBER
         if (isdigit(signal_name[0]) || signal_name[0] == '\'')
@@ -1272,7 +1376,7 @@ std::vector<std::string> hdl_parser_verilog::get_assignment_signals(token_stream
             {
                 do
                 {
-                    signal_name += "(" + s.consume().string + ")";
+                    signal_name += "(" + std::string(s.consume()) + ")";
 
                     s.consume("]", true);
                 } while (s.consume("["));
@@ -1305,21 +1409,22 @@ std::vector<std::string> hdl_parser_verilog::get_assignment_signals(token_stream
 std::vector<std::string> hdl_parser_verilog::get_port_signals(token_stream& port_str, const std::string& instance_type)
 {
     std::vector<std::string> result;
-    auto gate_types = m_netlist->get_gate_library()->get_gate_types();
+    const auto& gate_types = m_netlist->get_gate_library()->get_gate_types();
 
-    auto port_name = port_str.consume();
+    auto port_token       = port_str.consume();
+    std::string port_name = port_token;
 
     if (m_entities.find(instance_type) != m_entities.end())
     {
         // is instance a valid entity within netlist?
-        if (m_entities[instance_type].ports_expanded.find(port_name.string) != m_entities[instance_type].ports_expanded.end())
+        if (m_entities[instance_type].ports_expanded.find(port_name) != m_entities[instance_type].ports_expanded.end())
         {
             // is port valid for given entity
-            result.insert(result.end(), m_entities[instance_type].ports_expanded[port_name.string].second.begin(), m_entities[instance_type].ports_expanded[port_name.string].second.end());
+            result.insert(result.end(), m_entities[instance_type].ports_expanded[port_name].second.begin(), m_entities[instance_type].ports_expanded[port_name].second.end());
         }
         else
         {
-            log_error("hdl_parser", "invalid port '{}' for entity '{}' in line {}.", port_name.string, instance_type, port_name.number);
+            log_error("hdl_parser", "invalid port '{}' for entity '{}' in line {}.", port_name, instance_type, port_token.number);
             return {};
         }
     }
@@ -1335,19 +1440,19 @@ std::vector<std::string> hdl_parser_verilog::get_port_signals(token_stream& port
             m_gate_to_pin_map[instance_type].insert(m_gate_to_pin_map[instance_type].end(), opins.begin(), opins.end());
         }
 
-        if (std::find(m_gate_to_pin_map[instance_type].begin(), m_gate_to_pin_map[instance_type].end(), port_name.string) != m_gate_to_pin_map[instance_type].end())
+        if (std::find(m_gate_to_pin_map[instance_type].begin(), m_gate_to_pin_map[instance_type].end(), port_name) != m_gate_to_pin_map[instance_type].end())
         {
-            result.push_back(port_name.string);
+            result.push_back(port_name);
         }
         else
         {
-            log_error("hdl_parser", "invalid port '{}' for gate '{}' in line {}.", port_name.string, instance_type, port_name.number);
+            log_error("hdl_parser", "invalid port '{}' for gate '{}' in line {}.", port_name, instance_type, port_token.number);
             return {};
         }
     }
     else
     {
-        log_error("hdl_parser", "'{}' is neither an entity nor a gate type (line {}).", instance_type, port_name.number);
+        log_error("hdl_parser", "'{}' is neither an entity nor a gate type (line {}).", instance_type, port_token.number);
         return {};
     }
 
@@ -1357,7 +1462,6 @@ std::vector<std::string> hdl_parser_verilog::get_port_signals(token_stream& port
 std::string hdl_parser_verilog::get_number_from_literal(const std::string& v, const u32 target_base)
 {
     std::string value = core_utils::to_lower(core_utils::trim(core_utils::replace(v, "_", "")));
-    std::string res;
 
     u32 len = 0, source_base = 0;
     std::string length, prefix, number;
@@ -1393,43 +1497,25 @@ std::string hdl_parser_verilog::get_number_from_literal(const std::string& v, co
         }
     }
 
-    if (target_base == 2)
+    // numbers are converted digit by digit, so their width is not limited
+    std::string bits = get_bits_from_digits(number, source_base);
+    if (target_base == 16)
     {
-        // constructing bit string
-        u64 val = stoull(number, 0, source_base);
-
-        if (!length.empty())
-        {
-            len = std::stoi(length);
+        return get_hex_from_bits(bits);
+    }
 
-            for (u32 i = 0; i < len; i++)
-            {
-                res = std::to_string(val & 0x1) + res;
-                val >>= 1;
-            }
-        }
-        else
+    if (!length.empty())
+    {
+        len = std::stoi(length);
+        if (bits.size() > len)
         {
-            do
-            {
-                res = std::to_string(val & 0x1) + res;
-                val >>= 1;
-            } while (val != 0);
+            return bits.substr(bits.size() - len);
         }
-    }
-    else if (target_base == 16)
-    {
-        // constructing hex string
-        std::stringstream ss;
-
-        u64 val = stoull(number, 0, source_base);
-
-        ss << std::hex << val;
-
-        res = ss.str();
+        return std::string(len - bits.size(), '0') + bits;
     }
 
-    return res;
+    auto first_one = bits.find('1');
+    return (first_one == std::string::npos) ? "0" : bits.substr(first_one);
 }
 
 std::string hdl_parser_verilog::get_unique_alias(const std::string& name)
@@ -15,6 +15,10 @@ hdl_parser_vhdl::hdl_parser_vhdl(std::stringstream& stream) : hdl_parser(stream)
 {
 }
 
+hdl_parser_vhdl::hdl_parser_vhdl(std::string_view buffer) : hdl_parser(buffer)
+{
+}
+
 // ###########################################################################
 // ###########          Parse HDL into intermediate format          ##########
 // ###########################################################################
@@ -28,6 +32,8 @@ std::shared_ptr<netlist> hdl_parser_vhdl::parse(const std::string& gate_library)
         return nullptr;
     }
 
+    m_builder = std::make_unique<netlist_builder>(m_netlist);
+
     // tokenize file
     if (!tokenize())
     {
@@ -144,10 +150,12 @@ std::shared_ptr<netlist> hdl_parser_vhdl::parse(const std::string& gate_library)
         }
     }
 
+    m_builder->commit();
+
     return m_netlist;
 }
 
-static bool is_digits(const std::string& str)
+static bool is_digits(std::string_view str)
 {
     return std::all_of(str.begin(), str.end(), ::isdigit);    // C++11
 }
@@ -155,22 +163,42 @@ static bool is_digits(const std::string& str)
 bool hdl_parser_vhdl::tokenize()
 {
     std::vector<token> tmp_tokens;
+    token_stream::text_storage storage;
     std::string delimiters = ",(): ;=><";
-    std::string current_token;
-    u32 line_number = 0;
+    u32 line_number        = 0;
 
-    std::string line;
     bool in_string = false;
     bool escaped   = false;
-    while (std::getline(m_fs, line))
+
+    // tokens are views into the buffer, only merged numbers are copied to the storage of the stream
+    u64 line_begin = 0;
+    while (line_begin < m_buffer.size())
     {
+        auto line_end = m_buffer.find('\n', line_begin);
+        if (line_end == std::string_view::npos)
+        {
+            line_end = m_buffer.size();
+        }
+        auto line  = m_buffer.substr(line_begin, line_end - line_begin);
+        line_begin = line_end + 1;
+
         line_number++;
-        if (line.find("--") != std::string::npos)
+        if (line.find("--") != std::string_view::npos)
         {
             line = line.substr(0, line.find("--"));
         }
-        for (char c : core_utils::trim(line))
+        auto first = line.find_first_not_of(" \t\r\n");
+        if (first == std::string_view::npos)
         {
+            continue;
+        }
+        line = line.substr(first, line.find_last_not_of(" \t\r\n") - first + 1);
+
+        // characters of a token are always adjacent, so the current token is a slice of the line
+        u64 token_begin = 0;
+        for (u64 i = 0; i < line.size(); i++)
+        {
+            char c = line[i];
             if (c == '\\')
             {
                 escaped = !escaped;
@@ -181,48 +209,46 @@ bool hdl_parser_vhdl::tokenize()
             }
             if (delimiters.find(c) == std::string::npos || escaped || in_string)
             {
-                current_token += c;
+                continue;
             }
-            else
+
+            auto current_token = line.substr(token_begin, i - token_begin);
+            token_begin        = i + 1;
+            if (!current_token.empty())
             {
-                if (!current_token.empty())
+                if (tmp_tokens.size() > 1 && is_digits(tmp_tokens.at(tmp_tokens.size() - 2).string) && tmp_tokens.at(tmp_tokens.size() - 1) == "." && is_digits(current_token))
                 {
-                    if (tmp_tokens.size() > 1 && is_digits(tmp_tokens.at(tmp_tokens.size() - 2)) && tmp_tokens.at(tmp_tokens.size() - 1) == "." && is_digits(current_token))
-                    {
-                        tmp_tokens.pop_back();
-                        tmp_tokens.back() += "." + current_token;
-                    }
-                    else
-                    {
-                        tmp_tokens.emplace_back(line_number, current_token, false);
-                    }
-                    current_token.clear();
-                }
-                if (c == '=' && tmp_tokens.at(tmp_tokens.size() - 1) == "<")
-                {
-                    tmp_tokens.at(tmp_tokens.size() - 1) = "<=";
-                }
-                else if (c == '=' && tmp_tokens.at(tmp_tokens.size() - 1) == ":")
-                {
-                    tmp_tokens.at(tmp_tokens.size() - 1) = ":=";
+                    tmp_tokens.pop_back();
+                    tmp_tokens.back() = storage.store(std::string(tmp_tokens.back().string) + "." + std::string(current_token));
                 }
-                else if (c == '>' && tmp_tokens.at(tmp_tokens.size() - 1) == "=")
-                {
-                    tmp_tokens.at(tmp_tokens.size() - 1) = "=>";
-                }
-                else if (!std::isspace(c))
+                else
                 {
-                    tmp_tokens.emplace_back(line_number, std::string(1, c), false);
+                    tmp_tokens.emplace_back(line_number, current_token, false);
                 }
             }
+            if (c == '=' && tmp_tokens.at(tmp_tokens.size() - 1) == "<")
+            {
+                tmp_tokens.at(tmp_tokens.size() - 1) = "<=";
+            }
+            else if (c == '=' && tmp_tokens.at(tmp_tokens.size() - 1) == ":")
+            {
+                tmp_tokens.at(tmp_tokens.size() - 1) = ":=";
+            }
+            else if (c == '>' && tmp_tokens.at(tmp_tokens.size() - 1) == "=")
+            {
+                tmp_tokens.at(tmp_tokens.size() - 1) = "=>";
+            }
+            else if (!std::isspace(c))
+            {
+                tmp_tokens.emplace_back(line_number, line.substr(i, 1), false);
+            }
         }
-        if (!current_token.empty())
+        if (token_begin < line.size())
         {
-            tmp_tokens.emplace_back(line_number, current_token, false);
-            current_token.clear();
+            tmp_tokens.emplace_back(line_number, line.substr(token_begin), false);
         }
     }
-    m_token_stream = token_stream(tmp_tokens, {"("}, {")"});
+    m_token_stream = token_stream(std::move(tmp_tokens), std::move(storage), {"("}, {")"});
     return true;
 }
 
@@ -268,7 +294,7 @@ bool hdl_parser_vhdl::parse_library()
     if (m_token_stream.peek() == "use")
     {
         m_token_stream.consume("use", true);
-        auto lib = m_token_stream.consume().string;
+        std::string lib = m_token_stream.consume();
         m_token_stream.consume(";", true);
 
         // remove specific import like ".all" but keep the "."
@@ -373,7 +399,7 @@ bool hdl_parser_vhdl::parse_architecture_header(entity& e)
         if (m_token_stream.peek() == "signal")
         {
             m_token_stream.consume("signal", true);
-            auto name = m_token_stream.consume().string;
+            std::string name = m_token_stream.consume();
             m_token_stream.consume(":", true);
             auto type = m_token_stream.extract_until(";");
             m_token_stream.consume(";", true);
@@ -472,7 +498,7 @@ bool hdl_parser_vhdl::parse_attribute(std::unordered_map<std::string, std::set<s
 {
     u32 line_number = m_token_stream.peek().number;
     m_token_stream.consume("attribute", true);
-    auto attr_type = m_token_stream.consume().string;
+    std::string attr_type = m_token_stream.consume();
     if (m_token_stream.peek() == ":")
     {
         m_token_stream.consume(":", true);
@@ -486,7 +512,7 @@ bool hdl_parser_vhdl::parse_attribute(std::unordered_map<std::string, std::set<s
         m_token_stream.consume(":", true);
         m_token_stream.consume();
         m_token_stream.consume("is", true);
-        auto value = m_token_stream.join_until(";", " ").string;
+        std::string value = m_token_stream.join_until(";", " ");
         m_token_stream.consume(";", true);
 
         if (value[0] == '"' && value.back() == '"')
@@ -661,7 +687,7 @@ bool hdl_parser_vhdl::build_netlist(const std::string& top_module)
 
     for (const auto& [name, direction] : top_entity.ports)
     {
-        auto new_net                       = m_netlist->create_net(name);
+        auto new_net                       = m_builder->create_net(name);
         m_net_by_name[new_net->get_name()] = new_net;
 
         // for instances, point the ports to the newly generated signals
@@ -838,7 +864,7 @@ std::shared_ptr<module> hdl_parser_vhdl::instantiate(const entity& e, std::share
     {
         // create new net for the signal
         aliases[name] = get_unique_alias(name);
-        auto new_net  = m_netlist->create_net(aliases[name]);
+        auto new_net  = m_builder->create_net(aliases[name]);
         if (new_net == nullptr)
         {
             log_error("hdl_parser", "could not instantiate the net '{}'", name);
@@ -916,8 +942,8 @@ std::shared_ptr<module> hdl_parser_vhdl::instantiate(const entity& e, std::share
     }
 
     // cache global vcc/gnd types
-    auto vcc_gate_types = m_netlist->get_gate_library()->get_vcc_gate_types();
-    auto gnd_gate_types = m_netlist->get_gate_library()->get_gnd_gate_types();
+    const auto& vcc_gate_types = m_netlist->get_gate_library()->get_vcc_gate_types();
+    const auto& gnd_gate_types = m_netlist->get_gate_library()->get_gnd_gate_types();
 
     // process instances i.e. gates or other entities
     for (const auto& inst : e.instances)
@@ -966,14 +992,14 @@ std::shared_ptr<module> hdl_parser_vhdl::instantiate(const entity& e, std::share
 
             std::shared_ptr<gate> new_gate;
             {
-                auto gate_types = m_netlist->get_gate_library()->get_gate_types();
+                const auto& gate_types = m_netlist->get_gate_library()->get_gate_types();
                 auto it         = std::find_if(gate_types.begin(), gate_types.end(), [&](auto& v) { return core_utils::equals_ignore_case(v.first, inst.type); });
                 if (it == gate_types.end())
                 {
                     log_error("hdl_parser", "could not find gate type '{}' in gate library", inst.type);
                     return nullptr;
                 }
-                new_gate = m_netlist->create_gate(it->second, aliases[inst.name]);
+                new_gate = m_builder->create_gate(it->second, aliases[inst.name]);
             }
 
             if (new_gate == nullptr)
@@ -981,7 +1007,7 @@ std::shared_ptr<module> hdl_parser_vhdl::instantiate(const entity& e, std::share
                 log_error("hdl_parser", "could not instantiate gate '{}'", inst.name);
                 return nullptr;
             }
-            module->assign_gate(new_gate);
+            m_builder->assign_gate(module, new_gate);
             container = new_gate.get();
 
             // if gate is a global type, register it as such
@@ -1026,7 +1052,7 @@ std::shared_ptr<module> hdl_parser_vhdl::instantiate(const entity& e, std::share
                     {
                         log_warning("hdl_parser", "creating undeclared signal '{}' assigned to port '{}' of instance '{}' (starting at line {})", net_name, pin, inst.name, inst.line_number);
 
-                        current_net                            = m_netlist->create_net(net_name);
+                        current_net                            = m_builder->create_net(net_name);
                         m_net_by_name[current_net->get_name()] = current_net;
                     }
                     else
@@ -1076,13 +1102,13 @@ std::shared_ptr<module> hdl_parser_vhdl::instantiate(const entity& e, std::share
                                   new_gate->get_name(),
                                   new_gate->get_type()->get_name());
                     }
-                    if (!current_net->set_src(new_gate, pin))
+                    if (!m_builder->set_src(current_net, new_gate, pin))
                     {
                         return nullptr;
                     }
                 }
 
-                if (is_input && !current_net->add_dst(new_gate, pin))
+                if (is_input && !m_builder->add_dst(current_net, new_gate, pin))
                 {
                     return nullptr;
                 }
@@ -1174,25 +1200,20 @@ std::string hdl_parser_vhdl::get_hex_from_number_literal(const std::string& v)
         return core_utils::to_lower(value);
     }
     // Conversion required
-    int radix = 10;
     if (core_utils::starts_with(value, "D\"", true))
     {
-        radix = 10;
         value = value.substr(2);
     }
+    // numbers are converted digit by digit, so their width is not limited
     if (core_utils::starts_with(value, "B\"", true))
     {
-        radix = 2;
-        value = value.substr(2);
+        return get_hex_from_bits(get_bits_from_digits(value.substr(2), 2));
     }
     if (core_utils::starts_with(value, "O\"", true))
     {
-        radix = 8;
-        value = value.substr(2);
+        return get_hex_from_bits(get_bits_from_digits(value.substr(2), 8));
     }
-    std::stringstream ss;
-    ss << std::hex << stoull(value, 0, radix);
-    return ss.str();
+    return get_hex_from_bits(get_bits_from_digits(value, 10));
 }
 
 std::vector<std::string> hdl_parser_vhdl::get_vector_signals(const std::string& base_name, token_stream& type)
@@ -1310,8 +1331,8 @@ std::unordered_map<std::string, std::string> hdl_parser_vhdl::get_assignments(to
     //      a(x, y, z) => ...
     // (3): a(x to y) => B"01010101..."
     // (4): a(x to y) => b(s to t)
-    auto left_base_name  = lhs.at(0).string;
-    auto right_base_name = rhs.at(0).string;
+    std::string left_base_name  = lhs.at(0);
+    std::string right_base_name = rhs.at(0);
 
     // case (1)
     if (lhs.size() == 1)
@@ -1354,14 +1375,14 @@ std::unordered_map<std::string, std::string> hdl_parser_vhdl::get_assignments(to
             // case (3)
             token_stream tmp(rhs);
             // right part has to be a bitvector
-            if (rhs.size() != 1 || !core_utils::starts_with(rhs.at(0).string, "B\"", true))
+            if (rhs.size() != 1 || !core_utils::starts_with(rhs.at(0), "B\"", true))
             {
                 log_error("hdl_parser", "assignment of anything but a binary bitvector is not supported (line {})", lhs.at(0).number);
                 return {};
             }
 
             // extract value
-            std::string right_values = rhs.at(0).string.substr(2, rhs.at(0).string.size() - 3);
+            std::string right_values = std::string(rhs.at(0).string.substr(2, rhs.at(0).string.size() - 3));
 
             // assemble assignment strings
             std::unordered_map<std::string, std::string> result;
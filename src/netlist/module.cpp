@@ -162,43 +162,37 @@ bool module::remove_gate(std::shared_ptr<gate> gate)
 
 bool module::contains_gate(std::shared_ptr<gate> const gate, bool recursive) const
 {
-    if (gate == nullptr)
+    if (gate == nullptr || !m_internal_manager->m_netlist->is_gate_in_netlist(gate))
     {
         return false;
     }
-    bool success = (m_gates_set.find(gate) != m_gates_set.end());
-    if (!success && recursive)
+    auto m = gate->get_module();
+    if (m.get() == this)
     {
-        for (const auto& sm : m_submodules_set)
+        return true;
+    }
+    if (recursive)
+    {
+        // the gate is contained recursively iff this module is an ancestor of the gate's module
+        for (m = m->m_parent; m != nullptr; m = m->m_parent)
         {
-            if (sm->contains_gate(gate, true))
+            if (m.get() == this)
             {
                 return true;
             }
         }
     }
-    return success;
+    return false;
 }
 
 std::shared_ptr<gate> module::get_gate_by_id(const u32 gate_id, bool recursive) const
 {
-    auto it = m_gates_map.find(gate_id);
-    if (it == m_gates_map.end())
+    auto g = m_internal_manager->m_netlist->get_gate_by_id(gate_id);
+    if (!contains_gate(g, recursive))
     {
-        if (recursive)
-        {
-            for (const auto& sm : m_submodules_set)
-            {
-                auto res = sm->get_gate_by_id(gate_id, true);
-                if (res != nullptr)
-                {
-                    return res;
-                }
-            }
-        }
         return nullptr;
     }
-    return it->second;
+    return g;
 }
 
 std::set<std::shared_ptr<gate>> module::get_gates(const std::function<bool(const std::shared_ptr<gate>&)>& filter, bool recursive) const
@@ -210,9 +204,8 @@ std::set<std::shared_ptr<gate>> module::get_gates(const std::function<bool(const
     }
     else
     {
-        for (const auto& it : m_gates_map)
+        for (const auto& current_gate : m_gates_set)
         {
-            auto current_gate = it.second;
             if (!filter(current_gate))
             {
                 continue;
@@ -3,6 +3,7 @@
 #include "netlist/gate.h"
 #include "netlist/module.h"
 #include "netlist/net.h"
+#include "netlist/netlist_graph_snapshot.h"
 #include "netlist/netlist_internal_manager.h"
 
 #include "netlist/event_system/netlist_event_handler.h"
@@ -13,9 +14,6 @@ netlist::netlist(std::shared_ptr<gate_library> library) : m_gate_library(library
 {
     m_manager        = new netlist_internal_manager(this);
     m_netlist_id     = 1;
-    m_next_gate_id   = 1;
-    m_next_net_id    = 1;
-    m_next_module_id = 1;
     m_top_module     = nullptr;    // this triggers the internal manager to allow creation of a module without parent
     m_top_module     = create_module("top module", nullptr);
 }
@@ -99,15 +97,7 @@ std::shared_ptr<gate_library> netlist::get_gate_library() const
 
 u32 netlist::get_unique_module_id()
 {
-    if (!m_free_module_ids.empty())
-    {
-        return *(m_free_module_ids.begin());
-    }
-    while (m_used_module_ids.find(m_next_module_id) != m_used_module_ids.end())
-    {
-        m_next_module_id++;
-    }
-    return m_next_module_id;
+    return m_modules.get_unique_id();
 }
 
 std::shared_ptr<module> netlist::create_module(const u32 id, const std::string& name, std::shared_ptr<module> parent, const std::vector<std::shared_ptr<gate>>& gates)
@@ -137,28 +127,23 @@ std::shared_ptr<module> netlist::get_top_module()
 
 std::shared_ptr<module> netlist::get_module_by_id(u32 id) const
 {
-    auto it = m_modules.find(id);
-    if (it == m_modules.end())
+    auto m = m_modules.get(id);
+    if (m == nullptr)
     {
         log_error("netlist", "there is no module with id = {}.", id);
-        return nullptr;
     }
-    return it->second;
+    return m;
 }
 
 std::set<std::shared_ptr<module>> netlist::get_modules() const
 {
-    std::set<std::shared_ptr<module>> res;
-    for (const auto& it : m_modules)
-    {
-        res.insert(it.second);
-    }
-    return res;
+    const auto& modules = m_modules.elements();
+    return std::set<std::shared_ptr<module>>(modules.begin(), modules.end());
 }
 
 bool netlist::is_module_in_netlist(const std::shared_ptr<module> module) const
 {
-    return (module != nullptr) && (module->get_netlist() == shared_from_this()) && (m_modules.find(module->get_id()) != m_modules.end());
+    return (module != nullptr) && (module->get_netlist() == shared_from_this()) && m_modules.contains_element(module->get_id(), module);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -168,15 +153,7 @@ bool netlist::is_module_in_netlist(const std::shared_ptr<module> module) const
 
 u32 netlist::get_unique_gate_id()
 {
-    if (!m_free_gate_ids.empty())
-    {
-        return *(m_free_gate_ids.begin());
-    }
-    while (m_used_gate_ids.find(m_next_gate_id) != m_used_gate_ids.end())
-    {
-        m_next_gate_id++;
-    }
-    return m_next_gate_id;
+    return m_gates.get_unique_id();
 }
 
 std::shared_ptr<gate> netlist::create_gate(const u32 id, std::shared_ptr<const gate_type> gt, const std::string& name, float x, float y)
@@ -196,17 +173,44 @@ bool netlist::delete_gate(std::shared_ptr<gate> gate)
 
 bool netlist::is_gate_in_netlist(std::shared_ptr<gate> const gate) const
 {
-    return m_top_module->contains_gate(gate, true);
+    return (gate != nullptr) && m_gates.contains_element(gate->get_id(), gate);
 }
 
 std::shared_ptr<gate> netlist::get_gate_by_id(const u32 gate_id) const
 {
-    return m_top_module->get_gate_by_id(gate_id, true);
+    return m_gates.get(gate_id);
 }
 
 std::set<std::shared_ptr<gate>> netlist::get_gates(const std::function<bool(const std::shared_ptr<gate>&)>& filter) const
 {
-    return m_top_module->get_gates(filter, true);
+    const auto& gates = m_gates.elements();
+    if (!filter)
+    {
+        return std::set<std::shared_ptr<gate>>(gates.begin(), gates.end());
+    }
+    std::set<std::shared_ptr<gate>> res;
+    for (const auto& g : gates)
+    {
+        if (!filter(g))
+        {
+            continue;
+        }
+        res.insert(g);
+    }
+    return res;
+}
+
+u32 netlist::get_num_of_gates() const
+{
+    return m_gates.size();
+}
+
+void netlist::for_each_gate(const std::function<void(const std::shared_ptr<gate>&)>& callback) const
+{
+    for (const auto& g : m_gates.elements())
+    {
+        callback(g);
+    }
 }
 
 bool netlist::mark_vcc_gate(const std::shared_ptr<gate> gate)
@@ -302,15 +306,7 @@ std::set<std::shared_ptr<gate>> netlist::get_gnd_gates() const
 
 u32 netlist::get_unique_net_id()
 {
-    if (!m_free_net_ids.empty())
-    {
-        return *(m_free_net_ids.begin());
-    }
-    while (m_used_net_ids.find(m_next_net_id) != m_used_net_ids.end())
-    {
-        m_next_net_id++;
-    }
-    return m_next_net_id;
+    return m_nets.get_unique_id();
 }
 
 std::shared_ptr<net> netlist::create_net(const u32 id, const std::string& name)
@@ -330,28 +326,28 @@ bool netlist::delete_net(std::shared_ptr<net> n)
 
 bool netlist::is_net_in_netlist(const std::shared_ptr<net> n) const
 {
-    return m_nets_set.find(n) != m_nets_set.end();
+    return (n != nullptr) && m_nets.contains_element(n->get_id(), n);
 }
 
 std::shared_ptr<net> netlist::get_net_by_id(u32 net_id) const
 {
-    auto it = m_nets_map.find(net_id);
-    if (it == m_nets_map.end())
+    auto n = m_nets.get(net_id);
+    if (n == nullptr)
     {
         log_error("netlist", "no net with id {:08x} registered in netlist.", net_id);
-        return nullptr;
     }
-    return it->second;
+    return n;
 }
 
 std::unordered_set<std::shared_ptr<net>> netlist::get_nets(const std::function<bool(const std::shared_ptr<net>&)>& filter) const
 {
+    const auto& nets = m_nets.elements();
     if (!filter)
     {
-        return m_nets_set;
+        return std::unordered_set<std::shared_ptr<net>>(nets.begin(), nets.end());
     }
     std::unordered_set<std::shared_ptr<net>> res;
-    for (const auto& net : m_nets_set)
+    for (const auto& net : nets)
     {
         if (!filter(net))
         {
@@ -461,3 +457,19 @@ std::set<std::shared_ptr<net>> netlist::get_global_output_nets() const
 {
     return m_global_output_nets;
 }
+
+/*
+ * ################################################################
+ *      graph functions
+ * ################################################################
+ */
+
+std::shared_ptr<const netlist_graph_snapshot> netlist::get_graph_snapshot()
+{
+    std::lock_guard<std::mutex> lock(m_graph_snapshot_mutex);
+    if (m_graph_snapshot == nullptr)
+    {
+        m_graph_snapshot = std::make_shared<const netlist_graph_snapshot>(shared_from_this());
+    }
+    return m_graph_snapshot;
+}
@@ -0,0 +1,235 @@
+#include "netlist/netlist_builder.h"
+
+#include "netlist/gate.h"
+#include "netlist/module.h"
+#include "netlist/net.h"
+#include "netlist/netlist.h"
+
+#include "netlist/event_system/netlist_event_handler.h"
+
+#include "core/log.h"
+#include "core/utils.h"
+
+netlist_builder::netlist_builder(const std::shared_ptr<netlist>& nl)
+{
+    m_netlist = nl;
+    m_pending = false;
+}
+
+netlist_builder::~netlist_builder()
+{
+    commit();
+}
+
+void netlist_builder::reserve(u32 num_gates, u32 num_nets)
+{
+    m_netlist->m_gates.reserve(m_netlist->m_gates.size() + num_gates);
+    m_netlist->m_nets.reserve(m_netlist->m_nets.size() + num_nets);
+}
+
+bool netlist_builder::is_gate_type_valid(const std::shared_ptr<const gate_type>& gt)
+{
+    if (gt == nullptr)
+    {
+        return false;
+    }
+    if (m_valid_gate_types.find(gt.get()) != m_valid_gate_types.end())
+    {
+        return true;
+    }
+
+    const auto& gate_types = m_netlist->m_gate_library->get_gate_types();
+    auto it                = gate_types.find(gt->get_name());
+    if (it == gate_types.end() || (it->second != gt && *(it->second) != *gt))
+    {
+        return false;
+    }
+
+    m_valid_gate_types.insert(gt.get());
+    return true;
+}
+
+std::shared_ptr<gate> netlist_builder::create_gate(u32 id, const std::shared_ptr<const gate_type>& gt, const std::string& name, float x, float y)
+{
+    if (id == 0)
+    {
+        log_error("netlist", "netlist_builder::create_gate: id 0 represents 'invalid ID'.");
+        return nullptr;
+    }
+    if (!is_gate_type_valid(gt))
+    {
+        log_error("netlist", "netlist_builder::create_gate: gate type '{}' is invalid.", (gt == nullptr) ? "nullptr" : gt->get_name());
+        return nullptr;
+    }
+    if (core_utils::trim(name).empty())
+    {
+        log_error("netlist", "netlist_builder::create_gate: empty name is not allowed");
+        return nullptr;
+    }
+
+    auto new_gate = std::shared_ptr<gate>(new gate(m_netlist, id, gt, name, x, y));
+
+    if (!m_netlist->m_gates.insert(id, new_gate))
+    {
+        log_error("netlist", "netlist_builder::create_gate: gate id {:08x} is already taken.", id);
+        return nullptr;
+    }
+
+    new_gate->m_module = m_netlist->m_top_module;
+    m_netlist->m_top_module->m_gates_set.insert(new_gate);
+
+    m_netlist->m_graph_snapshot.reset();
+    m_pending = true;
+
+    return new_gate;
+}
+
+std::shared_ptr<gate> netlist_builder::create_gate(const std::shared_ptr<const gate_type>& gt, const std::string& name, float x, float y)
+{
+    return create_gate(m_netlist->get_unique_gate_id(), gt, name, x, y);
+}
+
+std::shared_ptr<net> netlist_builder::create_net(u32 id, const std::string& name)
+{
+    if (id == 0)
+    {
+        log_error("netlist", "netlist_builder::create_net: id 0 represents 'invalid ID'.");
+        return nullptr;
+    }
+    if (core_utils::trim(name).empty())
+    {
+        log_error("netlist", "netlist_builder::create_net: empty name is not allowed");
+        return nullptr;
+    }
+
+    auto new_net = std::shared_ptr<net>(new net(m_netlist->m_manager, id, name));
+
+    if (!m_netlist->m_nets.insert(id, new_net))
+    {
+        log_error("netlist", "netlist_builder::create_net: net id {:08x} is already taken.", id);
+        return nullptr;
+    }
+
+    m_netlist->m_graph_snapshot.reset();
+    m_pending = true;
+
+    return new_net;
+}
+
+std::shared_ptr<net> netlist_builder::create_net(const std::string& name)
+{
+    return create_net(m_netlist->get_unique_net_id(), name);
+}
+
+bool netlist_builder::set_src(const std::shared_ptr<net>& n, const std::shared_ptr<gate>& g, const std::string& pin_type)
+{
+    if (n == nullptr || g == nullptr)
+    {
+        return false;
+    }
+
+    auto pin_index = g->m_type->get_output_pin_index(pin_type);
+    if (pin_index == gate_type::invalid_pin_index)
+    {
+        log_error("netlist", "netlist_builder::set_src: src gate ('{}', type = {}) has no output type '{}'.", g->get_name(), g->m_type->get_name(), pin_type);
+        return false;
+    }
+    if (pin_index >= g->m_out_nets.size())
+    {
+        g->m_out_nets.resize(pin_index + 1);
+    }
+    if (g->m_out_nets[pin_index] != nullptr && g->m_out_nets[pin_index] != n)
+    {
+        log_error("netlist", "netlist_builder::set_src: src gate ('{}', {}) has already associated net '{}'.", g->get_name(), pin_type, g->m_out_nets[pin_index]->get_name());
+        return false;
+    }
+
+    // replace a previously assigned src
+    if (const auto& old_src = n->m_src; old_src.gate != nullptr)
+    {
+        auto old_pin_index = old_src.gate->m_type->get_output_pin_index(old_src.get_pin_type());
+        if (old_pin_index < old_src.gate->m_out_nets.size())
+        {
+            old_src.gate->m_out_nets[old_pin_index] = nullptr;
+        }
+    }
+
+    n->m_src                 = {g, pin_type};
+    g->m_out_nets[pin_index] = n;
+
+    m_netlist->m_graph_snapshot.reset();
+    m_pending = true;
+
+    return true;
+}
+
+bool netlist_builder::add_dst(const std::shared_ptr<net>& n, const std::shared_ptr<gate>& g, const std::string& pin_type)
+{
+    if (n == nullptr || g == nullptr)
+    {
+        return false;
+    }
+
+    auto pin_index = g->m_type->get_input_pin_index(pin_type);
+    if (pin_index == gate_type::invalid_pin_index)
+    {
+        log_error("netlist", "netlist_builder::add_dst: dst gate ('{}', type = {}) has no input type '{}'.", g->get_name(), g->m_type->get_name(), pin_type);
+        return false;
+    }
+    if (pin_index >= g->m_in_nets.size())
+    {
+        g->m_in_nets.resize(pin_index + 1);
+    }
+
+    // an occupied input pin also covers the case of the endpoint already being a dst of this net
+    if (g->m_in_nets[pin_index] != nullptr)
+    {
+        log_error("netlist",
+                  "netlist_builder::add_dst: dst gate ('{}', type = {}) has already an assigned net '{}' for pin '{}' (new_net: {}).",
+                  g->get_name(),
+                  g->m_type->get_name(),
+                  g->m_in_nets[pin_index]->get_name(),
+                  pin_type,
+                  n->get_name());
+        return false;
+    }
+
+    n->m_dsts.emplace_back(g, pin_type);
+    g->m_in_nets[pin_index] = n;
+
+    m_netlist->m_graph_snapshot.reset();
+    m_pending = true;
+
+    return true;
+}
+
+bool netlist_builder::assign_gate(const std::shared_ptr<module>& m, const std::shared_ptr<gate>& g)
+{
+    if (m == nullptr || g == nullptr)
+    {
+        return false;
+    }
+    if (g->m_module == m)
+    {
+        return false;
+    }
+
+    g->m_module->m_gates_set.erase(g);
+    m->m_gates_set.insert(g);
+    g->m_module = m;
+
+    m_pending = true;
+
+    return true;
+}
+
+void netlist_builder::commit()
+{
+    if (!m_pending)
+    {
+        return;
+    }
+    m_pending = false;
+
+    netlist_event_handler::notify(netlist_event_handler::event::bulk_changes_committed, m_netlist);
+}
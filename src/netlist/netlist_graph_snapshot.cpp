@@ -0,0 +1,163 @@
+#include "netlist/netlist_graph_snapshot.h"
+
+#include "netlist/gate.h"
+#include "netlist/net.h"
+#include "netlist/netlist.h"
+
+netlist_graph_snapshot::netlist_graph_snapshot(const std::shared_ptr<netlist>& nl)
+{
+    m_gates = nl->m_gates.elements();
+    m_nets  = nl->m_nets.elements();
+
+    m_gate_index_by_id.reserve(m_gates.size());
+    for (u32 i = 0; i < m_gates.size(); ++i)
+    {
+        m_gate_index_by_id.emplace(m_gates[i]->get_id(), i);
+    }
+    m_net_index_by_id.reserve(m_nets.size());
+    for (u32 i = 0; i < m_nets.size(); ++i)
+    {
+        m_net_index_by_id.emplace(m_nets[i]->get_id(), i);
+    }
+
+    u32 num_gates = m_gates.size();
+
+    m_fan_in_offsets.reserve(num_gates + 1);
+    m_fan_out_offsets.reserve(num_gates + 1);
+    m_predecessor_offsets.reserve(num_gates + 1);
+    m_successor_offsets.assign(num_gates + 1, 0);
+
+    // gate-to-net connections and incoming edges, the outgoing edges are counted along the way
+    for (const auto& g : m_gates)
+    {
+        m_fan_in_offsets.push_back(m_fan_in_nets.size());
+        m_fan_out_offsets.push_back(m_fan_out_nets.size());
+        m_predecessor_offsets.push_back(m_predecessors.size());
+
+        for (u32 pin = 0; pin < g->m_out_nets.size(); ++pin)
+        {
+            if (const auto& n = g->m_out_nets[pin]; n != nullptr)
+            {
+                m_fan_out_nets.push_back({pin, m_net_index_by_id.at(n->get_id())});
+            }
+        }
+
+        for (u32 pin = 0; pin < g->m_in_nets.size(); ++pin)
+        {
+            const auto& n = g->m_in_nets[pin];
+            if (n == nullptr)
+            {
+                continue;
+            }
+            u32 net_index = m_net_index_by_id.at(n->get_id());
+            m_fan_in_nets.push_back({pin, net_index});
+
+            const auto& src_gate = n->m_src.gate;
+            if (src_gate == nullptr)
+            {
+                continue;
+            }
+
+            // gates rarely have more than a handful of outputs, so a scan is cheaper than a name lookup
+            u32 src_pin = 0;
+            while (src_pin < src_gate->m_out_nets.size() && src_gate->m_out_nets[src_pin] != n)
+            {
+                ++src_pin;
+            }
+
+            u32 src_index = m_gate_index_by_id.at(src_gate->get_id());
+            m_predecessors.push_back({src_index, net_index, src_pin, pin});
+            ++m_successor_offsets[src_index + 1];
+        }
+    }
+    m_fan_in_offsets.push_back(m_fan_in_nets.size());
+    m_fan_out_offsets.push_back(m_fan_out_nets.size());
+    m_predecessor_offsets.push_back(m_predecessors.size());
+
+    // outgoing edges are the transposed incoming edges
+    for (u32 i = 0; i < num_gates; ++i)
+    {
+        m_successor_offsets[i + 1] += m_successor_offsets[i];
+    }
+    m_successors.resize(m_predecessors.size());
+    std::vector<u32> fill_position(m_successor_offsets.begin(), m_successor_offsets.end() - 1);
+    for (u32 dst_index = 0; dst_index < num_gates; ++dst_index)
+    {
+        for (u32 i = m_predecessor_offsets[dst_index]; i < m_predecessor_offsets[dst_index + 1]; ++i)
+        {
+            const auto& e                        = m_predecessors[i];
+            m_successors[fill_position[e.gate]++] = {dst_index, e.net, e.src_pin, e.dst_pin};
+        }
+    }
+}
+
+u32 netlist_graph_snapshot::get_num_of_gates() const
+{
+    return m_gates.size();
+}
+
+u32 netlist_graph_snapshot::get_num_of_nets() const
+{
+    return m_nets.size();
+}
+
+u32 netlist_graph_snapshot::get_num_of_edges() const
+{
+    return m_successors.size();
+}
+
+const std::shared_ptr<gate>& netlist_graph_snapshot::get_gate(u32 index) const
+{
+    return m_gates[index];
+}
+
+const std::shared_ptr<net>& netlist_graph_snapshot::get_net(u32 index) const
+{
+    return m_nets[index];
+}
+
+u32 netlist_graph_snapshot::get_gate_index(const std::shared_ptr<gate>& g) const
+{
+    if (g == nullptr)
+    {
+        return invalid_index;
+    }
+    if (auto it = m_gate_index_by_id.find(g->get_id()); it != m_gate_index_by_id.end() && m_gates[it->second] == g)
+    {
+        return it->second;
+    }
+    return invalid_index;
+}
+
+u32 netlist_graph_snapshot::get_net_index(const std::shared_ptr<net>& n) const
+{
+    if (n == nullptr)
+    {
+        return invalid_index;
+    }
+    if (auto it = m_net_index_by_id.find(n->get_id()); it != m_net_index_by_id.end() && m_nets[it->second] == n)
+    {
+        return it->second;
+    }
+    return invalid_index;
+}
+
+netlist_graph_snapshot::range<netlist_graph_snapshot::edge> netlist_graph_snapshot::get_successors(u32 index) const
+{
+    return range<edge>(m_successors.data() + m_successor_offsets[index], m_successors.data() + m_successor_offsets[index + 1]);
+}
+
+netlist_graph_snapshot::range<netlist_graph_snapshot::edge> netlist_graph_snapshot::get_predecessors(u32 index) const
+{
+    return range<edge>(m_predecessors.data() + m_predecessor_offsets[index], m_predecessors.data() + m_predecessor_offsets[index + 1]);
+}
+
+netlist_graph_snapshot::range<netlist_graph_snapshot::pin_net> netlist_graph_snapshot::get_fan_in_nets(u32 index) const
+{
+    return range<pin_net>(m_fan_in_nets.data() + m_fan_in_offsets[index], m_fan_in_nets.data() + m_fan_in_offsets[index + 1]);
+}
+
+netlist_graph_snapshot::range<netlist_graph_snapshot::pin_net> netlist_graph_snapshot::get_fan_out_nets(u32 index) const
+{
+    return range<pin_net>(m_fan_out_nets.data() + m_fan_out_offsets[index], m_fan_out_nets.data() + m_fan_out_offsets[index + 1]);
+}
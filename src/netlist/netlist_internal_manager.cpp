@@ -28,7 +28,7 @@ std::shared_ptr<gate> netlist_internal_manager::create_gate(const u32 id, const
         log_error("netlist.internal", "netlist::create_gate: id 0 represents 'invalid ID'.");
         return nullptr;
     }
-    if (m_netlist->m_used_gate_ids.find(id) != m_netlist->m_used_gate_ids.end())
+    if (m_netlist->m_gates.contains(id))
     {
         log_error("netlist.internal", "netlist::create_gate: gate id {:08x} is already taken.", id);
         return nullptr;
@@ -46,19 +46,15 @@ std::shared_ptr<gate> netlist_internal_manager::create_gate(const u32 id, const
 
     auto new_gate = std::shared_ptr<gate>(new gate(m_netlist->get_shared(), id, gt, name, x, y));
 
-    auto free_id_it = m_netlist->m_free_gate_ids.find(id);
-    if (free_id_it != m_netlist->m_free_gate_ids.end())
-    {
-        m_netlist->m_free_gate_ids.erase(free_id_it);
-    }
-
-    m_netlist->m_used_gate_ids.insert(id);
+    // add gate to netlist
+    m_netlist->m_gates.insert(id, new_gate);
 
     // add gate to top module
-    new_gate->m_module                       = m_netlist->m_top_module;
-    m_netlist->m_top_module->m_gates_map[id] = new_gate;
+    new_gate->m_module = m_netlist->m_top_module;
     m_netlist->m_top_module->m_gates_set.insert(new_gate);
 
+    m_netlist->m_graph_snapshot.reset();
+
     // notify
     module_event_handler::notify(module_event_handler::event::gate_assigned, m_netlist->m_top_module, id);
     gate_event_handler::notify(gate_event_handler::event::created, new_gate);
@@ -96,13 +92,12 @@ bool netlist_internal_manager::delete_gate(std::shared_ptr<gate> gate)
     m_netlist->unmark_vcc_gate(gate);
 
     // remove gate from modules
-    gate->m_module->m_gates_map.erase(gate->m_module->m_gates_map.find(gate->get_id()));
     gate->m_module->m_gates_set.erase(gate);
 
-    // free ids
-    m_netlist->m_free_gate_ids.insert(gate->get_id());
-    m_netlist->m_used_gate_ids.erase(gate->get_id());
+    // remove gate from netlist, this also frees the id
+    m_netlist->m_gates.erase(gate->get_id());
 
+    m_netlist->m_graph_snapshot.reset();
     module_event_handler::notify(module_event_handler::event::gate_removed, gate->m_module, gate->get_id());
     gate_event_handler::notify(gate_event_handler::event::removed, gate);
 
@@ -131,7 +126,7 @@ std::shared_ptr<net> netlist_internal_manager::create_net(const u32 id, const st
         log_error("netlist.internal", "netlist::create_net: id 0 represents 'invalid ID'.");
         return nullptr;
     }
-    if (m_netlist->m_used_net_ids.find(id) != m_netlist->m_used_net_ids.end())
+    if (m_netlist->m_nets.contains(id))
     {
         log_error("netlist.internal", "netlist::create_net: net id {:08x} is already taken.", id);
         return nullptr;
@@ -144,17 +139,10 @@ std::shared_ptr<net> netlist_internal_manager::create_net(const u32 id, const st
 
     auto new_net = std::shared_ptr<net>(new net(this, id, name));
 
-    auto free_id_it = m_netlist->m_free_net_ids.find(id);
-    if (free_id_it != m_netlist->m_free_net_ids.end())
-    {
-        m_netlist->m_free_net_ids.erase(free_id_it);
-    }
-
-    m_netlist->m_used_net_ids.insert(id);
-
     // add net to netlist
-    m_netlist->m_nets_map[id] = new_net;
-    m_netlist->m_nets_set.insert(new_net);
+    m_netlist->m_nets.insert(id, new_net);
+
+    m_netlist->m_graph_snapshot.reset();
 
     // notify
     net_event_handler::notify(net_event_handler::event::created, new_net);
@@ -187,13 +175,10 @@ bool netlist_internal_manager::delete_net(const std::shared_ptr<net>& net)
     m_netlist->unmark_global_input_net(net);
     m_netlist->unmark_global_output_net(net);
 
-    // remove net from netlist
-    m_netlist->m_nets_map.erase(m_netlist->m_nets_map.find(net->get_id()));
-    m_netlist->m_nets_set.erase(net);
-
-    m_netlist->m_free_net_ids.insert(net->get_id());
-    m_netlist->m_used_net_ids.erase(net->get_id());
+    // remove net from netlist, this also frees the id
+    m_netlist->m_nets.erase(net->get_id());
 
+    m_netlist->m_graph_snapshot.reset();
     net_event_handler::notify(net_event_handler::event::removed, net);
 
     return true;
@@ -207,10 +192,10 @@ bool netlist_internal_manager::net_set_src(const std::shared_ptr<net>& net, cons
     }
 
     // check whether pin is valid for this gate
-    auto output_pins = src.gate->get_type()->get_output_pins();
-    if ((std::find(output_pins.begin(), output_pins.end(), src.pin_type) == output_pins.end()))
+    auto pin_index = src.gate->get_type()->get_output_pin_index(src.get_pin_type());
+    if (pin_index == gate_type::invalid_pin_index)
     {
-        log_error("netlist.internal", "net::set_src: src gate ('{}, type = {}) has no output type '{}'.", src.gate->get_name(), src.gate->get_type()->get_name(), src.pin_type);
+        log_error("netlist.internal", "net::set_src: src gate ('{}, type = {}) has no output type '{}'.", src.gate->get_name(), src.gate->get_type()->get_name(), src.get_pin_type());
         return false;
     }
 
@@ -222,7 +207,7 @@ bool netlist_internal_manager::net_set_src(const std::shared_ptr<net>& net, cons
             log_error("netlist.internal",
                       "net::set_src: src gate ('{}', {}) has already associated net '{}'. Cannot assign {} as new src.",
                       src.gate->get_name(),
-                      src.pin_type,
+                      src.get_pin_type(),
                       out_net->get_name(),
                       net->get_name());
             return false;
@@ -235,9 +220,15 @@ bool netlist_internal_manager::net_set_src(const std::shared_ptr<net>& net, cons
         return false;
     }
 
-    net->m_src                         = src;
-    src.gate->m_out_nets[src.pin_type] = net;
+    if (pin_index >= src.gate->m_out_nets.size())
+    {
+        src.gate->m_out_nets.resize(pin_index + 1);
+    }
+
+    net->m_src                      = src;
+    src.gate->m_out_nets[pin_index] = net;
 
+    m_netlist->m_graph_snapshot.reset();
     net_event_handler::notify(net_event_handler::event::src_changed, net);
 
     return true;
@@ -258,9 +249,14 @@ bool netlist_internal_manager::net_remove_src(const std::shared_ptr<net>& net)
 
     auto old_src = net->m_src;
 
-    net->m_src.gate->m_out_nets.erase(net->m_src.pin_type);
+    auto pin_index = old_src.gate->get_type()->get_output_pin_index(old_src.get_pin_type());
+    if (pin_index < old_src.gate->m_out_nets.size())
+    {
+        old_src.gate->m_out_nets[pin_index] = nullptr;
+    }
     net->m_src = {nullptr, ""};
 
+    m_netlist->m_graph_snapshot.reset();
     net_event_handler::notify(net_event_handler::event::src_changed, net);
 
     return true;
@@ -280,30 +276,36 @@ bool netlist_internal_manager::net_add_dst(const std::shared_ptr<net>& net, cons
     }
 
     // check whether pin id is valid for this gate
-    auto input_pins = dst.gate->get_type()->get_input_pins();
+    auto pin_index = dst.gate->get_type()->get_input_pin_index(dst.get_pin_type());
 
-    if ((std::find(input_pins.begin(), input_pins.end(), dst.pin_type) == input_pins.end()))
+    if (pin_index == gate_type::invalid_pin_index)
     {
-        log_error("netlist.internal", "net::add_dst: dst gate ('{}',  type = {}) has no input type '{}'.", dst.gate->get_name(), dst.gate->get_type()->get_name(), dst.pin_type);
+        log_error("netlist.internal", "net::add_dst: dst gate ('{}',  type = {}) has no input type '{}'.", dst.gate->get_name(), dst.gate->get_type()->get_name(), dst.get_pin_type());
         return false;
     }
 
+    if (pin_index >= dst.gate->m_in_nets.size())
+    {
+        dst.gate->m_in_nets.resize(pin_index + 1);
+    }
+
     // check whether dst has already assigned src
-    if (dst.gate->get_fan_in_net(dst.pin_type) != nullptr)
+    if (dst.gate->m_in_nets[pin_index] != nullptr)
     {
         log_error("netlist.internal",
                   "net::add_dst: dst gate ('{}', type = {}) has already an assigned net '{}' for pin '{}' (new_net: {}).",
                   dst.gate->get_name(),
                   dst.gate->get_type()->get_name(),
-                  dst.gate->get_fan_in_net(dst.pin_type)->get_name(),
-                  dst.pin_type,
+                  dst.gate->m_in_nets[pin_index]->get_name(),
+                  dst.get_pin_type(),
                   net->get_name());
         return false;
     }
 
     net->m_dsts.push_back(dst);
-    dst.gate->m_in_nets[dst.pin_type] = net;
+    dst.gate->m_in_nets[pin_index] = net;
 
+    m_netlist->m_graph_snapshot.reset();
     net_event_handler::notify(net_event_handler::event::dst_added, net, dst.gate->get_id());
 
     return true;
@@ -320,8 +322,13 @@ bool netlist_internal_manager::net_remove_dst(const std::shared_ptr<net>& net, c
 
     if (it != net->m_dsts.end())
     {
-        (*it).gate->m_in_nets.erase((*it).pin_type);
+        auto pin_index = dst.gate->get_type()->get_input_pin_index(dst.get_pin_type());
+        if (pin_index < dst.gate->m_in_nets.size())
+        {
+            dst.gate->m_in_nets[pin_index] = nullptr;
+        }
         net->m_dsts.erase(it);
+        m_netlist->m_graph_snapshot.reset();
         net_event_handler::notify(net_event_handler::event::dst_removed, net, dst.gate->get_id());
     }
 
@@ -339,7 +346,7 @@ std::shared_ptr<module> netlist_internal_manager::create_module(const u32 id, co
         log_error("netlist.internal", "netlist::create_module: id 0 represents 'invalid ID'.");
         return nullptr;
     }
-    if (m_netlist->m_used_module_ids.find(id) != m_netlist->m_used_module_ids.end())
+    if (m_netlist->m_modules.contains(id))
     {
         log_error("netlist.internal", "netlist::create_module: module id {:08x} is already taken.", id);
         return nullptr;
@@ -362,15 +369,7 @@ std::shared_ptr<module> netlist_internal_manager::create_module(const u32 id, co
 
     auto m = std::shared_ptr<module>(new module(id, parent, name, this));
 
-    auto free_id_it = m_netlist->m_free_module_ids.find(id);
-    if (free_id_it != m_netlist->m_free_module_ids.end())
-    {
-        m_netlist->m_free_module_ids.erase(free_id_it);
-    }
-
-    m_netlist->m_used_module_ids.insert(id);
-
-    m_netlist->m_modules[id] = m;
+    m_netlist->m_modules.insert(id, m);
 
     if (parent != nullptr)
     {
@@ -430,9 +429,6 @@ bool netlist_internal_manager::delete_module(const std::shared_ptr<module>& to_r
 
     m_netlist->m_modules.erase(to_remove->get_id());
 
-    m_netlist->m_free_module_ids.insert(to_remove->get_id());
-    m_netlist->m_used_module_ids.erase(to_remove->get_id());
-
     module_event_handler::notify(module_event_handler::event::removed, to_remove);
     return true;
 }
@@ -449,10 +445,7 @@ bool netlist_internal_manager::module_assign_gate(const std::shared_ptr<module>&
     }
     auto prev_module = g->m_module;
 
-    prev_module->m_gates_map.erase(prev_module->m_gates_map.find(g->get_id()));
     prev_module->m_gates_set.erase(g);
-
-    m->m_gates_map[g->get_id()] = g;
     m->m_gates_set.insert(g);
 
     g->m_module = m;
@@ -475,18 +468,14 @@ bool netlist_internal_manager::module_remove_gate(const std::shared_ptr<module>&
         return false;
     }
 
-    auto it = m->m_gates_map.find(g->get_id());
-
-    if (it == m->m_gates_map.end())
+    if (g->m_module != m)
     {
         log_error("module", "gate '{}' (id {}) is not stored in module '{}' (id {}).", g->get_name(), g->get_id(), m->get_name(), m->get_id());
         return false;
     }
 
-    m->m_gates_map.erase(it);
     m->m_gates_set.erase(g);
 
-    m_netlist->m_top_module->m_gates_map[g->get_id()] = g;
     m_netlist->m_top_module->m_gates_set.insert(g);
     g->m_module = m_netlist->m_top_module;
 
@@ -0,0 +1,556 @@
+#include "netlist/netlist_sequential_simulator.h"
+
+#include "netlist/gate.h"
+#include "netlist/net.h"
+#include "netlist/netlist.h"
+
+#include "core/log.h"
+#include "core/utils.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    using bit_planes = std::pair<u64, u64>;
+
+    // the value is a where mask is set and b elsewhere
+    bit_planes select(u64 mask, const bit_planes& a, const bit_planes& b)
+    {
+        return {(a.first & mask) | (b.first & ~mask), (a.second & mask) | (b.second & ~mask)};
+    }
+
+    // the value is known where both values agree on a known value, otherwise X
+    bit_planes merge(const bit_planes& a, const bit_planes& b)
+    {
+        u64 unknowns = a.second | b.second | (a.first ^ b.first);
+        return {a.first & ~unknowns, unknowns};
+    }
+
+    bit_planes negate(const bit_planes& a)
+    {
+        return {~(a.first | a.second), a.second};
+    }
+
+    // the value if both set and reset are active
+    bit_planes apply_behavior(gate_type_sequential::set_reset_behavior behavior, const bit_planes& previous)
+    {
+        switch (behavior)
+        {
+            case gate_type_sequential::set_reset_behavior::L:
+                return {0, 0};
+            case gate_type_sequential::set_reset_behavior::H:
+                return {~0ull, 0};
+            case gate_type_sequential::set_reset_behavior::N:
+                return previous;
+            case gate_type_sequential::set_reset_behavior::T:
+                return negate(previous);
+            default:
+                return {0, ~0ull};
+        }
+    }
+}    // namespace
+
+netlist_sequential_simulator::netlist_sequential_simulator(const std::shared_ptr<netlist>& nl) : netlist_simulator(nl)
+{
+    m_time            = 0;
+    m_num_evaluations = 0;
+    m_initialized     = false;
+
+    m_nets.resize(m_ones.size());
+    m_kernel_readers.resize(m_ones.size());
+    m_element_readers.resize(m_ones.size());
+    m_kernel_scheduled.assign(m_kernels.size(), false);
+
+    for (u32 i = 0; i < m_kernels.size(); ++i)
+    {
+        for (u32 input : m_kernels[i].inputs)
+        {
+            m_kernel_readers[input].push_back(i);
+        }
+    }
+
+    if (nl == nullptr)
+    {
+        return;
+    }
+
+    m_design_name = nl->get_design_name();
+    for (const auto& n : nl->get_nets())
+    {
+        m_nets[m_net_indices.at(n->get_id())] = n;
+    }
+
+    std::vector<std::shared_ptr<gate>> gates;
+    nl->for_each_gate([&gates](const std::shared_ptr<gate>& g) {
+        auto bt = g->get_type()->get_base_type();
+        if (bt == gate_type::base_type::ff || bt == gate_type::base_type::latch)
+        {
+            gates.push_back(g);
+        }
+    });
+    std::sort(gates.begin(), gates.end(), [](const auto& a, const auto& b) { return a->get_id() < b->get_id(); });
+
+    for (const auto& g : gates)
+    {
+        auto type = std::dynamic_pointer_cast<const gate_type_sequential>(g->get_type());
+        if (type == nullptr)
+        {
+            log_warning("netlist", "gate '{}' (id {:08x}) has no sequential gate type and will not be simulated.", g->get_name(), g->get_id());
+            continue;
+        }
+
+        sequential_element e;
+        e.is_ff = (type->get_base_type() == gate_type::base_type::ff);
+
+        // compiles a function of the gate type and returns whether it exists
+        auto build_kernel = [&](const std::string& name, kernel& k) {
+            auto func = g->get_boolean_function(name);
+            if (func.is_empty())
+            {
+                return false;
+            }
+            auto variables = func.get_variables();
+            std::vector<std::string> pins(variables.begin(), variables.end());
+            k.function = func.compile(pins);
+            k.inputs.assign(pins.size(), 0);
+            k.output = 0;
+            for (u32 i = 0; i < pins.size(); ++i)
+            {
+                if (auto input = g->get_fan_in_net(pins[i]); input != nullptr)
+                {
+                    k.inputs[i] = m_net_indices.at(input->get_id());
+                }
+            }
+            return true;
+        };
+        e.has_clock = build_kernel(e.is_ff ? "clock" : "enable", e.clock);
+        e.has_data  = build_kernel(e.is_ff ? "next_state" : "data_in", e.data);
+        e.has_set   = build_kernel("set", e.set);
+        e.has_reset = build_kernel("reset", e.reset);
+
+        std::tie(e.state_behavior, e.inverted_state_behavior) = type->get_set_reset_behavior();
+
+        for (const auto& pin : type->get_state_output_pins())
+        {
+            if (auto output = g->get_fan_out_net(pin); output != nullptr)
+            {
+                e.state_outputs.push_back(m_net_indices.at(output->get_id()));
+            }
+        }
+        for (const auto& pin : type->get_inverted_state_output_pins())
+        {
+            if (auto output = g->get_fan_out_net(pin); output != nullptr)
+            {
+                e.inverted_state_outputs.push_back(m_net_indices.at(output->get_id()));
+            }
+        }
+
+        // the initial state is X unless the init data holds a number
+        e.state_ones     = 0;
+        e.state_unknowns = ~0ull;
+        if (!type->get_init_data_category().empty() && !type->get_init_data_identifier().empty())
+        {
+            auto init = std::get<1>(g->get_data_by_key(type->get_init_data_category(), type->get_init_data_identifier()));
+            if (!init.empty() && init.find_first_not_of("0123456789abcdefABCDEF") == std::string::npos)
+            {
+                e.state_ones     = (init.find_first_not_of('0') != std::string::npos) ? ~0ull : 0ull;
+                e.state_unknowns = 0;
+            }
+        }
+        std::tie(e.inverted_state_ones, e.inverted_state_unknowns) = negate({e.state_ones, e.state_unknowns});
+
+        e.clock_ones        = 0;
+        e.clock_unknowns    = ~0ull;
+        e.clock_initialized = false;
+
+        u32 index = m_elements.size();
+        for (const kernel* k : {&e.clock, &e.data, &e.set, &e.reset})
+        {
+            for (u32 input : k->inputs)
+            {
+                m_element_readers[input].push_back(index);
+            }
+            if (k->inputs.size() > m_input_ones.size())
+            {
+                m_input_ones.resize(k->inputs.size());
+                m_input_unknowns.resize(k->inputs.size());
+            }
+        }
+        for (u32 output : e.state_outputs)
+        {
+            m_is_input[output] = false;
+        }
+        for (u32 output : e.inverted_state_outputs)
+        {
+            m_is_input[output] = false;
+        }
+        m_elements.push_back(std::move(e));
+    }
+    m_element_scheduled.assign(m_elements.size(), false);
+
+    m_input_nets.erase(std::remove_if(m_input_nets.begin(), m_input_nets.end(), [this](const auto& n) { return !m_is_input[m_net_indices.at(n->get_id())]; }), m_input_nets.end());
+}
+
+bool netlist_sequential_simulator::set_input(const std::shared_ptr<net>& n, u64 ones, u64 unknowns)
+{
+    auto it = (n == nullptr) ? m_net_indices.end() : m_net_indices.find(n->get_id());
+    if (it == m_net_indices.end() || !m_is_input[it->second])
+    {
+        // reports the error
+        return netlist_simulator::set_input(n, ones, unknowns);
+    }
+
+    // the change is propagated by the next step
+    update_net(it->second, ones & ~unknowns, unknowns);
+    return true;
+}
+
+void netlist_sequential_simulator::step()
+{
+    if (!m_initialized)
+    {
+        // evaluate everything once and record the initial value of every net
+        for (u32 i = 0; i < m_kernels.size(); ++i)
+        {
+            m_kernel_queue.push(i);
+            m_kernel_scheduled[i] = true;
+        }
+        for (u32 i = 0; i < m_elements.size(); ++i)
+        {
+            m_element_queue.push_back(i);
+            m_element_scheduled[i] = true;
+        }
+        for (u32 i = 1; i < m_ones.size(); ++i)
+        {
+            m_changes.push_back({m_time, i, m_ones[i], m_unknowns[i]});
+        }
+        m_initialized = true;
+    }
+
+    for (u32 iteration = 0;; ++iteration)
+    {
+        while (!m_kernel_queue.empty())
+        {
+            u32 index = m_kernel_queue.top();
+            m_kernel_queue.pop();
+            m_kernel_scheduled[index] = false;
+
+            const auto& k         = m_kernels[index];
+            auto [ones, unknowns] = evaluate(k);
+            update_net(k.output, ones, unknowns);
+        }
+
+        if (m_element_queue.empty())
+        {
+            break;
+        }
+        if (iteration == MAX_ITERATIONS)
+        {
+            log_warning("netlist", "simulation did not stabilize after {} iterations at time {}.", MAX_ITERATIONS, m_time);
+            for (u32 index : m_element_queue)
+            {
+                m_element_scheduled[index] = false;
+            }
+            m_element_queue.clear();
+            break;
+        }
+
+        update_elements();
+    }
+
+    m_time++;
+}
+
+bool netlist_sequential_simulator::run_clock_cycles(const std::shared_ptr<net>& clock, u32 num_cycles)
+{
+    for (u32 i = 0; i < num_cycles; ++i)
+    {
+        if (!set_input(clock, boolean_function::ZERO))
+        {
+            return false;
+        }
+        step();
+        set_input(clock, boolean_function::ONE);
+        step();
+    }
+    return true;
+}
+
+bool netlist_sequential_simulator::run_stimulus(const hal::path& path)
+{
+    std::ifstream file(path.string());
+    if (!file.is_open())
+    {
+        log_error("netlist", "cannot open stimulus file '{}'.", path.string());
+        return false;
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<net>> nets_by_name;
+    for (const auto& n : m_input_nets)
+    {
+        nets_by_name.emplace(n->get_name(), n);
+    }
+
+    struct stimulus
+    {
+        u64 time;
+        std::shared_ptr<net> input;
+        boolean_function::value value;
+    };
+    std::vector<stimulus> stimuli;
+
+    std::string line;
+    for (u32 line_number = 1; std::getline(file, line); ++line_number)
+    {
+        std::stringstream ss(line);
+        std::string time, name, value;
+        if (!(ss >> time) || time[0] == '#')
+        {
+            continue;
+        }
+        if (!(ss >> name >> value) || !core_utils::is_integer(time) || (value != "0" && value != "1" && value != "X"))
+        {
+            log_error("netlist", "invalid stimulus in line {} of '{}'.", line_number, path.string());
+            return false;
+        }
+
+        auto it = nets_by_name.find(name);
+        if (it == nets_by_name.end())
+        {
+            log_error("netlist", "stimulus in line {} of '{}' refers to '{}', which is not an input of the simulation.", line_number, path.string(), name);
+            return false;
+        }
+
+        u64 t = std::stoull(time);
+        if (t < m_time)
+        {
+            log_error("netlist", "stimulus in line {} of '{}' lies before the current time {}.", line_number, path.string(), m_time);
+            return false;
+        }
+        stimuli.push_back({t, it->second, (value == "0") ? boolean_function::ZERO : ((value == "1") ? boolean_function::ONE : boolean_function::X)});
+    }
+
+    std::stable_sort(stimuli.begin(), stimuli.end(), [](const auto& a, const auto& b) { return a.time < b.time; });
+    for (u32 i = 0; i < stimuli.size();)
+    {
+        m_time = stimuli[i].time;
+        for (; i < stimuli.size() && stimuli[i].time == m_time; ++i)
+        {
+            set_input(stimuli[i].input, stimuli[i].value);
+        }
+        step();
+    }
+    return true;
+}
+
+bool netlist_sequential_simulator::write_vcd(const hal::path& path, u32 pattern) const
+{
+    if (pattern >= 64)
+    {
+        log_error("netlist", "pattern {} exceeds the 64 patterns of a simulation pass.", pattern);
+        return false;
+    }
+
+    std::ofstream file(path.string());
+    if (!file.is_open())
+    {
+        log_error("netlist", "cannot open VCD file '{}'.", path.string());
+        return false;
+    }
+
+    // identifiers are built from the printable characters
+    auto get_identifier = [](u32 index) {
+        std::string result;
+        do
+        {
+            result.push_back((char)('!' + (index % 94)));
+            index /= 94;
+        } while (index > 0);
+        return result;
+    };
+    auto get_name = [](std::string name) {
+        std::replace_if(name.begin(), name.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); }, '_');
+        return name;
+    };
+
+    file << "$timescale 1ns $end" << std::endl;
+    file << "$scope module " << (m_design_name.empty() ? "top" : get_name(m_design_name)) << " $end" << std::endl;
+    for (u32 i = 1; i < m_nets.size(); ++i)
+    {
+        file << "$var wire 1 " << get_identifier(i) << " " << get_name(m_nets[i]->get_name()) << " $end" << std::endl;
+    }
+    file << "$upscope $end" << std::endl;
+    file << "$enddefinitions $end" << std::endl;
+
+    // only the last change of a net at a time is written
+    std::vector<char> written(m_nets.size(), 0);
+    std::vector<char> pending(m_nets.size(), 0);
+    std::vector<u32> touched;
+    for (u32 i = 0; i < m_changes.size();)
+    {
+        u64 time = m_changes[i].time;
+        for (; i < m_changes.size() && m_changes[i].time == time; ++i)
+        {
+            const auto& change = m_changes[i];
+            if (pending[change.net] == 0)
+            {
+                touched.push_back(change.net);
+            }
+            pending[change.net] = ((change.unknowns >> pattern) & 1) ? 'x' : (((change.ones >> pattern) & 1) ? '1' : '0');
+        }
+
+        bool time_written = false;
+        for (u32 index : touched)
+        {
+            if (pending[index] != written[index])
+            {
+                if (!time_written)
+                {
+                    file << "#" << time << std::endl;
+                    time_written = true;
+                }
+                file << pending[index] << get_identifier(index) << std::endl;
+                written[index] = pending[index];
+            }
+            pending[index] = 0;
+        }
+        touched.clear();
+    }
+    return true;
+}
+
+u64 netlist_sequential_simulator::get_time() const
+{
+    return m_time;
+}
+
+u64 netlist_sequential_simulator::get_num_evaluations() const
+{
+    return m_num_evaluations;
+}
+
+std::pair<u64, u64> netlist_sequential_simulator::evaluate(const kernel& k)
+{
+    m_num_evaluations++;
+    for (u32 i = 0; i < k.inputs.size(); ++i)
+    {
+        m_input_ones[i]     = m_ones[k.inputs[i]];
+        m_input_unknowns[i] = m_unknowns[k.inputs[i]];
+    }
+    return k.function.evaluate_bitsliced(m_input_ones, m_input_unknowns);
+}
+
+void netlist_sequential_simulator::update_net(u32 index, u64 ones, u64 unknowns)
+{
+    if (m_ones[index] == ones && m_unknowns[index] == unknowns)
+    {
+        return;
+    }
+
+    m_ones[index]     = ones;
+    m_unknowns[index] = unknowns;
+    if (m_initialized)
+    {
+        m_changes.push_back({m_time, index, ones, unknowns});
+    }
+
+    for (u32 reader : m_kernel_readers[index])
+    {
+        if (!m_kernel_scheduled[reader])
+        {
+            m_kernel_scheduled[reader] = true;
+            m_kernel_queue.push(reader);
+        }
+    }
+    for (u32 reader : m_element_readers[index])
+    {
+        if (!m_element_scheduled[reader])
+        {
+            m_element_scheduled[reader] = true;
+            m_element_queue.push_back(reader);
+        }
+    }
+}
+
+void netlist_sequential_simulator::update_elements()
+{
+    // all elements sample their inputs before any of their outputs change
+    std::vector<u32> elements;
+    std::swap(elements, m_element_queue);
+    for (u32 index : elements)
+    {
+        auto& e                    = m_elements[index];
+        m_element_scheduled[index] = false;
+        m_num_evaluations++;
+
+        bit_planes state(e.state_ones, e.state_unknowns);
+        bit_planes inverted_state(e.inverted_state_ones, e.inverted_state_unknowns);
+        bit_planes data = e.has_data ? evaluate(e.data) : bit_planes(0, ~0ull);
+
+        // certain and possible updates of the state by the clock or enable signal
+        u64 certain = 0, possible = 0;
+        if (e.has_clock)
+        {
+            auto clock = evaluate(e.clock);
+            if (e.is_ff)
+            {
+                if (e.clock_initialized)
+                {
+                    certain  = ~e.clock_ones & ~e.clock_unknowns & clock.first;
+                    possible = ~e.clock_ones & (clock.first | clock.second);
+                }
+                std::tie(e.clock_ones, e.clock_unknowns) = clock;
+                e.clock_initialized                      = true;
+            }
+            else
+            {
+                certain  = clock.first;
+                possible = clock.first | clock.second;
+            }
+        }
+        state          = select(certain, data, select(possible, merge(state, data), state));
+        inverted_state = select(possible, negate(state), inverted_state);
+
+        // asynchronous set and reset
+        bit_planes set   = e.has_set ? evaluate(e.set) : bit_planes(0, 0);
+        bit_planes reset = e.has_reset ? evaluate(e.reset) : bit_planes(0, 0);
+        u64 set_known    = ~set.first & ~set.second;
+        u64 reset_known  = ~reset.first & ~reset.second;
+
+        u64 only_set   = set.first & reset_known;
+        u64 only_reset = reset.first & set_known;
+        u64 both       = set.first & reset.first;
+        u64 uncertain  = (set.second | reset.second) & ~only_set & ~only_reset & ~both;
+
+        bit_planes both_state    = apply_behavior(e.state_behavior, state);
+        bit_planes both_inverted = (e.inverted_state_behavior == gate_type_sequential::set_reset_behavior::U) ? negate(both_state) : apply_behavior(e.inverted_state_behavior, inverted_state);
+
+        // where set or reset are X, the state is only known if it does not depend on them
+        bit_planes uncertain_state = select(set.first | set.second, merge(state, bit_planes(~0ull, 0)), state);
+        uncertain_state            = select(reset.first | reset.second, merge(uncertain_state, bit_planes(0, 0)), uncertain_state);
+
+        bit_planes next_state = select(only_set, bit_planes(~0ull, 0), select(only_reset, bit_planes(0, 0), select(both, both_state, state)));
+        next_state            = select(uncertain, uncertain_state, next_state);
+
+        bit_planes next_inverted = select(only_set | only_reset, negate(next_state), select(both, both_inverted, inverted_state));
+        next_inverted            = select(uncertain, negate(uncertain_state), next_inverted);
+
+        std::tie(e.state_ones, e.state_unknowns)                   = next_state;
+        std::tie(e.inverted_state_ones, e.inverted_state_unknowns) = next_inverted;
+    }
+
+    for (u32 index : elements)
+    {
+        const auto& e = m_elements[index];
+        for (u32 output : e.state_outputs)
+        {
+            update_net(output, e.state_ones, e.state_unknowns);
+        }
+        for (u32 output : e.inverted_state_outputs)
+        {
+            update_net(output, e.inverted_state_ones, e.inverted_state_unknowns);
+        }
+    }
+}
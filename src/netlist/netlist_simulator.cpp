@@ -0,0 +1,197 @@
+#include "netlist/netlist_simulator.h"
+
+#include "netlist/gate.h"
+#include "netlist/net.h"
+#include "netlist/netlist.h"
+
+#include "core/log.h"
+
+#include <algorithm>
+
+netlist_simulator::netlist_simulator(const std::shared_ptr<netlist>& nl)
+{
+    if (nl == nullptr)
+    {
+        log_error("netlist", "cannot simulate a nullptr netlist.");
+        m_ones     = {0};
+        m_unknowns = {~0ull};
+        m_is_input = {false};
+        return;
+    }
+
+    // sort the nets by id to get a deterministic order of the inputs
+    auto net_set = nl->get_nets();
+    std::vector<std::shared_ptr<net>> nets(net_set.begin(), net_set.end());
+    std::sort(nets.begin(), nets.end(), [](const auto& a, const auto& b) { return a->get_id() < b->get_id(); });
+
+    for (u32 i = 0; i < nets.size(); ++i)
+    {
+        m_net_indices[nets[i]->get_id()] = i + 1;
+    }
+    m_ones.assign(nets.size() + 1, 0);
+    m_unknowns.assign(nets.size() + 1, ~0ull);
+    m_is_input.assign(nets.size() + 1, false);
+
+    // build a kernel for every net that is driven by a combinational function
+    std::vector<kernel> kernels;
+    for (const auto& n : nets)
+    {
+        auto src = n->get_src();
+        auto g   = src.get_gate();
+        boolean_function func;
+        if (g != nullptr && g->get_type()->get_base_type() != gate_type::base_type::ff && g->get_type()->get_base_type() != gate_type::base_type::latch)
+        {
+            func = g->get_boolean_function(src.get_pin_type());
+        }
+
+        if (func.is_empty())
+        {
+            m_is_input[m_net_indices.at(n->get_id())] = true;
+            m_input_nets.push_back(n);
+            continue;
+        }
+
+        auto variables = func.get_variables();
+        std::vector<std::string> pins(variables.begin(), variables.end());
+        kernel k{func.compile(pins), std::vector<u32>(pins.size(), 0), m_net_indices.at(n->get_id())};
+        for (u32 i = 0; i < pins.size(); ++i)
+        {
+            if (auto input = g->get_fan_in_net(pins[i]); input != nullptr)
+            {
+                k.inputs[i] = m_net_indices.at(input->get_id());
+            }
+        }
+        kernels.push_back(std::move(k));
+    }
+
+    // levelize by Kahn's algorithm, a kernel is ready once all of its inputs are computed
+    std::vector<std::vector<u32>> readers(m_ones.size());
+    std::vector<u32> missing_inputs(kernels.size(), 0);
+    std::vector<u32> ready;
+    std::vector<bool> is_computed = m_is_input;
+    is_computed[0]                = true;
+    for (u32 i = 0; i < kernels.size(); ++i)
+    {
+        for (u32 input : kernels[i].inputs)
+        {
+            if (!is_computed[input])
+            {
+                readers[input].push_back(i);
+                missing_inputs[i]++;
+            }
+        }
+        if (missing_inputs[i] == 0)
+        {
+            ready.push_back(i);
+        }
+    }
+
+    m_kernels.reserve(kernels.size());
+    for (u32 r = 0; r < ready.size(); ++r)
+    {
+        auto& k = kernels[ready[r]];
+        for (u32 reader : readers[k.output])
+        {
+            if (--missing_inputs[reader] == 0)
+            {
+                ready.push_back(reader);
+            }
+        }
+        m_kernels.push_back(std::move(k));
+    }
+
+    if (m_kernels.size() < kernels.size())
+    {
+        log_warning("netlist", "{} gate outputs are part of combinational loops and will not be simulated.", kernels.size() - m_kernels.size());
+    }
+
+    u32 max_inputs = 0;
+    for (const auto& k : m_kernels)
+    {
+        max_inputs = std::max(max_inputs, (u32)k.inputs.size());
+    }
+    m_input_ones.resize(max_inputs);
+    m_input_unknowns.resize(max_inputs);
+}
+
+const std::vector<std::shared_ptr<net>>& netlist_simulator::get_input_nets() const
+{
+    return m_input_nets;
+}
+
+u32 netlist_simulator::get_num_evaluated_outputs() const
+{
+    return m_kernels.size();
+}
+
+bool netlist_simulator::set_input(const std::shared_ptr<net>& n, u64 ones, u64 unknowns)
+{
+    if (n == nullptr)
+    {
+        log_error("netlist", "cannot set the value of a nullptr net.");
+        return false;
+    }
+
+    auto it = m_net_indices.find(n->get_id());
+    if (it == m_net_indices.end() || !m_is_input[it->second])
+    {
+        log_error("netlist", "net '{}' (id {:08x}) is not an input of the simulation.", n->get_name(), n->get_id());
+        return false;
+    }
+
+    m_ones[it->second]     = ones & ~unknowns;
+    m_unknowns[it->second] = unknowns;
+    return true;
+}
+
+bool netlist_simulator::set_input(const std::shared_ptr<net>& n, boolean_function::value value)
+{
+    return set_input(n, (value == boolean_function::ONE) ? ~0ull : 0ull, (value == boolean_function::X) ? ~0ull : 0ull);
+}
+
+void netlist_simulator::simulate()
+{
+    for (const auto& k : m_kernels)
+    {
+        u32 num_inputs = k.inputs.size();
+        for (u32 i = 0; i < num_inputs; ++i)
+        {
+            m_input_ones[i]     = m_ones[k.inputs[i]];
+            m_input_unknowns[i] = m_unknowns[k.inputs[i]];
+        }
+        std::tie(m_ones[k.output], m_unknowns[k.output]) = k.function.evaluate_bitsliced(m_input_ones, m_input_unknowns);
+    }
+}
+
+std::pair<u64, u64> netlist_simulator::get_value(const std::shared_ptr<net>& n) const
+{
+    if (n == nullptr)
+    {
+        log_error("netlist", "cannot get the value of a nullptr net.");
+        return {0, ~0ull};
+    }
+
+    auto it = m_net_indices.find(n->get_id());
+    if (it == m_net_indices.end())
+    {
+        log_error("netlist", "net '{}' (id {:08x}) is not part of the simulated netlist.", n->get_name(), n->get_id());
+        return {0, ~0ull};
+    }
+    return {m_ones[it->second], m_unknowns[it->second]};
+}
+
+boolean_function::value netlist_simulator::get_value(const std::shared_ptr<net>& n, u32 pattern) const
+{
+    if (pattern >= 64)
+    {
+        log_error("netlist", "pattern {} exceeds the 64 patterns of a simulation pass.", pattern);
+        return boolean_function::X;
+    }
+
+    auto [ones, unknowns] = get_value(n);
+    if ((unknowns >> pattern) & 1)
+    {
+        return boolean_function::X;
+    }
+    return ((ones >> pattern) & 1) ? boolean_function::ONE : boolean_function::ZERO;
+}
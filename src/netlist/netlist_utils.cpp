@@ -0,0 +1,119 @@
+#include "netlist/netlist_utils.h"
+
+#include "netlist/gate.h"
+#include "netlist/net.h"
+
+#include "core/log.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace netlist_utils
+{
+    std::string get_net_variable_name(const std::shared_ptr<net>& n)
+    {
+        return "net_" + std::to_string(n->get_id());
+    }
+
+    bdd_manager::function get_subgraph_function(bdd_manager& manager, const std::shared_ptr<net>& n, const std::function<bool(const std::shared_ptr<gate>&)>& stop_condition)
+    {
+        if (n == nullptr)
+        {
+            log_error("netlist", "cannot compute the function of a subgraph for a nullptr net.");
+            return {bdd_manager::ZERO, bdd_manager::ONE};
+        }
+
+        // returns the function of the pin driving the net or an empty function if the net is a variable
+        auto get_driving_function = [&](const std::shared_ptr<net>& current) {
+            auto src = current->get_src();
+            auto g   = src.get_gate();
+            if (g == nullptr)
+            {
+                return boolean_function();
+            }
+            if (stop_condition ? stop_condition(g) : (g->get_type()->get_base_type() == gate_type::base_type::ff || g->get_type()->get_base_type() == gate_type::base_type::latch))
+            {
+                return boolean_function();
+            }
+            return g->get_boolean_function(src.get_pin_type());
+        };
+
+        auto get_variable = [&](const std::shared_ptr<net>& current) { return bdd_manager::function{manager.get_variable(get_net_variable_name(current)), bdd_manager::ZERO}; };
+
+        // depth-first traversal, a net is composed once all nets at the inputs of its source are done
+        std::unordered_map<u32, bdd_manager::function> functions;
+        std::unordered_set<u32> in_progress;
+        std::vector<std::pair<std::shared_ptr<net>, bool>> stack = {{n, false}};
+        while (!stack.empty())
+        {
+            auto [current, expanded] = stack.back();
+            stack.pop_back();
+
+            u32 id = current->get_id();
+            if (functions.find(id) != functions.end())
+            {
+                continue;
+            }
+
+            auto func = get_driving_function(current);
+            if (func.is_empty())
+            {
+                functions.emplace(id, get_variable(current));
+                continue;
+            }
+
+            auto g = current->get_src().get_gate();
+            if (!expanded)
+            {
+                in_progress.insert(id);
+                stack.emplace_back(current, true);
+                for (const auto& pin : func.get_variables())
+                {
+                    auto input = g->get_fan_in_net(pin);
+                    if (input != nullptr && functions.find(input->get_id()) == functions.end() && in_progress.find(input->get_id()) == in_progress.end())
+                    {
+                        stack.emplace_back(input, false);
+                    }
+                }
+                continue;
+            }
+
+            std::unordered_map<std::string, bdd_manager::function> inputs;
+            for (const auto& pin : func.get_variables())
+            {
+                auto input = g->get_fan_in_net(pin);
+                if (input == nullptr)
+                {
+                    inputs[pin] = {bdd_manager::ZERO, bdd_manager::ONE};
+                }
+                else if (auto it = functions.find(input->get_id()); it != functions.end())
+                {
+                    inputs[pin] = it->second;
+                }
+                else
+                {
+                    // the input closes a combinational loop
+                    inputs[pin] = get_variable(input);
+                }
+            }
+
+            functions.emplace(id, manager.from_boolean_function(func, inputs));
+            in_progress.erase(id);
+        }
+
+        return functions.at(n->get_id());
+    }
+
+    boolean_function get_subgraph_function(const std::shared_ptr<net>& n, const std::function<bool(const std::shared_ptr<gate>&)>& stop_condition)
+    {
+        if (n == nullptr)
+        {
+            log_error("netlist", "cannot compute the function of a subgraph for a nullptr net.");
+            return boolean_function();
+        }
+
+        bdd_manager manager;
+        return manager.to_boolean_function(get_subgraph_function(manager, n, stop_condition));
+    }
+}    // namespace netlist_utils
@@ -0,0 +1,801 @@
+#include "netlist/persistent/netlist_binary_file.h"
+
+#include "netlist/boolean_function.h"
+#include "netlist/gate.h"
+#include "netlist/module.h"
+#include "netlist/net.h"
+#include "netlist/netlist.h"
+#include "netlist/netlist_builder.h"
+
+#include "netlist/gate_library/gate_library_manager.h"
+
+#include "core/log.h"
+
+#include <cstring>
+#include <fstream>
+#include <queue>
+#include <unordered_map>
+
+namespace
+{
+    const char MAGIC[8]         = {'H', 'A', 'L', 'B', 'I', 'N', '\0', '\0'};
+    const u32 BYTE_ORDER_MARKER = 0x01020304;
+    const u32 NO_ELEMENT        = 0xFFFFFFFF;
+
+    // all sections start at a multiple of the alignment, so columns can be accessed in place
+    const u64 SECTION_ALIGNMENT = 8;
+
+    // a gate and a pin name, used for net sources and destinations
+    struct endpoint_entry
+    {
+        u32 gate;
+        u32 pin;
+    };
+
+    // a data entry of a data container, all members are string indices
+    struct data_entry
+    {
+        u32 category;
+        u32 key;
+        u32 data_type;
+        u32 value;
+    };
+
+    // a custom boolean function of a gate, all members are string indices
+    struct function_entry
+    {
+        u32 name;
+        u32 function;
+    };
+
+    enum section : u32
+    {
+        STRINGS,
+        NETLIST_INFO,
+        GATE_TYPES,
+        GATE_IDS,
+        GATE_TYPE_INDICES,
+        GATE_NAMES,
+        GATE_LOCATIONS,
+        GATE_FLAGS,
+        GATE_FUNCTION_OFFSETS,
+        GATE_FUNCTIONS,
+        GATE_DATA_OFFSETS,
+        GATE_DATA,
+        NET_IDS,
+        NET_NAMES,
+        NET_FLAGS,
+        NET_SRCS,
+        NET_DST_OFFSETS,
+        NET_DSTS,
+        NET_DATA_OFFSETS,
+        NET_DATA,
+        MODULE_IDS,
+        MODULE_NAMES,
+        MODULE_PARENTS,
+        MODULE_GATE_OFFSETS,
+        MODULE_GATES,
+        MODULE_DATA_OFFSETS,
+        MODULE_DATA,
+        EXTENSION,
+        NUM_OF_SECTIONS
+    };
+
+    enum netlist_info : u32
+    {
+        INFO_ID,
+        INFO_GATE_LIBRARY,
+        INFO_INPUT_FILE,
+        INFO_DESIGN_NAME,
+        INFO_DEVICE_NAME,
+        NUM_OF_INFOS
+    };
+
+    const u8 FLAG_GND_GATE   = 1;
+    const u8 FLAG_VCC_GATE   = 2;
+    const u8 FLAG_GLOBAL_IN  = 1;
+    const u8 FLAG_GLOBAL_OUT = 2;
+
+    struct file_header
+    {
+        char magic[8];
+        u32 byte_order_marker;
+        u32 version;
+        u32 num_of_sections;
+        u32 reserved;
+    };
+
+    struct section_header
+    {
+        u64 offset;
+        u64 size;
+    };
+
+    // deduplicates all strings of the netlist, most pin names, types, and data categories occur many times
+    class string_table
+    {
+    public:
+        u32 add(const std::string& s)
+        {
+            auto it = m_indices.find(s);
+            if (it != m_indices.end())
+            {
+                return it->second;
+            }
+            u32 index = m_offsets.size() - 1;
+            m_indices.emplace(s, index);
+            m_chars += s;
+            m_offsets.push_back(m_chars.size());
+            return index;
+        }
+
+        // layout: number of strings, end offsets of all strings, characters
+        std::string serialize() const
+        {
+            std::string result;
+            u64 num_of_strings = m_offsets.size() - 1;
+            result.append(reinterpret_cast<const char*>(&num_of_strings), sizeof(u64));
+            result.append(reinterpret_cast<const char*>(m_offsets.data()), m_offsets.size() * sizeof(u64));
+            result += m_chars;
+            return result;
+        }
+
+    private:
+        std::unordered_map<std::string, u32> m_indices;
+        std::vector<u64> m_offsets = {0};
+        std::string m_chars;
+    };
+
+    template<typename T>
+    void append(std::string& column, const T& value)
+    {
+        column.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void append_data(std::string& offsets, std::string& entries, string_table& strings, const std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>>& data)
+    {
+        for (const auto& [key, value] : data)
+        {
+            append(entries, data_entry{strings.add(std::get<0>(key)), strings.add(std::get<1>(key)), strings.add(std::get<0>(value)), strings.add(std::get<1>(value))});
+        }
+        append(offsets, (u32)(entries.size() / sizeof(data_entry)));
+    }
+}    // namespace
+
+bool netlist_binary_file::write(const std::shared_ptr<netlist>& nl, const hal::path& hal_file, std::string_view extension)
+{
+    if (nl == nullptr)
+    {
+        log_error("netlist.persistent", "cannot write a nullptr netlist.");
+        return false;
+    }
+
+    std::vector<std::string> sections(NUM_OF_SECTIONS);
+    string_table strings;
+
+    auto info = std::vector<u32>(NUM_OF_INFOS);
+    info[INFO_ID]           = nl->get_id();
+    info[INFO_GATE_LIBRARY] = strings.add(nl->get_gate_library()->get_name());
+    info[INFO_INPUT_FILE]   = strings.add(nl->get_input_filename().string());
+    info[INFO_DESIGN_NAME]  = strings.add(nl->get_design_name());
+    info[INFO_DEVICE_NAME]  = strings.add(nl->get_device_name());
+    for (auto value : info)
+    {
+        append(sections[NETLIST_INFO], value);
+    }
+
+    // gates, ordered by their IDs
+    auto gate_set = nl->get_gates();
+    std::vector<std::shared_ptr<gate>> gates(gate_set.begin(), gate_set.end());
+    std::sort(gates.begin(), gates.end(), [](const auto& lhs, const auto& rhs) { return lhs->get_id() < rhs->get_id(); });
+
+    std::unordered_map<u32, u32> gate_index_by_id;
+    std::unordered_map<std::string, u32> type_index_by_name;
+    gate_index_by_id.reserve(gates.size());
+
+    append(sections[GATE_FUNCTION_OFFSETS], (u32)0);
+    append(sections[GATE_DATA_OFFSETS], (u32)0);
+    for (u32 i = 0; i < gates.size(); ++i)
+    {
+        const auto& g = gates[i];
+        gate_index_by_id.emplace(g->get_id(), i);
+
+        const auto& type_name = g->get_type()->get_name();
+        auto type_it          = type_index_by_name.find(type_name);
+        if (type_it == type_index_by_name.end())
+        {
+            type_it = type_index_by_name.emplace(type_name, type_index_by_name.size()).first;
+            append(sections[GATE_TYPES], strings.add(type_name));
+        }
+
+        append(sections[GATE_IDS], g->get_id());
+        append(sections[GATE_TYPE_INDICES], type_it->second);
+        append(sections[GATE_NAMES], strings.add(g->get_name()));
+        append(sections[GATE_LOCATIONS], g->get_location_x());
+        append(sections[GATE_LOCATIONS], g->get_location_y());
+        append(sections[GATE_FLAGS], (u8)((nl->is_gnd_gate(g) ? FLAG_GND_GATE : 0) | (nl->is_vcc_gate(g) ? FLAG_VCC_GATE : 0)));
+
+        for (const auto& [name, function] : g->get_boolean_functions(true))
+        {
+            append(sections[GATE_FUNCTIONS], function_entry{strings.add(name), strings.add(function.to_string())});
+        }
+        append(sections[GATE_FUNCTION_OFFSETS], (u32)(sections[GATE_FUNCTIONS].size() / sizeof(function_entry)));
+
+        append_data(sections[GATE_DATA_OFFSETS], sections[GATE_DATA], strings, g->get_data());
+    }
+
+    // nets, ordered by their IDs
+    auto net_set = nl->get_nets();
+    std::vector<std::shared_ptr<net>> nets(net_set.begin(), net_set.end());
+    std::sort(nets.begin(), nets.end(), [](const auto& lhs, const auto& rhs) { return lhs->get_id() < rhs->get_id(); });
+
+    append(sections[NET_DST_OFFSETS], (u32)0);
+    append(sections[NET_DATA_OFFSETS], (u32)0);
+    for (const auto& n : nets)
+    {
+        append(sections[NET_IDS], n->get_id());
+        append(sections[NET_NAMES], strings.add(n->get_name()));
+        append(sections[NET_FLAGS], (u8)((nl->is_global_input_net(n) ? FLAG_GLOBAL_IN : 0) | (nl->is_global_output_net(n) ? FLAG_GLOBAL_OUT : 0)));
+
+        auto src = n->get_src();
+        if (src.gate != nullptr)
+        {
+            append(sections[NET_SRCS], endpoint_entry{gate_index_by_id.at(src.gate->get_id()), strings.add(src.get_pin_type())});
+        }
+        else
+        {
+            append(sections[NET_SRCS], endpoint_entry{NO_ELEMENT, NO_ELEMENT});
+        }
+
+        auto dsts = n->get_dsts();
+        std::sort(dsts.begin(), dsts.end(), [](const endpoint& lhs, const endpoint& rhs) { return lhs.gate->get_id() < rhs.gate->get_id(); });
+        for (const auto& dst : dsts)
+        {
+            append(sections[NET_DSTS], endpoint_entry{gate_index_by_id.at(dst.gate->get_id()), strings.add(dst.get_pin_type())});
+        }
+        append(sections[NET_DST_OFFSETS], (u32)(sections[NET_DSTS].size() / sizeof(endpoint_entry)));
+
+        append_data(sections[NET_DATA_OFFSETS], sections[NET_DATA], strings, n->get_data());
+    }
+
+    // modules in breadth-first order starting at the top module, so parents are always created before their submodules
+    std::unordered_map<u32, u32> module_index_by_id;
+    std::queue<std::shared_ptr<module>> module_queue;
+    module_queue.push(nl->get_top_module());
+
+    append(sections[MODULE_GATE_OFFSETS], (u32)0);
+    append(sections[MODULE_DATA_OFFSETS], (u32)0);
+    while (!module_queue.empty())
+    {
+        auto m = module_queue.front();
+        module_queue.pop();
+        module_index_by_id.emplace(m->get_id(), module_index_by_id.size());
+
+        auto parent = m->get_parent_module();
+        append(sections[MODULE_IDS], m->get_id());
+        append(sections[MODULE_NAMES], strings.add(m->get_name()));
+        append(sections[MODULE_PARENTS], (parent == nullptr) ? NO_ELEMENT : module_index_by_id.at(parent->get_id()));
+
+        std::vector<u32> gate_indices;
+        for (const auto& g : m->get_gates(nullptr, false))
+        {
+            gate_indices.push_back(gate_index_by_id.at(g->get_id()));
+        }
+        std::sort(gate_indices.begin(), gate_indices.end());
+        for (auto index : gate_indices)
+        {
+            append(sections[MODULE_GATES], index);
+        }
+        append(sections[MODULE_GATE_OFFSETS], (u32)(sections[MODULE_GATES].size() / sizeof(u32)));
+
+        append_data(sections[MODULE_DATA_OFFSETS], sections[MODULE_DATA], strings, m->get_data());
+
+        auto submodule_set = m->get_submodules(nullptr, false);
+        std::vector<std::shared_ptr<module>> submodules(submodule_set.begin(), submodule_set.end());
+        std::sort(submodules.begin(), submodules.end(), [](const auto& lhs, const auto& rhs) { return lhs->get_id() < rhs->get_id(); });
+        for (const auto& sm : submodules)
+        {
+            module_queue.push(sm);
+        }
+    }
+
+    sections[EXTENSION] = std::string(extension);
+    sections[STRINGS] = strings.serialize();
+
+    // header, section table, and the aligned sections
+    file_header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.byte_order_marker = BYTE_ORDER_MARKER;
+    header.version           = FORMAT_VERSION;
+    header.num_of_sections   = NUM_OF_SECTIONS;
+    header.reserved          = 0;
+
+    std::vector<section_header> section_table(NUM_OF_SECTIONS);
+    u64 offset = sizeof(file_header) + NUM_OF_SECTIONS * sizeof(section_header);
+    for (u32 i = 0; i < NUM_OF_SECTIONS; ++i)
+    {
+        offset                  = (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+        section_table[i].offset = offset;
+        section_table[i].size   = sections[i].size();
+        offset += sections[i].size();
+    }
+
+    std::ofstream ofs(hal_file.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!ofs.is_open())
+    {
+        log_error("netlist.persistent", "cannot open or create file '{}'.", hal_file.string());
+        return false;
+    }
+
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(file_header));
+    ofs.write(reinterpret_cast<const char*>(section_table.data()), section_table.size() * sizeof(section_header));
+    u64 position = sizeof(file_header) + NUM_OF_SECTIONS * sizeof(section_header);
+    for (u32 i = 0; i < NUM_OF_SECTIONS; ++i)
+    {
+        std::string padding(section_table[i].offset - position, '\0');
+        ofs.write(padding.data(), padding.size());
+        ofs.write(sections[i].data(), sections[i].size());
+        position = section_table[i].offset + section_table[i].size;
+    }
+
+    if (!ofs.good())
+    {
+        log_error("netlist.persistent", "failed to write '{}'.", hal_file.string());
+        return false;
+    }
+
+    return true;
+}
+
+bool netlist_binary_file::is_binary_file(const hal::path& hal_file)
+{
+    std::ifstream ifs(hal_file.string(), std::ios::in | std::ios::binary);
+    char magic[sizeof(MAGIC)];
+    if (!ifs.read(magic, sizeof(MAGIC)))
+    {
+        return false;
+    }
+    return std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+bool netlist_binary_file::open(const hal::path& hal_file)
+{
+    m_sections.clear();
+    m_num_of_strings = 0;
+
+    if (!m_file.map_file(hal_file.string()))
+    {
+        return false;
+    }
+    auto content = m_file.get_data();
+
+    file_header header;
+    if (content.size() < sizeof(file_header))
+    {
+        log_error("netlist.persistent", "'{}' is not a binary .hal file.", hal_file.string());
+        return false;
+    }
+    std::memcpy(&header, content.data(), sizeof(file_header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+    {
+        log_error("netlist.persistent", "'{}' is not a binary .hal file.", hal_file.string());
+        return false;
+    }
+    if (header.byte_order_marker != BYTE_ORDER_MARKER)
+    {
+        log_error("netlist.persistent", "'{}' was written on a machine with a different byte order.", hal_file.string());
+        return false;
+    }
+    if (header.version != FORMAT_VERSION)
+    {
+        log_error("netlist.persistent", "'{}' uses version {} of the binary format, but only version {} is supported.", hal_file.string(), header.version, FORMAT_VERSION);
+        return false;
+    }
+    if (header.num_of_sections < NUM_OF_SECTIONS || content.size() < sizeof(file_header) + (u64)header.num_of_sections * sizeof(section_header))
+    {
+        log_error("netlist.persistent", "'{}' has an incomplete section table.", hal_file.string());
+        return false;
+    }
+
+    // sections that are unknown to this version are ignored
+    auto section_table = reinterpret_cast<const section_header*>(content.data() + sizeof(file_header));
+    for (u32 i = 0; i < NUM_OF_SECTIONS; ++i)
+    {
+        const auto& entry = section_table[i];
+        if (entry.offset % SECTION_ALIGNMENT != 0 || entry.offset > content.size() || entry.size > content.size() - entry.offset)
+        {
+            log_error("netlist.persistent", "section {} of '{}' is out of bounds.", i, hal_file.string());
+            m_sections.clear();
+            return false;
+        }
+        m_sections.push_back(content.substr(entry.offset, entry.size));
+    }
+
+    // the string table has to be consistent, all other columns are checked when they are accessed
+    const auto& strings = m_sections[STRINGS];
+    bool valid_strings  = false;
+    if (strings.size() >= sizeof(u64))
+    {
+        std::memcpy(&m_num_of_strings, strings.data(), sizeof(u64));
+        if (m_num_of_strings < strings.size() / sizeof(u64) && (m_num_of_strings + 2) * sizeof(u64) <= strings.size())
+        {
+            auto offsets  = reinterpret_cast<const u64*>(strings.data() + sizeof(u64));
+            u64 num_chars = strings.size() - (m_num_of_strings + 2) * sizeof(u64);
+            valid_strings = offsets[0] == 0 && offsets[m_num_of_strings] <= num_chars;
+            for (u64 i = 0; valid_strings && i < m_num_of_strings; ++i)
+            {
+                valid_strings = offsets[i] <= offsets[i + 1];
+            }
+        }
+    }
+    if (!valid_strings)
+    {
+        log_error("netlist.persistent", "string table of '{}' is corrupted.", hal_file.string());
+        m_sections.clear();
+        m_num_of_strings = 0;
+        return false;
+    }
+
+    // all other columns of an element type need to have the same number of entries
+    u32 num_of_gates   = get_num_of_gates();
+    u32 num_of_nets    = get_num_of_nets();
+    u32 num_of_modules = get_num_of_modules();
+    if (get_column_size(NETLIST_INFO, sizeof(u32)) != NUM_OF_INFOS || get_column_size(GATE_TYPE_INDICES, sizeof(u32)) != num_of_gates
+        || get_column_size(GATE_NAMES, sizeof(u32)) != num_of_gates || get_column_size(GATE_LOCATIONS, 2 * sizeof(float)) != num_of_gates
+        || get_column_size(GATE_FLAGS, sizeof(u8)) != num_of_gates || get_column_size(GATE_FUNCTION_OFFSETS, sizeof(u32)) != num_of_gates + 1
+        || get_column_size(GATE_DATA_OFFSETS, sizeof(u32)) != num_of_gates + 1 || get_column_size(NET_NAMES, sizeof(u32)) != num_of_nets
+        || get_column_size(NET_FLAGS, sizeof(u8)) != num_of_nets || get_column_size(NET_SRCS, sizeof(endpoint_entry)) != num_of_nets
+        || get_column_size(NET_DST_OFFSETS, sizeof(u32)) != num_of_nets + 1 || get_column_size(NET_DATA_OFFSETS, sizeof(u32)) != num_of_nets + 1
+        || get_column_size(MODULE_NAMES, sizeof(u32)) != num_of_modules || get_column_size(MODULE_PARENTS, sizeof(u32)) != num_of_modules
+        || get_column_size(MODULE_GATE_OFFSETS, sizeof(u32)) != num_of_modules + 1 || get_column_size(MODULE_DATA_OFFSETS, sizeof(u32)) != num_of_modules + 1
+        || num_of_modules == 0)
+    {
+        log_error("netlist.persistent", "columns of '{}' are inconsistent.", hal_file.string());
+        m_sections.clear();
+        return false;
+    }
+
+    // the last offset of every CSR column has to match the size of the corresponding entry column
+    auto check_offsets = [this](u32 offsets_section, u32 entries_section, u32 entry_size) {
+        auto offsets = get_column<u32>(offsets_section);
+        u32 num      = get_column_size(offsets_section, sizeof(u32));
+        for (u32 i = 1; i < num; ++i)
+        {
+            if (offsets[i] < offsets[i - 1])
+            {
+                return false;
+            }
+        }
+        return offsets[0] == 0 && offsets[num - 1] == get_column_size(entries_section, entry_size);
+    };
+    if (!check_offsets(GATE_FUNCTION_OFFSETS, GATE_FUNCTIONS, sizeof(function_entry)) || !check_offsets(GATE_DATA_OFFSETS, GATE_DATA, sizeof(data_entry))
+        || !check_offsets(NET_DST_OFFSETS, NET_DSTS, sizeof(endpoint_entry)) || !check_offsets(NET_DATA_OFFSETS, NET_DATA, sizeof(data_entry))
+        || !check_offsets(MODULE_GATE_OFFSETS, MODULE_GATES, sizeof(u32)) || !check_offsets(MODULE_DATA_OFFSETS, MODULE_DATA, sizeof(data_entry)))
+    {
+        log_error("netlist.persistent", "connectivity of '{}' is corrupted.", hal_file.string());
+        m_sections.clear();
+        return false;
+    }
+
+    return true;
+}
+
+std::shared_ptr<netlist> netlist_binary_file::create_netlist(bool load_data) const
+{
+    if (m_sections.empty())
+    {
+        log_error("netlist.persistent", "no binary .hal file opened.");
+        return nullptr;
+    }
+
+    auto info = get_column<u32>(NETLIST_INFO);
+    auto lib  = gate_library_manager::get_gate_library(std::string(get_string(info[INFO_GATE_LIBRARY])));
+    if (lib == nullptr)
+    {
+        log_critical("netlist.persistent", "error loading gate library '{}'.", get_string(info[INFO_GATE_LIBRARY]));
+        return nullptr;
+    }
+
+    auto nl = std::make_shared<netlist>(lib);
+    nl->set_id(info[INFO_ID]);
+    nl->set_input_filename(std::string(get_string(info[INFO_INPUT_FILE])));
+    nl->set_design_name(std::string(get_string(info[INFO_DESIGN_NAME])));
+    nl->set_device_name(std::string(get_string(info[INFO_DEVICE_NAME])));
+
+    // every gate type is looked up once instead of once per gate
+    const auto& lib_gate_types = lib->get_gate_types();
+    std::vector<std::shared_ptr<const gate_type>> gate_types;
+    auto type_names = get_column<u32>(GATE_TYPES);
+    for (u32 i = 0; i < get_column_size(GATE_TYPES, sizeof(u32)); ++i)
+    {
+        auto it = lib_gate_types.find(std::string(get_string(type_names[i])));
+        if (it == lib_gate_types.end())
+        {
+            log_error("netlist.persistent", "gate type '{}' does not exist in gate library '{}'.", get_string(type_names[i]), lib->get_name());
+            return nullptr;
+        }
+        gate_types.push_back(it->second);
+    }
+
+    auto set_data = [this](const std::shared_ptr<data_container>& c, u32 offsets_section, u32 entries_section, u32 index) {
+        auto offsets = get_column<u32>(offsets_section);
+        auto entries = get_column<data_entry>(entries_section);
+        for (u32 i = offsets[index]; i < offsets[index + 1]; ++i)
+        {
+            const auto& e = entries[i];
+            c->set_data(std::string(get_string(e.category)), std::string(get_string(e.key)), std::string(get_string(e.data_type)), std::string(get_string(e.value)));
+        }
+    };
+
+    netlist_builder builder(nl);
+
+    u32 num_of_gates = get_num_of_gates();
+    u32 num_of_nets  = get_num_of_nets();
+    builder.reserve(num_of_gates, num_of_nets);
+
+    // gates are addressed by index, so connecting nets and modules needs no ID lookups
+    std::vector<std::shared_ptr<gate>> gates;
+    gates.reserve(num_of_gates);
+
+    auto gate_ids          = get_column<u32>(GATE_IDS);
+    auto gate_type_indices = get_column<u32>(GATE_TYPE_INDICES);
+    auto gate_names        = get_column<u32>(GATE_NAMES);
+    auto gate_locations    = get_column<float>(GATE_LOCATIONS);
+    auto gate_flags        = get_column<u8>(GATE_FLAGS);
+    auto function_offsets  = get_column<u32>(GATE_FUNCTION_OFFSETS);
+    auto functions         = get_column<function_entry>(GATE_FUNCTIONS);
+    for (u32 i = 0; i < num_of_gates; ++i)
+    {
+        if (gate_type_indices[i] >= gate_types.size())
+        {
+            log_error("netlist.persistent", "gate {:08x} has an invalid gate type.", gate_ids[i]);
+            return nullptr;
+        }
+
+        auto g = builder.create_gate(gate_ids[i], gate_types[gate_type_indices[i]], std::string(get_string(gate_names[i])), gate_locations[2 * i], gate_locations[2 * i + 1]);
+        if (g == nullptr)
+        {
+            return nullptr;
+        }
+        gates.push_back(g);
+
+        for (u32 j = function_offsets[i]; j < function_offsets[i + 1]; ++j)
+        {
+            g->add_boolean_function(std::string(get_string(functions[j].name)), boolean_function::from_string(std::string(get_string(functions[j].function))));
+        }
+
+        if (load_data)
+        {
+            set_data(g, GATE_DATA_OFFSETS, GATE_DATA, i);
+        }
+
+        if ((gate_flags[i] & FLAG_GND_GATE) && !nl->mark_gnd_gate(g))
+        {
+            return nullptr;
+        }
+        if ((gate_flags[i] & FLAG_VCC_GATE) && !nl->mark_vcc_gate(g))
+        {
+            return nullptr;
+        }
+    }
+
+    auto net_ids     = get_column<u32>(NET_IDS);
+    auto net_names   = get_column<u32>(NET_NAMES);
+    auto net_flags   = get_column<u8>(NET_FLAGS);
+    auto srcs        = get_column<endpoint_entry>(NET_SRCS);
+    auto dst_offsets = get_column<u32>(NET_DST_OFFSETS);
+    auto dsts        = get_column<endpoint_entry>(NET_DSTS);
+    for (u32 i = 0; i < num_of_nets; ++i)
+    {
+        auto n = builder.create_net(net_ids[i], std::string(get_string(net_names[i])));
+        if (n == nullptr)
+        {
+            return nullptr;
+        }
+
+        if (srcs[i].gate != NO_ELEMENT)
+        {
+            if (srcs[i].gate >= num_of_gates)
+            {
+                log_error("netlist.persistent", "net {:08x} has an invalid src gate.", net_ids[i]);
+                return nullptr;
+            }
+            if (!builder.set_src(n, gates[srcs[i].gate], std::string(get_string(srcs[i].pin))))
+            {
+                return nullptr;
+            }
+        }
+        for (u32 j = dst_offsets[i]; j < dst_offsets[i + 1]; ++j)
+        {
+            if (dsts[j].gate >= num_of_gates)
+            {
+                log_error("netlist.persistent", "net {:08x} has an invalid dst gate.", net_ids[i]);
+                return nullptr;
+            }
+            if (!builder.add_dst(n, gates[dsts[j].gate], std::string(get_string(dsts[j].pin))))
+            {
+                return nullptr;
+            }
+        }
+
+        if (load_data)
+        {
+            set_data(n, NET_DATA_OFFSETS, NET_DATA, i);
+        }
+
+        if ((net_flags[i] & FLAG_GLOBAL_IN) && !nl->mark_global_input_net(n))
+        {
+            return nullptr;
+        }
+        if ((net_flags[i] & FLAG_GLOBAL_OUT) && !nl->mark_global_output_net(n))
+        {
+            return nullptr;
+        }
+    }
+
+    // the first module is the top module, all other modules succeed their parents
+    std::vector<std::shared_ptr<module>> modules;
+    auto module_ids          = get_column<u32>(MODULE_IDS);
+    auto module_names        = get_column<u32>(MODULE_NAMES);
+    auto module_parents      = get_column<u32>(MODULE_PARENTS);
+    auto module_gate_offsets = get_column<u32>(MODULE_GATE_OFFSETS);
+    auto module_gates        = get_column<u32>(MODULE_GATES);
+    for (u32 i = 0; i < get_num_of_modules(); ++i)
+    {
+        std::shared_ptr<module> m;
+        if (i == 0)
+        {
+            m = nl->get_top_module();
+        }
+        else if (module_parents[i] < i)
+        {
+            m = nl->create_module(module_ids[i], std::string(get_string(module_names[i])), modules[module_parents[i]]);
+        }
+        if (m == nullptr)
+        {
+            log_error("netlist.persistent", "cannot create module {:08x}.", module_ids[i]);
+            return nullptr;
+        }
+        modules.push_back(m);
+
+        for (u32 j = module_gate_offsets[i]; j < module_gate_offsets[i + 1]; ++j)
+        {
+            if (module_gates[j] >= num_of_gates)
+            {
+                log_error("netlist.persistent", "module {:08x} contains an invalid gate.", module_ids[i]);
+                return nullptr;
+            }
+            builder.assign_gate(m, gates[module_gates[j]]);
+        }
+
+        if (load_data)
+        {
+            set_data(m, MODULE_DATA_OFFSETS, MODULE_DATA, i);
+        }
+    }
+
+    builder.commit();
+
+    return nl;
+}
+
+std::string_view netlist_binary_file::get_extension() const
+{
+    return m_sections.empty() ? std::string_view() : m_sections[EXTENSION];
+}
+
+std::string_view netlist_binary_file::get_gate_library_name() const
+{
+    return m_sections.empty() ? std::string_view() : get_string(get_column<u32>(NETLIST_INFO)[INFO_GATE_LIBRARY]);
+}
+
+u32 netlist_binary_file::get_num_of_gates() const
+{
+    return get_column_size(GATE_IDS, sizeof(u32));
+}
+
+u32 netlist_binary_file::get_num_of_nets() const
+{
+    return get_column_size(NET_IDS, sizeof(u32));
+}
+
+u32 netlist_binary_file::get_num_of_modules() const
+{
+    return get_column_size(MODULE_IDS, sizeof(u32));
+}
+
+u32 netlist_binary_file::get_gate_id(u32 index) const
+{
+    return get_column<u32>(GATE_IDS)[index];
+}
+
+u32 netlist_binary_file::get_net_id(u32 index) const
+{
+    return get_column<u32>(NET_IDS)[index];
+}
+
+u32 netlist_binary_file::get_module_id(u32 index) const
+{
+    return get_column<u32>(MODULE_IDS)[index];
+}
+
+std::string_view netlist_binary_file::get_gate_name(u32 index) const
+{
+    return get_string(get_column<u32>(GATE_NAMES)[index]);
+}
+
+std::string_view netlist_binary_file::get_net_name(u32 index) const
+{
+    return get_string(get_column<u32>(NET_NAMES)[index]);
+}
+
+std::string_view netlist_binary_file::get_module_name(u32 index) const
+{
+    return get_string(get_column<u32>(MODULE_NAMES)[index]);
+}
+
+std::string_view netlist_binary_file::get_gate_type(u32 index) const
+{
+    u32 type_index = get_column<u32>(GATE_TYPE_INDICES)[index];
+    if (type_index >= get_column_size(GATE_TYPES, sizeof(u32)))
+    {
+        return std::string_view();
+    }
+    return get_string(get_column<u32>(GATE_TYPES)[type_index]);
+}
+
+std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> netlist_binary_file::get_gate_data(u32 index) const
+{
+    return get_data(GATE_DATA_OFFSETS, GATE_DATA, index);
+}
+
+std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> netlist_binary_file::get_net_data(u32 index) const
+{
+    return get_data(NET_DATA_OFFSETS, NET_DATA, index);
+}
+
+std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> netlist_binary_file::get_module_data(u32 index) const
+{
+    return get_data(MODULE_DATA_OFFSETS, MODULE_DATA, index);
+}
+
+template<typename T>
+const T* netlist_binary_file::get_column(u32 section) const
+{
+    return reinterpret_cast<const T*>(m_sections[section].data());
+}
+
+u32 netlist_binary_file::get_column_size(u32 section, u32 element_size) const
+{
+    if (section >= m_sections.size())
+    {
+        return 0;
+    }
+    return m_sections[section].size() / element_size;
+}
+
+std::string_view netlist_binary_file::get_string(u32 index) const
+{
+    if (index >= m_num_of_strings)
+    {
+        return std::string_view();
+    }
+    const auto& strings = m_sections[STRINGS];
+    auto offsets        = reinterpret_cast<const u64*>(strings.data() + sizeof(u64));
+    auto chars          = strings.data() + (m_num_of_strings + 2) * sizeof(u64);
+    return std::string_view(chars + offsets[index], offsets[index + 1] - offsets[index]);
+}
+
+std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> netlist_binary_file::get_data(u32 offsets_section, u32 entries_section, u32 index) const
+{
+    std::map<std::tuple<std::string, std::string>, std::tuple<std::string, std::string>> result;
+    auto offsets = get_column<u32>(offsets_section);
+    auto entries = get_column<data_entry>(entries_section);
+    for (u32 i = offsets[index]; i < offsets[index + 1]; ++i)
+    {
+        const auto& e = entries[i];
+        result.emplace(std::make_tuple(std::string(get_string(e.category)), std::string(get_string(e.key))),
+                       std::make_tuple(std::string(get_string(e.data_type)), std::string(get_string(e.value))));
+    }
+    return result;
+}
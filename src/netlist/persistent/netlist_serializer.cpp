@@ -5,6 +5,8 @@
 #include "netlist/module.h"
 #include "netlist/net.h"
 #include "netlist/netlist.h"
+#include "netlist/netlist_builder.h"
+#include "netlist/persistent/netlist_binary_file.h"
 
 #include "netlist/event_system/event_controls.h"
 
@@ -14,6 +16,7 @@
 #include "core/log.h"
 
 #include "rapidjson/filereadstream.h"
+#include "rapidjson/reader.h"
 #include "rapidjson/stringbuffer.h"
 
 #define PRETTY_JSON_OUTPUT false
@@ -25,6 +28,8 @@
 
 #include <chrono>
 #include <fstream>
+#include <map>
+#include <set>
 #include <sstream>
 
 #ifndef DURATION
@@ -58,7 +63,7 @@ namespace netlist_serializer
         {
             rapidjson::Value val(rapidjson::kObjectType);
             val.AddMember("gate_id", ep.gate->get_id(), allocator);
-            val.AddMember("pin_type", ep.pin_type, allocator);
+            val.AddMember("pin_type", ep.get_pin_type(), allocator);
             return val;
         }
 
@@ -236,196 +241,714 @@ namespace netlist_serializer
     // deserializing functions
     namespace
     {
-#define assert_availablility(MEMBER)                                                               \
-    if (!root.HasMember(MEMBER))                                                                   \
-    {                                                                                              \
-        log_critical("netlist.persistent", "'netlist' node does not include a '{}' node", MEMBER); \
-        return nullptr;                                                                            \
-    }
-
-        endpoint deserialize_endpoint(std::shared_ptr<netlist> nl, const rapidjson::Value& val)
+        // a gate, net, or module entry that is collected while reading and created once the entry is complete
+        struct element_entry
         {
-            return {nl->get_gate_by_id(val["gate_id"].GetUint()), val["pin_type"].GetString()};
-        }
-
-        void deserialize_data(std::shared_ptr<data_container> c, const rapidjson::Value& val)
+            struct endpoint_entry
+            {
+                u32 gate_id = 0;
+                std::string pin_type;
+            };
+
+            u32 id = 0;
+            std::string name;
+            std::string type;
+            u32 parent = 0;
+            bool has_src = false;
+            endpoint_entry src;
+            std::vector<endpoint_entry> dsts;
+            std::vector<u32> gates;
+            std::vector<std::vector<std::string>> data;
+            std::vector<std::pair<std::string, std::string>> functions;
+        };
+
+        /*
+         * SAX handler that builds the netlist while the .hal file is read, so the file is never held in memory as a JSON document.
+         * Gates, nets, and modules are created as soon as their entry and everything it refers to is complete, e.g., nets once all gates
+         * have been read. Entries that precede the elements they refer to are kept until the end of the file.
+         * All top-level members except for the netlist are collected for the hal_file_manager callbacks.
+         */
+        class netlist_handler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, netlist_handler>
         {
-            for (const auto& entry : val.GetArray())
+        public:
+            netlist_handler() : m_extension_writer(m_extension_buffer)
             {
-                c->set_data(entry[0].GetString(), entry[1].GetString(), entry[2].GetString(), entry[3].GetString());
+                m_extension_writer.StartObject();
             }
-        }
 
-        bool deserialize_gate(std::shared_ptr<netlist> nl, const rapidjson::Value& val)
-        {
-            auto gt_name    = val["type"].GetString();
-            auto gate_types = nl->get_gate_library()->get_gate_types();
-            auto it         = gate_types.find(gt_name);
-            if (it != gate_types.end())
+            bool Null()
             {
-                auto g = nl->create_gate(val["id"].GetUint(), it->second, val["name"].GetString());
+                return is_forwarding() ? m_extension_writer.Null() : true;
+            }
 
-                if (g == nullptr)
+            bool Bool(bool b)
+            {
+                return is_forwarding() ? m_extension_writer.Bool(b) : true;
+            }
+
+            bool Int(int i)
+            {
+                if (is_forwarding())
                 {
-                    return false;
+                    return m_extension_writer.Int(i);
                 }
+                return (i < 0) || handle_uint(i);
+            }
 
-                if (val.HasMember("data"))
+            bool Uint(unsigned u)
+            {
+                return is_forwarding() ? m_extension_writer.Uint(u) : handle_uint(u);
+            }
+
+            bool Int64(int64_t i)
+            {
+                return is_forwarding() ? m_extension_writer.Int64(i) : true;
+            }
+
+            bool Uint64(uint64_t u)
+            {
+                return is_forwarding() ? m_extension_writer.Uint64(u) : true;
+            }
+
+            bool Double(double d)
+            {
+                return is_forwarding() ? m_extension_writer.Double(d) : true;
+            }
+
+            bool String(const char* str, rapidjson::SizeType length, bool copy)
+            {
+                return is_forwarding() ? m_extension_writer.String(str, length, copy) : handle_string(std::string(str, length));
+            }
+
+            bool Key(const char* str, rapidjson::SizeType length, bool copy)
+            {
+                if (m_scopes.empty() || m_scopes.back() == scope::extension)
                 {
-                    deserialize_data(g, val["data"]);
+                    return m_scopes.empty() || m_extension_writer.Key(str, length, copy);
                 }
 
-                if (val.HasMember("custom_functions"))
+                m_key = std::string(str, length);
+                if (m_scopes.back() == scope::root && m_key != "netlist" && m_key != "serialization_format_version")
                 {
-                    auto functions = val["custom_functions"].GetObject();
-                    for (auto f_it = functions.MemberBegin(); f_it != functions.MemberEnd(); ++f_it)
-                    {
-                        g->add_boolean_function(f_it->name.GetString(), boolean_function::from_string(f_it->value.GetString()));
-                    }
+                    return m_extension_writer.Key(str, length, copy);
+                }
+                if (m_scopes.back() == scope::netlist)
+                {
+                    m_netlist_members.insert(m_key);
+                }
+                return true;
+            }
+
+            bool StartObject()
+            {
+                if (m_scopes.empty())
+                {
+                    m_scopes.push_back(scope::root);
+                    return true;
                 }
 
+                switch (m_scopes.back())
+                {
+                    case scope::root:
+                        if (m_key == "netlist")
+                        {
+                            m_scopes.push_back(scope::netlist);
+                            return true;
+                        }
+                        return start_extension(true);
+                    case scope::extension:
+                        return start_extension(true);
+                    case scope::element_list:
+                        m_element = element_entry();
+                        m_scopes.push_back(scope::element);
+                        return true;
+                    case scope::element:
+                        if (m_key == "src")
+                        {
+                            m_endpoint = element_entry::endpoint_entry();
+                            m_scopes.push_back(scope::endpoint);
+                            return true;
+                        }
+                        if (m_key == "custom_functions")
+                        {
+                            m_scopes.push_back(scope::functions);
+                            return true;
+                        }
+                        break;
+                    case scope::endpoint_list:
+                        m_endpoint = element_entry::endpoint_entry();
+                        m_scopes.push_back(scope::endpoint);
+                        return true;
+                    default:
+                        break;
+                }
+                m_scopes.push_back(scope::ignore);
                 return true;
             }
 
-            return false;
-        }
+            bool EndObject(rapidjson::SizeType member_count)
+            {
+                auto current = m_scopes.back();
+                m_scopes.pop_back();
 
-        bool deserialize_net(std::shared_ptr<netlist> nl, const rapidjson::Value& val)
-        {
-            auto n = nl->create_net(val["id"].GetUint(), val["name"].GetString());
-            if (n == nullptr)
+                if (current == scope::extension)
+                {
+                    return m_extension_writer.EndObject(member_count);
+                }
+                if (current == scope::element)
+                {
+                    return create_element();
+                }
+                if (current == scope::endpoint)
+                {
+                    if (m_scopes.back() == scope::element)
+                    {
+                        m_element.has_src = true;
+                        m_element.src     = m_endpoint;
+                    }
+                    else
+                    {
+                        m_element.dsts.push_back(m_endpoint);
+                    }
+                }
+                return true;
+            }
+
+            bool StartArray()
             {
-                return false;
+                if (m_scopes.empty())
+                {
+                    m_scopes.push_back(scope::ignore);
+                    return true;
+                }
+
+                switch (m_scopes.back())
+                {
+                    case scope::root:
+                        if (m_key != "netlist" && m_key != "serialization_format_version")
+                        {
+                            return start_extension(false);
+                        }
+                        break;
+                    case scope::extension:
+                        return start_extension(false);
+                    case scope::netlist:
+                        if (m_key == "gates" || m_key == "nets" || m_key == "modules")
+                        {
+                            m_element_list = m_key;
+                            m_scopes.push_back(scope::element_list);
+                            return true;
+                        }
+                        if (m_global_ids.find(m_key) != m_global_ids.end())
+                        {
+                            m_id_list = &m_global_ids.at(m_key);
+                            m_scopes.push_back(scope::id_list);
+                            return true;
+                        }
+                        break;
+                    case scope::element:
+                        if (m_key == "dsts")
+                        {
+                            m_scopes.push_back(scope::endpoint_list);
+                            return true;
+                        }
+                        if (m_key == "data")
+                        {
+                            m_scopes.push_back(scope::data_list);
+                            return true;
+                        }
+                        if (m_key == "gates")
+                        {
+                            m_id_list = &m_element.gates;
+                            m_scopes.push_back(scope::id_list);
+                            return true;
+                        }
+                        break;
+                    case scope::data_list:
+                        m_element.data.emplace_back();
+                        m_scopes.push_back(scope::data_entry);
+                        return true;
+                    default:
+                        break;
+                }
+                m_scopes.push_back(scope::ignore);
+                return true;
             }
 
-            if (val.HasMember("src"))
+            bool EndArray(rapidjson::SizeType element_count)
             {
-                n->set_src(deserialize_endpoint(nl, val["src"]));
+                auto current = m_scopes.back();
+                m_scopes.pop_back();
+
+                if (current == scope::extension)
+                {
+                    return m_extension_writer.EndArray(element_count);
+                }
+                if (current == scope::element_list && m_element_list == "gates")
+                {
+                    m_gates_read = true;
+                }
+                return true;
             }
-            if (val.HasMember("dsts"))
+
+            /*
+             * Applies everything that is not created while reading and returns the netlist.
+             */
+            std::shared_ptr<netlist> finish()
             {
-                for (const auto& dst_node : val["dsts"].GetArray())
+                if (m_netlist == nullptr)
+                {
+                    log_critical("netlist.persistent", "file does not include a 'netlist' node");
+                    return nullptr;
+                }
+
+                for (const auto& member :
+                     {"gate_library", "id", "input_file", "design_name", "device_name", "gates", "global_vcc", "global_gnd", "nets", "global_in", "global_out", "modules"})
+                {
+                    if (m_netlist_members.find(member) == m_netlist_members.end())
+                    {
+                        log_critical("netlist.persistent", "'netlist' node does not include a '{}' node", member);
+                        return nullptr;
+                    }
+                }
+
+                m_netlist->set_id(m_netlist_id);
+                m_netlist->set_input_filename(m_input_file);
+                m_netlist->set_design_name(m_design_name);
+                m_netlist->set_device_name(m_device_name);
+
+                // resolve everything that preceded the elements it refers to in the same order as if the file was sorted
+                for (const auto& e : m_pending_gates)
+                {
+                    if (!create_gate(e))
+                    {
+                        return nullptr;
+                    }
+                }
+                m_pending_gates.clear();
+
+                for (auto id : m_global_ids.at("global_vcc"))
+                {
+                    if (!m_netlist->mark_vcc_gate(m_netlist->get_gate_by_id(id)))
+                    {
+                        log_error("netlist.persistent", "cannot mark gate with id {} as global vcc gate.", id);
+                        return nullptr;
+                    }
+                }
+                for (auto id : m_global_ids.at("global_gnd"))
+                {
+                    if (!m_netlist->mark_gnd_gate(m_netlist->get_gate_by_id(id)))
+                    {
+                        log_error("netlist.persistent", "cannot mark gate with id {} as global gnd gate.", id);
+                        return nullptr;
+                    }
+                }
+
+                for (const auto& e : m_pending_nets)
+                {
+                    if (!create_net(e))
+                    {
+                        return nullptr;
+                    }
+                }
+
+                for (auto id : m_global_ids.at("global_in"))
+                {
+                    if (!m_netlist->mark_global_input_net(m_netlist->get_net_by_id(id)))
+                    {
+                        log_error("netlist.persistent", "cannot mark net with id {} as global input net.", id);
+                        return nullptr;
+                    }
+                }
+                for (auto id : m_global_ids.at("global_out"))
+                {
+                    if (!m_netlist->mark_global_output_net(m_netlist->get_net_by_id(id)))
+                    {
+                        log_error("netlist.persistent", "cannot mark net with id {} as global output net.", id);
+                        return nullptr;
+                    }
+                }
+
+                // modules may also precede their parent module, so create them in rounds until no more parents are missing
+                while (!m_pending_modules.empty())
                 {
-                    n->add_dst(deserialize_endpoint(nl, dst_node));
+                    std::vector<element_entry> remaining;
+                    for (auto& e : m_pending_modules)
+                    {
+                        if (!can_create_module(e))
+                        {
+                            remaining.push_back(std::move(e));
+                        }
+                        else if (!create_module(e))
+                        {
+                            return nullptr;
+                        }
+                    }
+                    if (remaining.size() == m_pending_modules.size())
+                    {
+                        log_error("netlist.persistent", "parent module with id {} of module '{}' does not exist.", remaining[0].parent, remaining[0].name);
+                        return nullptr;
+                    }
+                    m_pending_modules = std::move(remaining);
                 }
+
+                m_builder->commit();
+
+                return m_netlist;
             }
 
-            if (val.HasMember("data"))
+            bool has_failed() const
             {
-                deserialize_data(n, val["data"]);
+                return m_failed;
             }
 
-            return true;
-        }
+            u32 get_version() const
+            {
+                return m_version;
+            }
 
-        bool deserialize_module(std::shared_ptr<netlist> nl, const rapidjson::Value& val)
-        {
-            auto parent_id             = val["parent"].GetUint();
-            std::shared_ptr<module> sm = nl->get_top_module();
-            if (parent_id != 0)
+            /*
+             * Returns all top-level members except for the netlist as a JSON object.
+             */
+            std::string get_extension()
+            {
+                m_extension_writer.EndObject();
+                return m_extension_buffer.GetString();
+            }
+
+        private:
+            enum class scope
             {
-                sm = nl->create_module(val["id"].GetUint(), val["name"].GetString(), nl->get_module_by_id(parent_id));
-                if (sm == nullptr)
+                root,
+                netlist,
+                element_list,
+                element,
+                endpoint,
+                endpoint_list,
+                functions,
+                data_list,
+                data_entry,
+                id_list,
+                extension,
+                ignore
+            };
+
+            bool is_forwarding() const
+            {
+                if (m_scopes.empty())
                 {
                     return false;
                 }
+                return m_scopes.back() == scope::extension || (m_scopes.back() == scope::root && m_key != "netlist" && m_key != "serialization_format_version");
+            }
+
+            bool start_extension(bool is_object)
+            {
+                m_scopes.push_back(scope::extension);
+                return is_object ? m_extension_writer.StartObject() : m_extension_writer.StartArray();
+            }
+
+            bool handle_uint(u32 value)
+            {
+                switch (m_scopes.back())
+                {
+                    case scope::root:
+                        if (m_key == "serialization_format_version")
+                        {
+                            m_version = value;
+                        }
+                        break;
+                    case scope::netlist:
+                        if (m_key == "id")
+                        {
+                            m_netlist_id = value;
+                        }
+                        break;
+                    case scope::element:
+                        if (m_key == "id")
+                        {
+                            m_element.id = value;
+                        }
+                        else if (m_key == "parent")
+                        {
+                            m_element.parent = value;
+                        }
+                        break;
+                    case scope::endpoint:
+                        if (m_key == "gate_id")
+                        {
+                            m_endpoint.gate_id = value;
+                        }
+                        break;
+                    case scope::id_list:
+                        m_id_list->push_back(value);
+                        break;
+                    default:
+                        break;
+                }
+                return true;
             }
 
-            if (val.HasMember("gates"))
+            bool handle_string(const std::string& value)
             {
-                for (const auto& gate_node : val["gates"].GetArray())
+                switch (m_scopes.back())
                 {
-                    sm->assign_gate(nl->get_gate_by_id(gate_node.GetUint()));
+                    case scope::netlist:
+                        if (m_key == "gate_library")
+                        {
+                            return create_netlist(value);
+                        }
+                        else if (m_key == "input_file")
+                        {
+                            m_input_file = value;
+                        }
+                        else if (m_key == "design_name")
+                        {
+                            m_design_name = value;
+                        }
+                        else if (m_key == "device_name")
+                        {
+                            m_device_name = value;
+                        }
+                        break;
+                    case scope::element:
+                        if (m_key == "name")
+                        {
+                            m_element.name = value;
+                        }
+                        else if (m_key == "type")
+                        {
+                            m_element.type = value;
+                        }
+                        break;
+                    case scope::endpoint:
+                        if (m_key == "pin_type")
+                        {
+                            m_endpoint.pin_type = value;
+                        }
+                        break;
+                    case scope::functions:
+                        m_element.functions.emplace_back(m_key, value);
+                        break;
+                    case scope::data_entry:
+                        m_element.data.back().push_back(value);
+                        break;
+                    default:
+                        break;
                 }
+                return true;
             }
 
-            if (val.HasMember("data"))
+            bool create_netlist(const std::string& gate_library_name)
             {
-                deserialize_data(sm, val["data"]);
+                if (m_netlist != nullptr)
+                {
+                    return true;
+                }
+
+                auto lib = gate_library_manager::get_gate_library(gate_library_name);
+                if (lib == nullptr)
+                {
+                    log_critical("netlist.persistent", "error loading gate library '{}'.", gate_library_name);
+                    return fail();
+                }
+
+                m_netlist = std::make_shared<netlist>(lib);
+                m_builder = std::make_unique<netlist_builder>(m_netlist);
+                return true;
             }
-            return true;
-        }
 
-        std::shared_ptr<netlist> deserialize(const rapidjson::Document& document)
-        {
-            if (!document.HasMember("netlist"))
+            bool create_element()
             {
-                log_critical("netlist.persistent", "file does not include a 'netlist' node");
-                return nullptr;
+                if (m_element_list == "gates")
+                {
+                    if (m_netlist == nullptr)
+                    {
+                        m_pending_gates.push_back(std::move(m_element));
+                        return true;
+                    }
+                    return create_gate(m_element) || fail();
+                }
+                if (m_element_list == "nets")
+                {
+                    if (!all_gates_created())
+                    {
+                        m_pending_nets.push_back(std::move(m_element));
+                        return true;
+                    }
+                    return create_net(m_element) || fail();
+                }
+                if (!all_gates_created() || !can_create_module(m_element))
+                {
+                    m_pending_modules.push_back(std::move(m_element));
+                    return true;
+                }
+                return create_module(m_element) || fail();
             }
-            auto root = document["netlist"].GetObject();
-            assert_availablility("gate_library");
 
-            auto lib = gate_library_manager::get_gate_library(root["gate_library"].GetString());
-            if (lib == nullptr)
+            bool all_gates_created() const
             {
-                log_critical("netlist.persistent", "error loading gate library '{}'.", root["gate_library"].GetString());
-                return nullptr;
+                return m_gates_read && m_pending_gates.empty();
             }
 
-            std::shared_ptr<netlist> nl = std::make_shared<netlist>(lib);
+            bool can_create_module(const element_entry& e) const
+            {
+                return e.parent == 0 || m_netlist->get_module_by_id(e.parent) != nullptr;
+            }
 
-            assert_availablility("id");
-            nl->set_id(root["id"].GetUint());
+            void set_data(const std::shared_ptr<data_container>& c, const element_entry& e)
+            {
+                for (const auto& entry : e.data)
+                {
+                    if (entry.size() == 4)
+                    {
+                        c->set_data(entry[0], entry[1], entry[2], entry[3]);
+                    }
+                }
+            }
 
-            assert_availablility("input_file");
-            nl->set_input_filename(root["input_file"].GetString());
+            bool create_gate(const element_entry& e)
+            {
+                const auto& gate_types = m_netlist->get_gate_library()->get_gate_types();
+                auto it                = gate_types.find(e.type);
+                if (it == gate_types.end())
+                {
+                    log_error("netlist.persistent", "gate type '{}' does not exist in gate library '{}'.", e.type, m_netlist->get_gate_library()->get_name());
+                    return false;
+                }
 
-            assert_availablility("design_name");
-            nl->set_design_name(root["design_name"].GetString());
+                auto g = m_builder->create_gate(e.id, it->second, e.name);
+                if (g == nullptr)
+                {
+                    return false;
+                }
 
-            assert_availablility("device_name");
-            nl->set_device_name(root["device_name"].GetString());
+                set_data(g, e);
+                for (const auto& [name, function] : e.functions)
+                {
+                    g->add_boolean_function(name, boolean_function::from_string(function));
+                }
+                return true;
+            }
 
-            assert_availablility("gates");
-            for (const auto& gate_node : root["gates"].GetArray())
+            bool create_net(const element_entry& e)
             {
-                if (!deserialize_gate(nl, gate_node))
+                auto n = m_builder->create_net(e.id, e.name);
+                if (n == nullptr)
                 {
-                    return nullptr;
+                    return false;
+                }
+
+                if (e.has_src && !m_builder->set_src(n, m_netlist->get_gate_by_id(e.src.gate_id), e.src.pin_type))
+                {
+                    log_error("netlist.persistent", "cannot set gate with id {} (pin '{}') as src of net '{}'.", e.src.gate_id, e.src.pin_type, e.name);
+                    return false;
+                }
+                for (const auto& dst : e.dsts)
+                {
+                    if (!m_builder->add_dst(n, m_netlist->get_gate_by_id(dst.gate_id), dst.pin_type))
+                    {
+                        log_error("netlist.persistent", "cannot add gate with id {} (pin '{}') as dst of net '{}'.", dst.gate_id, dst.pin_type, e.name);
+                        return false;
+                    }
                 }
+
+                set_data(n, e);
+                return true;
             }
 
-            assert_availablility("global_vcc");
-            for (const auto& gate_node : root["global_vcc"].GetArray())
+            bool create_module(const element_entry& e)
             {
-                nl->mark_vcc_gate(nl->get_gate_by_id(gate_node.GetUint()));
+                std::shared_ptr<module> sm = m_netlist->get_top_module();
+                if (e.parent != 0)
+                {
+                    sm = m_netlist->create_module(e.id, e.name, m_netlist->get_module_by_id(e.parent));
+                    if (sm == nullptr)
+                    {
+                        return false;
+                    }
+                }
+
+                for (auto id : e.gates)
+                {
+                    // the assignment itself fails for gates that are already part of the module, which is fine
+                    auto g = m_netlist->get_gate_by_id(id);
+                    if (g == nullptr)
+                    {
+                        log_error("netlist.persistent", "cannot assign gate with id {} to module '{}'.", id, e.name);
+                        return false;
+                    }
+                    m_builder->assign_gate(sm, g);
+                }
+
+                set_data(sm, e);
+                return true;
             }
 
-            assert_availablility("global_gnd");
-            for (const auto& gate_node : root["global_gnd"].GetArray())
+            bool fail()
             {
-                nl->mark_gnd_gate(nl->get_gate_by_id(gate_node.GetUint()));
+                m_failed = true;
+                return false;
             }
 
-            assert_availablility("nets");
-            for (const auto& net_node : root["nets"].GetArray())
+            std::vector<scope> m_scopes;
+            std::string m_key;
+            bool m_failed = false;
+            u32 m_version = 0;
+
+            std::shared_ptr<netlist> m_netlist;
+            std::unique_ptr<netlist_builder> m_builder;
+            std::set<std::string> m_netlist_members;
+            u32 m_netlist_id = 0;
+            std::string m_input_file;
+            std::string m_design_name;
+            std::string m_device_name;
+
+            std::string m_element_list;
+            element_entry m_element;
+            element_entry::endpoint_entry m_endpoint;
+            bool m_gates_read = false;
+            std::vector<element_entry> m_pending_gates;
+            std::vector<element_entry> m_pending_nets;
+            std::vector<element_entry> m_pending_modules;
+            std::vector<u32>* m_id_list = nullptr;
+            std::map<std::string, std::vector<u32>> m_global_ids = {{"global_vcc", {}}, {"global_gnd", {}}, {"global_in", {}}, {"global_out", {}}};
+
+            rapidjson::StringBuffer m_extension_buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> m_extension_writer;
+        };
+
+        std::shared_ptr<netlist> deserialize_binary(const hal::path& hal_file)
+        {
+            netlist_binary_file file;
+            if (!file.open(hal_file))
             {
-                if (!deserialize_net(nl, net_node))
-                {
-                    return nullptr;
-                }
+                return nullptr;
             }
 
-            assert_availablility("global_in");
-            for (const auto& net_node : root["global_in"].GetArray())
+            std::shared_ptr<netlist> nl = file.create_netlist();
+            if (nl == nullptr)
             {
-                nl->mark_global_input_net(nl->get_net_by_id(net_node.GetUint()));
+                return nullptr;
             }
 
-            assert_availablility("global_out");
-            for (const auto& net_node : root["global_out"].GetArray())
+            // the content of the hal_file_manager callbacks is stored as JSON alongside the netlist
+            rapidjson::Document document;
+            auto extension = file.get_extension();
+            if (extension.empty())
+            {
+                document.SetObject();
+            }
+            else if (document.Parse(extension.data(), extension.size()).HasParseError())
             {
-                nl->mark_global_output_net(nl->get_net_by_id(net_node.GetUint()));
+                log_error("netlist.persistent", "invalid json string for deserialization");
+                return nullptr;
             }
 
-            assert_availablility("modules");
-            for (const auto& module_node : root["modules"].GetArray())
+            if (!hal_file_manager::deserialize(hal_file, nl, document))
             {
-                if (!deserialize_module(nl, module_node))
-                {
-                    return nullptr;
-                }
+                log_info("netlist.persistent", "deserialization failed");
+                return nullptr;
             }
 
             return nl;
@@ -474,10 +997,52 @@ namespace netlist_serializer
         return true;
     }
 
+    bool serialize_to_binary_file(std::shared_ptr<netlist> nl, const hal::path& hal_file)
+    {
+        auto begin_time = std::chrono::high_resolution_clock::now();
+
+        rapidjson::Document document;
+        document.SetObject();
+
+        if (!hal_file_manager::serialize(hal_file, nl, document))
+        {
+            log_info("netlist.persistent", "serialization failed");
+            return false;
+        }
+
+        std::string extension;
+        if (document.MemberCount() > 0)
+        {
+            rapidjson::StringBuffer strbuf;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
+            document.Accept(writer);
+            extension = strbuf.GetString();
+        }
+
+        if (!netlist_binary_file::write(nl, hal_file, extension))
+        {
+            return false;
+        }
+
+        log_info("netlist.persistent", "serialized netlist in {:2.2f} seconds", DURATION(begin_time));
+
+        return true;
+    }
+
     std::shared_ptr<netlist> deserialize_from_file(const hal::path& hal_file)
     {
         auto begin_time = std::chrono::high_resolution_clock::now();
 
+        if (netlist_binary_file::is_binary_file(hal_file))
+        {
+            std::shared_ptr<netlist> netlist = deserialize_binary(hal_file);
+            if (netlist != nullptr)
+            {
+                log_info("netlist.persistent", "deserialized '{}' in {:2.2f} seconds", hal_file.string(), DURATION(begin_time));
+            }
+            return netlist;
+        }
+
         // event_controls::enable_all(false);
 
         FILE* pFile = fopen(hal_file.string().c_str(), "rb");
@@ -487,36 +1052,44 @@ namespace netlist_serializer
             return nullptr;
         }
 
+        // the netlist is built while reading, the file is never held in memory as a JSON document
         char buffer[65536];
         rapidjson::FileReadStream is(pFile, buffer, sizeof(buffer));
-        rapidjson::Document document;
-        document.ParseStream<0, rapidjson::UTF8<>, rapidjson::FileReadStream>(is);
+        rapidjson::Reader reader;
+        netlist_handler handler;
+        auto result = reader.Parse(is, handler);
         fclose(pFile);
 
-        if (document.HasParseError())
+        if (handler.has_failed())
+        {
+            return nullptr;
+        }
+        if (result.IsError())
         {
             log_error("netlist.persistent", "invalid json string for deserialization");
             return nullptr;
         }
 
-        if (document.HasMember("serialization_format_version"))
+        u32 encoded_version = handler.get_version();
+        if (encoded_version < SERIALIZON_FORMAT_VERSION)
         {
-            u32 encoded_version = document["serialization_format_version"].GetUint();
-            if (encoded_version < SERIALIZON_FORMAT_VERSION)
-            {
-                log_warning("netlist.persistent", "the netlist was serialized with an older version of the serializer, deserialization may contain errors.");
-            }
-            else if (encoded_version > SERIALIZON_FORMAT_VERSION)
-            {
-                log_warning("netlist.persistent", "the netlist was serialized with a newer version of the serializer, deserialization may contain errors.");
-            }
+            log_warning("netlist.persistent", "the netlist was serialized with an older version of the serializer, deserialization may contain errors.");
         }
-        else
+        else if (encoded_version > SERIALIZON_FORMAT_VERSION)
         {
-            log_warning("netlist.persistent", "the netlist was serialized with an older version of the serializer, deserialization may contain errors.");
+            log_warning("netlist.persistent", "the netlist was serialized with a newer version of the serializer, deserialization may contain errors.");
+        }
+
+        std::shared_ptr<netlist> netlist = handler.finish();
+        if (netlist == nullptr)
+        {
+            return nullptr;
         }
 
-        std::shared_ptr<netlist> netlist = deserialize(document);
+        // the hal_file_manager callbacks receive all top-level members except for the netlist
+        auto extension = handler.get_extension();
+        rapidjson::Document document;
+        document.Parse(extension.c_str());
 
         if (!hal_file_manager::deserialize(hal_file, netlist, document))
         {
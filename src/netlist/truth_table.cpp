@@ -0,0 +1,370 @@
+#include "netlist/truth_table.h"
+
+#include "core/log.h"
+
+#include <algorithm>
+#include <string_view>
+
+// the bit patterns of the first six variables within a word
+static const u64 VARIABLE_PATTERNS[6] = {0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull, 0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
+
+truth_table::truth_table(u32 num_variables, boolean_function::value constant)
+{
+    if (num_variables > MAX_VARIABLES)
+    {
+        log_error("netlist", "truth tables support at most {} variables, {} given.", MAX_VARIABLES, num_variables);
+        num_variables = MAX_VARIABLES;
+    }
+
+    m_num_variables = num_variables;
+
+    u32 num_words = (num_variables <= 6) ? 1 : (1u << (num_variables - 6));
+    m_ones.assign(num_words, (constant == boolean_function::ONE) ? ~0ull : 0ull);
+    m_unknowns.assign(num_words, (constant == boolean_function::X) ? ~0ull : 0ull);
+    clear_unused_bits();
+}
+
+truth_table truth_table::variable(u32 num_variables, u32 index)
+{
+    truth_table result(num_variables);
+    if (index >= result.m_num_variables)
+    {
+        log_error("netlist", "variable index {} exceeds the {} variables of the truth table.", index, result.m_num_variables);
+        return result;
+    }
+
+    for (u32 i = 0; i < result.m_ones.size(); ++i)
+    {
+        if (index < 6)
+        {
+            result.m_ones[i] = VARIABLE_PATTERNS[index];
+        }
+        else
+        {
+            result.m_ones[i] = ((i >> (index - 6)) & 1) ? ~0ull : 0ull;
+        }
+    }
+    result.clear_unused_bits();
+    return result;
+}
+
+truth_table truth_table::from_vector(const std::vector<boolean_function::value>& outputs)
+{
+    u32 num_variables = 0;
+    while ((1ull << num_variables) < outputs.size())
+    {
+        num_variables++;
+    }
+    if ((1ull << num_variables) != outputs.size())
+    {
+        log_error("netlist", "the number of truth table outputs ({}) is not a power of two.", outputs.size());
+        return truth_table();
+    }
+
+    truth_table result(num_variables);
+    for (u32 i = 0; i < result.size(); ++i)
+    {
+        result.set_value(i, outputs[i]);
+    }
+    return result;
+}
+
+truth_table truth_table::from_words(u32 num_variables, const std::vector<u64>& ones)
+{
+    truth_table result(num_variables);
+    for (u32 i = 0; i < result.m_ones.size() && i < ones.size(); ++i)
+    {
+        result.m_ones[i] = ones[i];
+    }
+    result.clear_unused_bits();
+    return result;
+}
+
+truth_table truth_table::from_hex_string(u32 num_variables, const std::string& hex)
+{
+    truth_table result(num_variables);
+    std::string_view digits = hex;
+    if (digits.size() > 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X'))
+    {
+        digits.remove_prefix(2);
+    }
+    u32 num_digits = std::min((u64)digits.size(), ((u64)result.size() + 3) / 4);
+    for (u32 i = 0; i < num_digits; ++i)
+    {
+        char c    = digits[digits.size() - 1 - i];
+        u64 digit = 0;
+        if (c >= '0' && c <= '9')
+        {
+            digit = c - '0';
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            digit = c - 'a' + 10;
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            digit = c - 'A' + 10;
+        }
+        else
+        {
+            log_error("netlist", "invalid hex digit '{}' in '{}'.", c, hex);
+            return truth_table(num_variables);
+        }
+        result.m_ones[i / 16] |= digit << (4 * (i % 16));
+    }
+    result.clear_unused_bits();
+    return result;
+}
+
+std::string truth_table::to_hex_string() const
+{
+    u32 num_digits = std::max(1u, size() / 4);
+    std::string result(num_digits, '0');
+    for (u32 i = 0; i < num_digits; ++i)
+    {
+        result[num_digits - 1 - i] = "0123456789abcdef"[(m_ones[i / 16] >> (4 * (i % 16))) & 0xF];
+    }
+    return result;
+}
+
+truth_table truth_table::reverse() const
+{
+    auto reverse_word = [](u64 w) {
+        w = ((w >> 1) & 0x5555555555555555ull) | ((w & 0x5555555555555555ull) << 1);
+        w = ((w >> 2) & 0x3333333333333333ull) | ((w & 0x3333333333333333ull) << 2);
+        w = ((w >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((w & 0x0F0F0F0F0F0F0F0Full) << 4);
+        w = ((w >> 8) & 0x00FF00FF00FF00FFull) | ((w & 0x00FF00FF00FF00FFull) << 8);
+        w = ((w >> 16) & 0x0000FFFF0000FFFFull) | ((w & 0x0000FFFF0000FFFFull) << 16);
+        return (w >> 32) | (w << 32);
+    };
+
+    truth_table result = *this;
+    u32 num_words      = m_ones.size();
+    for (u32 i = 0; i < num_words; ++i)
+    {
+        result.m_ones[i]     = reverse_word(m_ones[num_words - 1 - i]);
+        result.m_unknowns[i] = reverse_word(m_unknowns[num_words - 1 - i]);
+    }
+
+    // tables smaller than a word end up in the upper bits
+    if (size() < 64)
+    {
+        result.m_ones[0] >>= 64 - size();
+        result.m_unknowns[0] >>= 64 - size();
+    }
+    return result;
+}
+
+u32 truth_table::get_num_variables() const
+{
+    return m_num_variables;
+}
+
+u32 truth_table::size() const
+{
+    return 1u << m_num_variables;
+}
+
+boolean_function::value truth_table::get_value(u32 assignment) const
+{
+    u64 bit = 1ull << (assignment & 63);
+    if (m_unknowns[assignment >> 6] & bit)
+    {
+        return boolean_function::X;
+    }
+    return (m_ones[assignment >> 6] & bit) ? boolean_function::ONE : boolean_function::ZERO;
+}
+
+void truth_table::set_value(u32 assignment, boolean_function::value v)
+{
+    u64 bit = 1ull << (assignment & 63);
+    m_ones[assignment >> 6] &= ~bit;
+    m_unknowns[assignment >> 6] &= ~bit;
+    if (v == boolean_function::ONE)
+    {
+        m_ones[assignment >> 6] |= bit;
+    }
+    else if (v == boolean_function::X)
+    {
+        m_unknowns[assignment >> 6] |= bit;
+    }
+}
+
+std::vector<boolean_function::value> truth_table::to_vector() const
+{
+    std::vector<boolean_function::value> result(size());
+    for (u32 i = 0; i < result.size(); ++i)
+    {
+        result[i] = get_value(i);
+    }
+    return result;
+}
+
+const std::vector<u64>& truth_table::get_ones() const
+{
+    return m_ones;
+}
+
+const std::vector<u64>& truth_table::get_unknowns() const
+{
+    return m_unknowns;
+}
+
+truth_table truth_table::cofactor(u32 index, bool value) const
+{
+    if (index >= m_num_variables)
+    {
+        return *this;
+    }
+
+    truth_table result = *this;
+    if (index < 6)
+    {
+        // move the half of every word that matches the value onto the other half
+        u32 shift = 1u << index;
+        u64 mask  = value ? VARIABLE_PATTERNS[index] : ~VARIABLE_PATTERNS[index];
+        for (u32 i = 0; i < m_ones.size(); ++i)
+        {
+            u64 ones     = m_ones[i] & mask;
+            u64 unknowns = m_unknowns[i] & mask;
+            if (value)
+            {
+                result.m_ones[i]     = ones | (ones >> shift);
+                result.m_unknowns[i] = unknowns | (unknowns >> shift);
+            }
+            else
+            {
+                result.m_ones[i]     = ones | (ones << shift);
+                result.m_unknowns[i] = unknowns | (unknowns << shift);
+            }
+        }
+    }
+    else
+    {
+        // the variable selects entire words
+        u32 stride = 1u << (index - 6);
+        for (u32 i = 0; i < m_ones.size(); ++i)
+        {
+            u32 source           = value ? (i | stride) : (i & ~stride);
+            result.m_ones[i]     = m_ones[source];
+            result.m_unknowns[i] = m_unknowns[source];
+        }
+    }
+    result.clear_unused_bits();
+    return result;
+}
+
+bool truth_table::depends_on(u32 index) const
+{
+    return cofactor(index, false) != cofactor(index, true);
+}
+
+bool truth_table::is_constant(boolean_function::value constant) const
+{
+    return *this == truth_table(m_num_variables, constant);
+}
+
+truth_table truth_table::operator&(const truth_table& other) const
+{
+    auto result = *this;
+    result &= other;
+    return result;
+}
+
+truth_table truth_table::operator|(const truth_table& other) const
+{
+    auto result = *this;
+    result |= other;
+    return result;
+}
+
+truth_table truth_table::operator^(const truth_table& other) const
+{
+    auto result = *this;
+    result ^= other;
+    return result;
+}
+
+truth_table& truth_table::operator&=(const truth_table& other)
+{
+    if (m_num_variables != other.m_num_variables)
+    {
+        log_error("netlist", "cannot combine truth tables of {} and {} variables.", m_num_variables, other.m_num_variables);
+        return *this;
+    }
+
+    // a known ZERO dominates, otherwise X dominates
+    for (u32 i = 0; i < m_ones.size(); ++i)
+    {
+        u64 zeros   = (~m_ones[i] & ~m_unknowns[i]) | (~other.m_ones[i] & ~other.m_unknowns[i]);
+        m_unknowns[i] = (m_unknowns[i] | other.m_unknowns[i]) & ~zeros;
+        m_ones[i] &= other.m_ones[i];
+    }
+    clear_unused_bits();
+    return *this;
+}
+
+truth_table& truth_table::operator|=(const truth_table& other)
+{
+    if (m_num_variables != other.m_num_variables)
+    {
+        log_error("netlist", "cannot combine truth tables of {} and {} variables.", m_num_variables, other.m_num_variables);
+        return *this;
+    }
+
+    // a known ONE dominates, otherwise X dominates
+    for (u32 i = 0; i < m_ones.size(); ++i)
+    {
+        m_ones[i] |= other.m_ones[i];
+        m_unknowns[i] = (m_unknowns[i] | other.m_unknowns[i]) & ~m_ones[i];
+    }
+    return *this;
+}
+
+truth_table& truth_table::operator^=(const truth_table& other)
+{
+    if (m_num_variables != other.m_num_variables)
+    {
+        log_error("netlist", "cannot combine truth tables of {} and {} variables.", m_num_variables, other.m_num_variables);
+        return *this;
+    }
+
+    // X dominates
+    for (u32 i = 0; i < m_ones.size(); ++i)
+    {
+        m_unknowns[i] |= other.m_unknowns[i];
+        m_ones[i] = (m_ones[i] ^ other.m_ones[i]) & ~m_unknowns[i];
+    }
+    return *this;
+}
+
+truth_table truth_table::operator!() const
+{
+    auto result = *this;
+    for (u32 i = 0; i < m_ones.size(); ++i)
+    {
+        result.m_ones[i] = ~m_ones[i] & ~m_unknowns[i];
+    }
+    result.clear_unused_bits();
+    return result;
+}
+
+bool truth_table::operator==(const truth_table& other) const
+{
+    return m_num_variables == other.m_num_variables && m_ones == other.m_ones && m_unknowns == other.m_unknowns;
+}
+
+bool truth_table::operator!=(const truth_table& other) const
+{
+    return !(*this == other);
+}
+
+void truth_table::clear_unused_bits()
+{
+    if (m_num_variables < 6)
+    {
+        u64 mask = (1ull << (1u << m_num_variables)) - 1;
+        m_ones[0] &= mask;
+        m_unknowns[0] &= mask;
+    }
+}
@@ -19,6 +19,7 @@
 #include "netlist/net.h"
 #include "netlist/netlist.h"
 #include "netlist/netlist_factory.h"
+#include "netlist/netlist_graph_snapshot.h"
 #include "netlist/persistent/netlist_serializer.h"
 #include "gui/gui_api/gui_api.h"
 
@@ -989,6 +990,14 @@ py_netlist.def("get_gates", &netlist::get_gates, py::arg("filter") = nullptr, R"
         :rtype: set[hal_py.gate]
 )");
 
+py_netlist.def("get_num_of_gates", &netlist::get_num_of_gates, R"(
+        Get the number of gates in the netlist regardless of the module they are in.
+        Faster than len(get_gates()).
+
+        :returns: The number of gates.
+        :rtype: int
+)");
+
 py_netlist.def("mark_vcc_gate", &netlist::mark_vcc_gate, py::arg("gate"), R"(
         Mark a gate as global vcc gate.
 
@@ -1204,6 +1213,190 @@ py_netlist.def("get_global_output_nets", &netlist::get_global_output_nets, R"(
         :rtype: set[hal_py.net]
 )");
 
+py_netlist.def("get_graph_snapshot", [](const std::shared_ptr<netlist>& n){return std::const_pointer_cast<netlist_graph_snapshot>(n->get_graph_snapshot());}, R"(
+        Get a read-only CSR snapshot of the gate-level graph of the netlist.
+        The snapshot is shared until the netlist is structurally modified.
+
+        :returns: The graph snapshot.
+        :rtype: hal_py.netlist_graph_snapshot
+)");
+
+py::class_<netlist_graph_snapshot, std::shared_ptr<netlist_graph_snapshot>> py_netlist_graph_snapshot(m, "netlist_graph_snapshot", R"(
+        Immutable snapshot of the gate-level graph of a netlist stored in compressed sparse row format.
+        Gates and nets are numbered densely starting at 0.
+)");
+
+py::class_<netlist_graph_snapshot::edge>(py_netlist_graph_snapshot, "edge", R"(
+        A gate-to-gate connection.
+)")
+        .def_readonly("gate", &netlist_graph_snapshot::edge::gate, R"(
+        The index of the adjacent gate.
+
+        :type: int
+)")
+        .def_readonly("net", &netlist_graph_snapshot::edge::net, R"(
+        The index of the net the connection runs through.
+
+        :type: int
+)")
+        .def_readonly("src_pin", &netlist_graph_snapshot::edge::src_pin, R"(
+        The index of the output pin at the source gate.
+
+        :type: int
+)")
+        .def_readonly("dst_pin", &netlist_graph_snapshot::edge::dst_pin, R"(
+        The index of the input pin at the destination gate.
+
+        :type: int
+)");
+
+py::class_<netlist_graph_snapshot::pin_net>(py_netlist_graph_snapshot, "pin_net", R"(
+        A gate-to-net connection.
+)")
+        .def_readonly("pin", &netlist_graph_snapshot::pin_net::pin, R"(
+        The index of the pin at the gate.
+
+        :type: int
+)")
+        .def_readonly("net", &netlist_graph_snapshot::pin_net::net, R"(
+        The index of the connected net.
+
+        :type: int
+)");
+
+py_netlist_graph_snapshot.def("get_num_of_gates", &netlist_graph_snapshot::get_num_of_gates, R"(
+        Get the number of gates in the snapshot.
+
+        :returns: The number of gates.
+        :rtype: int
+)");
+
+py_netlist_graph_snapshot.def("get_num_of_nets", &netlist_graph_snapshot::get_num_of_nets, R"(
+        Get the number of nets in the snapshot.
+
+        :returns: The number of nets.
+        :rtype: int
+)");
+
+py_netlist_graph_snapshot.def("get_num_of_edges", &netlist_graph_snapshot::get_num_of_edges, R"(
+        Get the number of gate-to-gate connections in the snapshot.
+
+        :returns: The number of edges.
+        :rtype: int
+)");
+
+py_netlist_graph_snapshot.def("get_gate", [](const netlist_graph_snapshot& self, u32 index) {
+        if (index >= self.get_num_of_gates())
+        {
+            throw py::index_error("gate index " + std::to_string(index) + " out of range");
+        }
+        return self.get_gate(index);
+    }, py::arg("index"), R"(
+        Get the gate with the given index.
+
+        :param int index: The index of the gate.
+        :returns: The gate.
+        :rtype: hal_py.gate
+        :raises IndexError: If the index is out of range.
+)");
+
+py_netlist_graph_snapshot.def("get_net", [](const netlist_graph_snapshot& self, u32 index) {
+        if (index >= self.get_num_of_nets())
+        {
+            throw py::index_error("net index " + std::to_string(index) + " out of range");
+        }
+        return self.get_net(index);
+    }, py::arg("index"), R"(
+        Get the net with the given index.
+
+        :param int index: The index of the net.
+        :returns: The net.
+        :rtype: hal_py.net
+        :raises IndexError: If the index is out of range.
+)");
+
+py_netlist_graph_snapshot.def("get_gate_index", &netlist_graph_snapshot::get_gate_index, py::arg("gate"), R"(
+        Get the index of a gate within the snapshot.
+
+        :param gate: The gate.
+        :type gate: hal_py.gate
+        :returns: The index of the gate or 0xFFFFFFFF if the gate is not part of the snapshot.
+        :rtype: int
+)");
+
+py_netlist_graph_snapshot.def("get_net_index", &netlist_graph_snapshot::get_net_index, py::arg("net"), R"(
+        Get the index of a net within the snapshot.
+
+        :param net: The net.
+        :type net: hal_py.net
+        :returns: The index of the net or 0xFFFFFFFF if the net is not part of the snapshot.
+        :rtype: int
+)");
+
+py_netlist_graph_snapshot.def("get_successors", [](const netlist_graph_snapshot& self, u32 index) {
+        if (index >= self.get_num_of_gates())
+        {
+            throw py::index_error("gate index " + std::to_string(index) + " out of range");
+        }
+        auto r = self.get_successors(index);
+        return std::vector<netlist_graph_snapshot::edge>(r.begin(), r.end());
+    }, py::arg("index"), R"(
+        Get the direct successors of a gate.
+
+        :param int index: The index of the gate.
+        :returns: The outgoing edges of the gate, 'gate' referring to the successor.
+        :rtype: list[hal_py.netlist_graph_snapshot.edge]
+        :raises IndexError: If the index is out of range.
+)");
+
+py_netlist_graph_snapshot.def("get_predecessors", [](const netlist_graph_snapshot& self, u32 index) {
+        if (index >= self.get_num_of_gates())
+        {
+            throw py::index_error("gate index " + std::to_string(index) + " out of range");
+        }
+        auto r = self.get_predecessors(index);
+        return std::vector<netlist_graph_snapshot::edge>(r.begin(), r.end());
+    }, py::arg("index"), R"(
+        Get the direct predecessors of a gate.
+
+        :param int index: The index of the gate.
+        :returns: The incoming edges of the gate, 'gate' referring to the predecessor.
+        :rtype: list[hal_py.netlist_graph_snapshot.edge]
+        :raises IndexError: If the index is out of range.
+)");
+
+py_netlist_graph_snapshot.def("get_fan_in_nets", [](const netlist_graph_snapshot& self, u32 index) {
+        if (index >= self.get_num_of_gates())
+        {
+            throw py::index_error("gate index " + std::to_string(index) + " out of range");
+        }
+        auto r = self.get_fan_in_nets(index);
+        return std::vector<netlist_graph_snapshot::pin_net>(r.begin(), r.end());
+    }, py::arg("index"), R"(
+        Get the nets connected to the input pins of a gate.
+
+        :param int index: The index of the gate.
+        :returns: The fan-in nets along with the input pin indices.
+        :rtype: list[hal_py.netlist_graph_snapshot.pin_net]
+        :raises IndexError: If the index is out of range.
+)");
+
+py_netlist_graph_snapshot.def("get_fan_out_nets", [](const netlist_graph_snapshot& self, u32 index) {
+        if (index >= self.get_num_of_gates())
+        {
+            throw py::index_error("gate index " + std::to_string(index) + " out of range");
+        }
+        auto r = self.get_fan_out_nets(index);
+        return std::vector<netlist_graph_snapshot::pin_net>(r.begin(), r.end());
+    }, py::arg("index"), R"(
+        Get the nets connected to the output pins of a gate.
+
+        :param int index: The index of the gate.
+        :returns: The fan-out nets along with the output pin indices.
+        :rtype: list[hal_py.netlist_graph_snapshot.pin_net]
+        :raises IndexError: If the index is out of range.
+)");
+
 py::class_<gate, data_container, std::shared_ptr<gate>> py_gate(m, "gate", R"(Gate class containing information about a gate including its location, functions, and module.)");
 
 py_gate.def_property_readonly("id", &gate::get_id, R"(
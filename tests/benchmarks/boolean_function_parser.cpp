@@ -0,0 +1,351 @@
+#include <core/utils.h>
+#include <netlist/boolean_function.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // the recursive string splitting parser that from_string used before, kept as a reference
+    boolean_function legacy_from_string_internal(std::string expression, const std::vector<std::string>& variable_names)
+    {
+        expression = core_utils::trim(expression);
+
+        if (expression.empty())
+        {
+            return boolean_function();
+        }
+
+        const std::string delimiters = "!^&|'+* ";
+
+        if (expression == "0")
+        {
+            return boolean_function(boolean_function::ZERO);
+        }
+        else if (expression == "1")
+        {
+            return boolean_function(boolean_function::ONE);
+        }
+        else if (expression == "X")
+        {
+            return boolean_function(boolean_function::X);
+        }
+        else
+        {
+            bool is_term = false;
+            for (const auto& d : delimiters + "()")
+            {
+                if (expression.find(d) != std::string::npos)
+                {
+                    is_term = true;
+                    break;
+                }
+            }
+            if (!is_term)
+            {
+                if (core_utils::starts_with(expression, "__v_"))
+                {
+                    u32 idx    = std::stoul(expression.substr(4));
+                    expression = variable_names[idx];
+                }
+
+                return boolean_function(expression);
+            }
+        }
+
+        i32 level = 0;
+        for (const auto& c : expression)
+        {
+            if (c == '(')
+            {
+                level += 1;
+            }
+            else if (c == ')')
+            {
+                level -= 1;
+                if (level < 0)
+                {
+                    return boolean_function::X;
+                }
+            }
+        }
+        if (level != 0)
+        {
+            return boolean_function::X;
+        }
+
+        std::vector<std::string> terms;
+        {
+            std::string current_term;
+            u32 bracket_level = 0;
+            for (u32 i = 0; i < expression.size(); i++)
+            {
+                if (expression[i] == '(')
+                {
+                    if (bracket_level == 0)
+                    {
+                        current_term = core_utils::trim(current_term);
+                        if (!current_term.empty())
+                        {
+                            terms.push_back(current_term);
+                            current_term.clear();
+                        }
+                    }
+
+                    bracket_level++;
+                }
+
+                if (bracket_level == 0 && delimiters.find(expression[i]) != std::string::npos)
+                {
+                    current_term = core_utils::trim(current_term);
+                    if (!current_term.empty())
+                    {
+                        terms.push_back(current_term);
+                        current_term.clear();
+                    }
+                    if (expression[i] != ' ')
+                    {
+                        terms.push_back(std::string(1, expression[i]));
+                    }
+                }
+                else
+                {
+                    current_term += expression[i];
+                }
+
+                if (expression[i] == ')')
+                {
+                    bracket_level--;
+
+                    if (bracket_level == 0)
+                    {
+                        current_term = core_utils::trim(current_term);
+                        if (!current_term.empty())
+                        {
+                            terms.push_back(current_term);
+                            current_term.clear();
+                        }
+                    }
+                }
+            }
+            current_term = core_utils::trim(current_term);
+            if (!current_term.empty())
+            {
+                terms.push_back(current_term);
+            }
+        }
+
+        if (terms.size() == 1)
+        {
+            return legacy_from_string_internal(terms[0].substr(1, terms[0].size() - 2), variable_names);
+        }
+
+        struct op_term
+        {
+            char op;
+            boolean_function term;
+        };
+        std::vector<op_term> parsed_terms;
+
+        bool negate_next = false;
+        char next_op     = '&';
+
+        {
+            u32 i = 0;
+            while (terms[i] == "!")
+            {
+                negate_next = !negate_next;
+                ++i;
+            }
+            boolean_function first_term = legacy_from_string_internal(terms[i], variable_names);
+            while (i + 1 < terms.size() && terms[i + 1] == "'")
+            {
+                negate_next = !negate_next;
+                ++i;
+            }
+            if (negate_next)
+            {
+                first_term  = !first_term;
+                negate_next = false;
+            }
+
+            parsed_terms.push_back({'&', first_term});
+
+            while (++i < terms.size())
+            {
+                if (terms[i] == "!")
+                {
+                    negate_next = !negate_next;
+                }
+                else if (terms[i] == "&" || terms[i] == "*")
+                {
+                    next_op = '&';
+                }
+                else if (terms[i] == "|" || terms[i] == "+")
+                {
+                    next_op = '|';
+                }
+                else if (terms[i] == "^")
+                {
+                    next_op = '^';
+                }
+                else
+                {
+                    auto next_term = legacy_from_string_internal(terms[i], variable_names);
+                    while (i + 1 < terms.size() && terms[i + 1] == "'")
+                    {
+                        negate_next = !negate_next;
+                        ++i;
+                    }
+                    if (negate_next)
+                    {
+                        next_term = !next_term;
+                    }
+
+                    parsed_terms.push_back({next_op, next_term});
+
+                    negate_next = false;
+                    next_op     = '&';
+                }
+            }
+        }
+
+        for (char op : {'&', '^', '|'})
+        {
+            for (u32 i = 1; i < parsed_terms.size(); ++i)
+            {
+                if (parsed_terms[i].op == op)
+                {
+                    auto& previous = parsed_terms[i - 1].term;
+                    previous       = (op == '&') ? (previous & parsed_terms[i].term) : ((op == '^') ? (previous ^ parsed_terms[i].term) : (previous | parsed_terms[i].term));
+                    parsed_terms.erase(parsed_terms.begin() + i);
+                    --i;
+                }
+            }
+        }
+
+        return parsed_terms[0].term;
+    }
+
+    boolean_function legacy_from_string(std::string expression, const std::vector<std::string>& variable_names = {})
+    {
+        auto sorted_variable_names = variable_names;
+        std::sort(sorted_variable_names.begin(), sorted_variable_names.end(), [](const auto& a, const auto& b) { return a.size() > b.size(); });
+
+        for (u32 i = 0; i < sorted_variable_names.size(); ++i)
+        {
+            auto pos = expression.find(sorted_variable_names[i]);
+            if (pos != std::string::npos)
+            {
+                expression.replace(pos, sorted_variable_names[i].size(), "__v_" + std::to_string(i));
+            }
+        }
+
+        return legacy_from_string_internal(expression, sorted_variable_names);
+    }
+
+    // generates a random expression in the syntax of liberty files
+    std::string random_expression(std::mt19937& rng, u32 depth)
+    {
+        static const std::vector<std::string> atoms     = {"A", "B", "CLK", "I0", "I1", "I2", "SEL", "D[3]", "0", "1", "X"};
+        static const std::vector<std::string> operators = {" & ", "*", " | ", "+", " ^ ", " ", "&", "|"};
+
+        std::string result;
+        u32 num_terms = 1 + rng() % 4;
+        for (u32 i = 0; i < num_terms; ++i)
+        {
+            if (i > 0)
+            {
+                result += operators[rng() % operators.size()];
+            }
+            if (rng() % 4 == 0)
+            {
+                result += "!";
+            }
+            if (depth > 0 && rng() % 3 == 0)
+            {
+                result += "(" + random_expression(rng, depth - 1) + ")";
+            }
+            else
+            {
+                result += atoms[rng() % atoms.size()];
+            }
+            if (rng() % 5 == 0)
+            {
+                result += "'";
+            }
+        }
+        return result;
+    }
+}    // namespace
+
+// Compares the single-pass parser of boolean_function::from_string with the recursive parser it replaced.
+// Both parsers have to build the same functions before their timings are reported.
+//
+// Usage: benchmark-boolean_function_parser [number of expressions] [repetitions]
+int main(int argc, char* argv[])
+{
+    u32 num_expressions = (argc > 1) ? std::stoul(argv[1]) : 5000;
+    u32 repetitions     = (argc > 2) ? std::max(1ul, std::stoul(argv[2])) : 5;
+
+    std::mt19937 rng(1234);
+    std::vector<std::string> expressions;
+    for (u32 i = 0; i < num_expressions; ++i)
+    {
+        expressions.push_back(random_expression(rng, 4));
+    }
+    std::vector<std::string> pins = {"A", "B", "CLK", "I0", "I1", "I2", "SEL"};
+
+    // with and without known variable names
+    for (const auto& variable_names : {pins, std::vector<std::string>()})
+    {
+        for (const auto& e : expressions)
+        {
+            auto expected = legacy_from_string(e, variable_names).to_string();
+            auto actual   = boolean_function::from_string(e, variable_names).to_string();
+            if (actual != expected)
+            {
+                std::cerr << "parsers differ on '" << e << "': '" << actual << "' instead of '" << expected << "'" << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    // the fastest of several runs is the least disturbed by other processes
+    auto measure = [&](auto parse) {
+        i64 best = -1;
+        for (u32 r = 0; r < repetitions; ++r)
+        {
+            auto begin = std::chrono::steady_clock::now();
+            u64 size   = 0;
+            for (const auto& e : expressions)
+            {
+                size += parse(e).get_variables().size();
+            }
+            auto end = std::chrono::steady_clock::now();
+            if (size == 0)
+            {
+                std::cerr << "no variables were parsed" << std::endl;
+            }
+            i64 time = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+            best     = (best < 0) ? time : std::min(best, time);
+        }
+        return best;
+    };
+
+    auto legacy_time = measure([&](const std::string& e) { return legacy_from_string(e, pins); });
+    auto time        = measure([&](const std::string& e) { return boolean_function::from_string(e, pins); });
+
+    std::cout << "parsed " << expressions.size() << " expressions, best of " << repetitions << " runs" << std::endl;
+    std::cout << "  single-pass parser: " << time << "us" << std::endl;
+    std::cout << "  previous parser:    " << legacy_time << "us" << std::endl;
+    if (time > 0)
+    {
+        std::cout << "  speedup:            " << (double)legacy_time / time << "x" << std::endl;
+    }
+    return 0;
+}
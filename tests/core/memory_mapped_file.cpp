@@ -0,0 +1,100 @@
+#include "test_def.h"
+#include "gtest/gtest.h"
+#include <core/log.h>
+#include <core/memory_mapped_file.h>
+#include <core/utils.h>
+#include <experimental/filesystem>
+#include <fstream>
+#include <iostream>
+
+class memory_mapped_file_test : public ::testing::Test
+{
+protected:
+    hal::path m_tmp_dir;
+
+    virtual void SetUp()
+    {
+        m_tmp_dir = core_utils::get_binary_directory() / "tmp_memory_mapped_file";
+        hal::fs::create_directory(m_tmp_dir);
+    }
+
+    virtual void TearDown()
+    {
+        hal::fs::remove_all(m_tmp_dir);
+    }
+
+    hal::path create_file(const std::string& name, const std::string& content)
+    {
+        hal::path file_path = m_tmp_dir / name;
+        std::ofstream ofs(file_path.string(), std::ios::out | std::ios::binary);
+        ofs << content;
+        ofs.close();
+        return file_path;
+    }
+};
+
+/**
+ * Testing the mapping of files into memory
+ *
+ * Functions: map_file, unmap_file, get_data, get_file_name
+ */
+TEST_F(memory_mapped_file_test, check_map_file)
+{
+    TEST_START
+        // ########################
+        // POSITIVE TESTS
+        // ########################
+        {
+            // Map a file with content
+            std::string content = "module top;\nendmodule\n";
+            hal::path file_path = create_file("content.v", content);
+
+            memory_mapped_file file;
+            ASSERT_TRUE(file.map_file(file_path.string()));
+            EXPECT_EQ(file.get_file_name(), file_path.string());
+            EXPECT_EQ(file.get_data(), content);
+
+            EXPECT_TRUE(file.unmap_file());
+            EXPECT_TRUE(file.get_data().empty());
+        }
+        {
+            // Map an empty file
+            hal::path file_path = create_file("empty.v", "");
+
+            memory_mapped_file file;
+            ASSERT_TRUE(file.map_file(file_path.string()));
+            EXPECT_TRUE(file.get_data().empty());
+        }
+        {
+            // Mapping another file replaces the previous mapping
+            hal::path file_path_0 = create_file("file_0.v", "file_0");
+            hal::path file_path_1 = create_file("file_1.v", "file_1");
+
+            memory_mapped_file file;
+            ASSERT_TRUE(file.map_file(file_path_0.string()));
+            ASSERT_TRUE(file.map_file(file_path_1.string()));
+            EXPECT_EQ(file.get_data(), "file_1");
+        }
+        // ########################
+        // NEGATIVE TESTS
+        // ########################
+        {
+            // Map a file that does not exist
+            NO_COUT_TEST_BLOCK;
+            memory_mapped_file file;
+            EXPECT_FALSE(file.map_file((m_tmp_dir / "does_not_exist.v").string()));
+            EXPECT_TRUE(file.get_data().empty());
+        }
+        {
+            // Unmap a file that is not mapped
+            NO_COUT_TEST_BLOCK;
+            memory_mapped_file file;
+            EXPECT_FALSE(file.unmap_file());
+
+            hal::path file_path = create_file("unmapped.v", "unmapped");
+            ASSERT_TRUE(file.map_file(file_path.string()));
+            EXPECT_TRUE(file.unmap_file());
+            EXPECT_FALSE(file.unmap_file());
+        }
+    TEST_END
+}
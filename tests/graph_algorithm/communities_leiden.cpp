@@ -0,0 +1,130 @@
+#include "netlist/gate_library/gate_library_manager.h"
+#include "netlist/netlist.h"
+#include "netlist_test_utils.h"
+#include "plugin_graph_algorithm.h"
+#include "gtest/gtest.h"
+#include <netlist/gate.h>
+#include <netlist/net.h>
+
+using namespace test_utils;
+
+class communities_leiden_test : public ::testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        NO_COUT_BLOCK;
+        gate_library_manager::load_all();
+        plugin_graph_algorithm().initialize_logging();
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+    // creates a densely connected cluster of AND4 gates, every gate is driven by the next three gates of the cluster
+    std::vector<std::shared_ptr<gate>> create_cluster(const std::shared_ptr<netlist>& nl, u32 size, const std::string& prefix)
+    {
+        std::vector<std::shared_ptr<gate>> gates;
+        std::vector<std::shared_ptr<net>> nets;
+        for (u32 i = 0; i < size; ++i)
+        {
+            gates.push_back(nl->create_gate(get_gate_type_by_name("AND4"), prefix + "_gate_" + std::to_string(i)));
+            nets.push_back(nl->create_net(prefix + "_net_" + std::to_string(i)));
+            nets.back()->set_src(gates.back(), "O");
+        }
+        for (u32 i = 0; i < size; ++i)
+        {
+            for (u32 j = 0; j < 3; ++j)
+            {
+                nets[(i + j + 1) % size]->add_dst(gates[i], "I" + std::to_string(j));
+            }
+        }
+        return gates;
+    }
+};
+
+/**
+ * Testing the detection of communities by the Leiden algorithm
+ *
+ * Functions: get_communities_leiden
+ */
+TEST_F(communities_leiden_test, check_communities)
+{
+    TEST_START
+        plugin_graph_algorithm plugin;
+        {
+            // Two clusters that are connected by a single net
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            auto cluster_0              = create_cluster(nl, 8, "c0");
+            auto cluster_1              = create_cluster(nl, 8, "c1");
+            cluster_1[0]->get_fan_out_net("O")->add_dst(cluster_0[0], "I3");
+
+            u32 num_gates = nl->get_gates().size();
+            u32 num_nets  = nl->get_nets().size();
+            u32 num_dsts  = 0;
+            for (const auto& n : nl->get_nets())
+            {
+                num_dsts += n->get_dsts().size();
+            }
+
+            auto communities = plugin.get_communities_leiden(nl);
+            ASSERT_EQ(communities.size(), num_gates);
+
+            u32 community_0 = communities.at(cluster_0[0]->get_id());
+            u32 community_1 = communities.at(cluster_1[0]->get_id());
+            EXPECT_NE(community_0, community_1);
+            for (u32 i = 0; i < 8; ++i)
+            {
+                EXPECT_EQ(communities.at(cluster_0[i]->get_id()), community_0);
+                EXPECT_EQ(communities.at(cluster_1[i]->get_id()), community_1);
+            }
+            EXPECT_EQ(std::set<u32>({community_0, community_1}), std::set<u32>({0, 1}));
+
+            // the netlist is not modified
+            u32 num_dsts_after = 0;
+            for (const auto& n : nl->get_nets())
+            {
+                num_dsts_after += n->get_dsts().size();
+            }
+            EXPECT_EQ(nl->get_gates().size(), num_gates);
+            EXPECT_EQ(nl->get_nets().size(), num_nets);
+            EXPECT_EQ(num_dsts_after, num_dsts);
+
+            // weighting the connections does not split the clusters
+            auto weighted = plugin.get_communities_leiden(nl, 1.0, [](const std::shared_ptr<net>& n) { return (n->get_id() % 2) ? 1.0 : 3.0; });
+            ASSERT_EQ(weighted.size(), num_gates);
+            for (u32 i = 0; i < 8; ++i)
+            {
+                EXPECT_EQ(weighted.at(cluster_0[i]->get_id()), weighted.at(cluster_0[0]->get_id()));
+                EXPECT_EQ(weighted.at(cluster_1[i]->get_id()), weighted.at(cluster_1[0]->get_id()));
+            }
+        }
+        {
+            // Unconnected gates form communities of their own
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            auto g_0                    = nl->create_gate(MIN_GATE_ID + 0, get_gate_type_by_name("AND4"), "gate_0");
+            auto g_1                    = nl->create_gate(MIN_GATE_ID + 1, get_gate_type_by_name("AND4"), "gate_1");
+
+            auto communities = plugin.get_communities_leiden(nl);
+            ASSERT_EQ(communities.size(), 2);
+            EXPECT_NE(communities.at(g_0->get_id()), communities.at(g_1->get_id()));
+        }
+        {
+            // An empty netlist has no communities
+            EXPECT_TRUE(plugin.get_communities_leiden(create_empty_netlist()).empty());
+        }
+        // ########################
+        // NEGATIVE TESTS
+        // ########################
+        {
+            // Invalid parameters
+            NO_COUT_TEST_BLOCK;
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            create_cluster(nl, 4, "c0");
+            EXPECT_TRUE(plugin.get_communities_leiden(nullptr).empty());
+            EXPECT_TRUE(plugin.get_communities_leiden(nl, -1.0).empty());
+            EXPECT_TRUE(plugin.get_communities_leiden(nl, 1.0, [](const std::shared_ptr<net>&) { return -1.0; }).empty());
+        }
+    TEST_END
+}
@@ -0,0 +1,232 @@
+#include "cone_extractor.h"
+#include "netlist/gate_library/gate_library_manager.h"
+#include "netlist/gate_library/gate_type/gate_type.h"
+#include "netlist/netlist.h"
+#include "netlist_test_utils.h"
+#include "plugin_graph_algorithm.h"
+#include "gtest/gtest.h"
+#include <netlist/gate.h>
+#include <netlist/net.h>
+#include <random>
+
+using namespace test_utils;
+
+class cone_extractor_test : public ::testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        NO_COUT_BLOCK;
+        gate_library_manager::load_all();
+        plugin_graph_algorithm().initialize_logging();
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+    // 0 (FF) -> {1, 2}, {1, 2} -> 3 -> 4 (FF), {4, 2} -> 5
+    std::vector<std::shared_ptr<gate>> create_reconvergent_netlist(const std::shared_ptr<netlist>& nl)
+    {
+        auto gates = create_test_gates(nl, {"FF", "AND2", "AND2", "AND2", "FF", "AND2"});
+        EXPECT_TRUE(connect_gates(gates[0], gates[1], "I0"));
+        EXPECT_TRUE(connect_gates(gates[0], gates[2], "I0"));
+        EXPECT_TRUE(connect_gates(gates[1], gates[3], "I0"));
+        EXPECT_TRUE(connect_gates(gates[2], gates[3], "I1"));
+        EXPECT_TRUE(connect_gates(gates[3], gates[4], "D"));
+        EXPECT_TRUE(connect_gates(gates[4], gates[5], "I0"));
+        EXPECT_TRUE(connect_gates(gates[2], gates[5], "I1"));
+        return gates;
+    }
+
+    // the levels of a cone as sets of gate IDs
+    std::vector<std::set<u32>> to_ids(const cone_extractor& cones, const std::vector<std::vector<u32>>& levels)
+    {
+        std::vector<std::set<u32>> result;
+        for (const auto& level : levels)
+        {
+            std::set<u32> ids;
+            for (u32 v : level)
+            {
+                ids.insert(cones.get_gate(v)->get_id());
+            }
+            EXPECT_EQ(ids.size(), level.size());
+            result.push_back(ids);
+        }
+        return result;
+    }
+
+    // the graph cut as computed before it was based on the cone extractor
+    std::vector<std::set<std::shared_ptr<gate>>> get_reference_graph_cut(const std::shared_ptr<gate>& current_gate, const u32 depth, const std::set<std::string>& terminal_gate_type)
+    {
+        std::vector<std::set<std::shared_ptr<gate>>> result;
+        result.push_back({current_gate});
+        for (u32 i = 1; i < depth; i++)
+        {
+            std::set<std::shared_ptr<gate>> next_state;
+            for (const auto& it : result.back())
+            {
+                for (const auto& predecessor : it->get_predecessors())
+                {
+                    if (terminal_gate_type.find(predecessor.get_gate()->get_type()->get_name()) == terminal_gate_type.end())
+                    {
+                        next_state.insert(predecessor.get_gate());
+                    }
+                }
+            }
+            if (next_state.empty())
+            {
+                break;
+            }
+            result.push_back(next_state);
+        }
+        return result;
+    }
+};
+
+/**
+ * Testing the extraction of fan-in and fan-out cones
+ *
+ * Functions: get_cone, get_cones, get_type_filter, get_type_id, get_num_of_types, get_index, get_gate
+ */
+TEST_F(cone_extractor_test, check_cones)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_empty_netlist();
+        auto gates                  = create_reconvergent_netlist(nl);
+        cone_extractor cones(nl);
+        std::vector<u32> v;
+        for (const auto& g : gates)
+        {
+            v.push_back(cones.get_index(g));
+            EXPECT_EQ(cones.get_gate(v.back()), g);
+        }
+        auto id = [](u32 i) { return MIN_GATE_ID + i; };
+        {
+            // Gate types
+            EXPECT_EQ(cones.get_num_of_types(), 2);
+            EXPECT_EQ(cones.get_type_id(v[0]), cones.get_type_id(v[4]));
+            EXPECT_NE(cones.get_type_id(v[0]), cones.get_type_id(v[1]));
+
+            auto filter = cones.get_type_filter({"FF", "UNKNOWN"});
+            ASSERT_EQ(filter.size(), 1);
+            EXPECT_EQ(filter[0], 1ull << cones.get_type_id(v[0]));
+        }
+        auto ff = cones.get_type_filter({"FF"});
+        {
+            // Fan-in cones, every gate is assigned to the first level it is reached in
+            EXPECT_EQ(to_ids(cones, cones.get_cone({v[5]})), std::vector<std::set<u32>>({{id(5)}, {id(4), id(2)}, {id(3), id(0)}, {id(1)}}));
+            EXPECT_EQ(to_ids(cones, cones.get_cone({v[5]}, false, 1)), std::vector<std::set<u32>>({{id(5)}, {id(4), id(2)}}));
+            EXPECT_EQ(to_ids(cones, cones.get_cone({v[5], v[3], v[5]})), std::vector<std::set<u32>>({{id(5), id(3)}, {id(4), id(2), id(1)}, {id(0)}}));
+
+            // terminal gates end the cone or are left out
+            EXPECT_EQ(to_ids(cones, cones.get_cone({v[5]}, false, cone_extractor::unlimited, ff)), std::vector<std::set<u32>>({{id(5)}, {id(4), id(2)}, {id(0)}}));
+            EXPECT_EQ(to_ids(cones, cones.get_cone({v[5]}, false, cone_extractor::unlimited, ff, false)), std::vector<std::set<u32>>({{id(5)}, {id(2)}}));
+
+            // with revisiting, gates appear in every level they can be reached in
+            EXPECT_EQ(to_ids(cones, cones.get_cone({v[5]}, false, cone_extractor::unlimited, {}, true, true)),
+                      std::vector<std::set<u32>>({{id(5)}, {id(4), id(2)}, {id(3), id(0)}, {id(1), id(2)}, {id(0)}}));
+        }
+        {
+            // Fan-out cones, terminal gates are expanded if they are a source
+            EXPECT_EQ(to_ids(cones, cones.get_cone({v[0]}, true, cone_extractor::unlimited, ff)), std::vector<std::set<u32>>({{id(0)}, {id(1), id(2)}, {id(3), id(5)}, {id(4)}}));
+            EXPECT_EQ(to_ids(cones, cones.get_cone({v[4]}, true, cone_extractor::unlimited, ff)), std::vector<std::set<u32>>({{id(4)}, {id(5)}}));
+        }
+        {
+            // The parallel extraction matches single cones
+            for (bool forward : {false, true})
+            {
+                auto all = cones.get_cones(v, forward, 3, ff);
+                ASSERT_EQ(all.size(), v.size());
+                for (u32 i = 0; i < v.size(); ++i)
+                {
+                    EXPECT_EQ(all[i], cones.get_cone({v[i]}, forward, 3, ff));
+                }
+            }
+        }
+        // ########################
+        // NEGATIVE TESTS
+        // ########################
+        {
+            // Invalid source
+            NO_COUT_TEST_BLOCK;
+            EXPECT_TRUE(cones.get_cone({(u32)gates.size()}).empty());
+            EXPECT_EQ(cones.get_index(nl->create_gate(get_gate_type_by_name("AND2"), "new_gate")), cone_extractor::invalid_index);
+        }
+    TEST_END
+}
+
+/**
+ * Testing the graph cut against the previous implementation
+ *
+ * Functions: get_graph_cut, get_cone_extractor
+ */
+TEST_F(cone_extractor_test, check_graph_cut)
+{
+    TEST_START
+        plugin_graph_algorithm plugin;
+        {
+            // Gates that are reached through paths of different lengths appear in several levels
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            auto gates                  = create_reconvergent_netlist(nl);
+            std::vector<std::set<std::shared_ptr<gate>>> expected = {{gates[5]}, {gates[4], gates[2]}, {gates[3], gates[0]}, {gates[1], gates[2]}, {gates[0]}};
+            EXPECT_EQ(plugin.get_graph_cut(nl, gates[5], 10), expected);
+            EXPECT_EQ(plugin.get_graph_cut(nl, gates[5], 10), get_reference_graph_cut(gates[5], 10, {}));
+            EXPECT_EQ(plugin.get_graph_cut(nl, gates[5], 10, {"FF"}), get_reference_graph_cut(gates[5], 10, {"FF"}));
+            EXPECT_EQ(plugin.get_graph_cut(nl, gates[5], 1), get_reference_graph_cut(gates[5], 1, {}));
+            EXPECT_EQ(plugin.get_graph_cut(nl, gates[5], 0), get_reference_graph_cut(gates[5], 0, {}));
+            EXPECT_EQ(plugin.get_graph_cut(nl, gates[5], std::numeric_limits<u32>::max(), {"FF"}), get_reference_graph_cut(gates[5], std::numeric_limits<u32>::max(), {"FF"}));
+        }
+        {
+            // Random netlist with flip-flops
+            std::mt19937 rng(3);
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            u32 num_gates               = 500;
+            std::vector<std::string> types;
+            for (u32 i = 0; i < num_gates; ++i)
+            {
+                types.push_back((i % 10 == 0) ? "FF" : "AND2");
+            }
+            auto gates = create_test_gates(nl, types);
+            for (u32 i = 0; i < num_gates; ++i)
+            {
+                if (i % 10 == 0)
+                {
+                    EXPECT_TRUE(connect_gates(gates[rng() % num_gates], gates[i], "D"));
+                    continue;
+                }
+                EXPECT_TRUE(connect_gates(gates[(i + 1 + rng() % 40) % num_gates], gates[i], "I0"));
+                EXPECT_TRUE(connect_gates(gates[(i + 1 + rng() % 40) % num_gates], gates[i], "I1"));
+            }
+
+            for (u32 i = 0; i < 100; ++i)
+            {
+                auto g                               = gates[rng() % num_gates];
+                u32 depth                            = rng() % 12;
+                std::set<std::string> terminal_types = (i % 5 == 1) ? std::set<std::string>() : std::set<std::string>({"FF"});
+                EXPECT_EQ(plugin.get_graph_cut(nl, g, depth, terminal_types), get_reference_graph_cut(g, depth, terminal_types));
+            }
+
+            // the extractor is kept until the netlist is modified
+            auto cones = plugin.get_cone_extractor(nl);
+            ASSERT_NE(cones, nullptr);
+            EXPECT_EQ(plugin.get_cone_extractor(nl), cones);
+            nl->create_gate(get_gate_type_by_name("AND2"), "new_gate");
+            EXPECT_NE(plugin.get_cone_extractor(nl), cones);
+        }
+        // ########################
+        // NEGATIVE TESTS
+        // ########################
+        {
+            // Invalid parameters
+            NO_COUT_TEST_BLOCK;
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            auto gates                  = create_reconvergent_netlist(nl);
+            EXPECT_TRUE(plugin.get_graph_cut(nullptr, gates[5], 2).empty());
+            EXPECT_TRUE(plugin.get_graph_cut(nl, nullptr, 2).empty());
+            EXPECT_TRUE(plugin.get_graph_cut(nl, gates[5], std::numeric_limits<u32>::max()).empty());
+            EXPECT_TRUE(plugin.get_graph_cut(nl, create_empty_netlist()->create_gate(get_gate_type_by_name("AND2"), "other_gate"), 2).empty());
+            EXPECT_EQ(plugin.get_cone_extractor(nullptr), nullptr);
+        }
+    TEST_END
+}
@@ -0,0 +1,162 @@
+#include "igraph_cache.h"
+#include "netlist/gate_library/gate_library_manager.h"
+#include "netlist/netlist.h"
+#include "netlist_test_utils.h"
+#include "plugin_graph_algorithm.h"
+#include "gtest/gtest.h"
+#include <netlist/gate.h>
+#include <netlist/net.h>
+#include <random>
+
+using namespace test_utils;
+
+class igraph_cache_test : public ::testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        NO_COUT_BLOCK;
+        gate_library_manager::load_all();
+        plugin_graph_algorithm().initialize_logging();
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+    // the edges of the graph as pairs of gate IDs, dummy vertices have ID 0
+    std::multiset<std::pair<u32, u32>> get_edges(igraph_cache& cache)
+    {
+        const igraph_t* graph = cache.get_graph();
+        const auto& gates     = cache.get_vertex_gates();
+        EXPECT_EQ((u32)igraph_vcount(graph), gates.size());
+
+        std::multiset<std::pair<u32, u32>> edges;
+        igraph_vector_t edge_list;
+        igraph_vector_init(&edge_list, 0);
+        igraph_get_edgelist(graph, &edge_list, false);
+        for (long i = 0; i + 1 < igraph_vector_size(&edge_list); i += 2)
+        {
+            const auto& src = gates[(u32)VECTOR(edge_list)[i]];
+            const auto& dst = gates[(u32)VECTOR(edge_list)[i + 1]];
+            edges.emplace((src == nullptr) ? 0 : src->get_id(), (dst == nullptr) ? 0 : dst->get_id());
+        }
+        igraph_vector_destroy(&edge_list);
+        return edges;
+    }
+};
+
+/**
+ * Testing that the cached graph follows the changes of the netlist
+ *
+ * Functions: get_igraph_directed, get_graph, get_vertex_gates, get_vertex
+ */
+TEST_F(igraph_cache_test, check_updates)
+{
+    TEST_START
+        plugin_graph_algorithm plugin;
+        {
+            // Single changes
+            std::shared_ptr<netlist> nl = create_example_netlist();
+            auto cache                  = plugin.get_igraph_directed(nl);
+            ASSERT_NE(cache, nullptr);
+            EXPECT_EQ(get_edges(*cache), get_edges(*std::make_shared<igraph_cache>(nl)));
+
+            // create a net and connect it
+            auto n = nl->create_net(MIN_NET_ID + 100, "net_100");
+            EXPECT_EQ(get_edges(*cache), get_edges(*std::make_shared<igraph_cache>(nl)));
+            auto g_src = nl->create_gate(MIN_GATE_ID + 100, get_gate_type_by_name("AND2"), "gate_100");
+            ASSERT_TRUE(n->set_src(g_src, "O"));
+            EXPECT_EQ(get_edges(*cache), get_edges(*std::make_shared<igraph_cache>(nl)));
+            ASSERT_TRUE(n->add_dst(nl->get_gate_by_id(MIN_GATE_ID + 5), "I1"));
+            ASSERT_TRUE(n->add_dst(nl->get_gate_by_id(MIN_GATE_ID + 8), "I1"));
+            EXPECT_EQ(get_edges(*cache), get_edges(*std::make_shared<igraph_cache>(nl)));
+
+            // remove a destination
+            ASSERT_TRUE(n->remove_dst(nl->get_gate_by_id(MIN_GATE_ID + 5), "I1"));
+            EXPECT_EQ(get_edges(*cache), get_edges(*std::make_shared<igraph_cache>(nl)));
+
+            // delete gates, the vertices of the remaining gates stay valid
+            ASSERT_TRUE(nl->delete_gate(g_src));
+            ASSERT_TRUE(nl->delete_gate(nl->get_gate_by_id(MIN_GATE_ID + 0)));
+            EXPECT_EQ(get_edges(*cache), get_edges(*std::make_shared<igraph_cache>(nl)));
+            EXPECT_EQ(cache->get_vertex(g_src), igraph_cache::invalid_vertex);
+            for (const auto& g : nl->get_gates())
+            {
+                u32 v = cache->get_vertex(g);
+                ASSERT_LT(v, cache->get_vertex_gates().size());
+                EXPECT_EQ(cache->get_vertex_gates()[v], g);
+            }
+
+            // the cache is reused as long as the netlist exists
+            EXPECT_EQ(plugin.get_igraph_directed(nl), cache);
+            EXPECT_NE(plugin.get_igraph_directed(create_empty_netlist()), cache);
+        }
+        {
+            // Random changes
+            std::mt19937 rng(3);
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            std::vector<std::shared_ptr<gate>> gates;
+            std::vector<std::shared_ptr<net>> nets;
+            for (u32 i = 0; i < 30; ++i)
+            {
+                gates.push_back(nl->create_gate(get_gate_type_by_name("AND4"), "gate_" + std::to_string(i)));
+                nets.push_back(nl->create_net("net_" + std::to_string(i)));
+            }
+            auto cache = plugin.get_igraph_directed(nl);
+
+            for (u32 round = 0; round < 100; ++round)
+            {
+                for (u32 k = 0; k < 5; ++k)
+                {
+                    u32 op = rng() % 7;
+                    auto n = nets[rng() % nets.size()];
+                    auto g = gates[rng() % gates.size()];
+                    if (op == 0)
+                    {
+                        gates.push_back(nl->create_gate(get_gate_type_by_name("AND4"), "gate"));
+                    }
+                    else if (op == 1 && gates.size() > 5)
+                    {
+                        nl->delete_gate(g);
+                        gates.erase(std::find(gates.begin(), gates.end(), g));
+                    }
+                    else if (op == 2)
+                    {
+                        nets.push_back(nl->create_net("net"));
+                    }
+                    else if (op == 3 && nets.size() > 5)
+                    {
+                        nl->delete_net(n);
+                        nets.erase(std::find(nets.begin(), nets.end(), n));
+                    }
+                    else if (op == 4)
+                    {
+                        if (n->get_src().get_gate() != nullptr)
+                        {
+                            n->remove_src();
+                        }
+                        else if (g->get_fan_out_nets().empty())
+                        {
+                            n->set_src(g, "O");
+                        }
+                    }
+                    else if (op == 5)
+                    {
+                        std::string pin = "I" + std::to_string(rng() % 4);
+                        if (g->get_fan_in_net(pin) == nullptr)
+                        {
+                            n->add_dst(g, pin);
+                        }
+                    }
+                    else if (op == 6 && !n->get_dsts().empty())
+                    {
+                        auto dsts = n->get_dsts();
+                        n->remove_dst(dsts[rng() % dsts.size()]);
+                    }
+                }
+                EXPECT_EQ(get_edges(*cache), get_edges(*std::make_shared<igraph_cache>(nl)));
+            }
+        }
+    TEST_END
+}
@@ -0,0 +1,257 @@
+#include "netlist/gate_library/gate_library_manager.h"
+#include "netlist/netlist.h"
+#include "netlist_test_utils.h"
+#include "plugin_graph_algorithm.h"
+#include "shortest_path_engine.h"
+#include "gtest/gtest.h"
+#include <netlist/gate.h>
+#include <netlist/net.h>
+
+using namespace test_utils;
+
+class shortest_path_engine_test : public ::testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        NO_COUT_BLOCK;
+        gate_library_manager::load_all();
+        plugin_graph_algorithm().initialize_logging();
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+    // the weight of the net driven by gate MIN_GATE_ID+i is weights[i]
+    std::function<double(const std::shared_ptr<net>&)> get_weights(const std::vector<double>& weights)
+    {
+        return [weights](const std::shared_ptr<net>& n) { return weights[n->get_id() - MIN_NET_ID]; };
+    }
+
+    // 0 -> {1, 2}, {1, 2} -> 3 -> 4 (FF) -> 5
+    std::vector<std::shared_ptr<gate>> create_diamond(const std::shared_ptr<netlist>& nl)
+    {
+        auto gates = create_test_gates(nl, {"AND2", "AND2", "AND2", "AND2", "FF", "AND2"});
+        EXPECT_TRUE(connect_gates(gates[0], gates[1], "I0"));
+        EXPECT_TRUE(connect_gates(gates[0], gates[2], "I0"));
+        EXPECT_TRUE(connect_gates(gates[1], gates[3], "I0"));
+        EXPECT_TRUE(connect_gates(gates[2], gates[3], "I1"));
+        EXPECT_TRUE(connect_gates(gates[3], gates[4], "D"));
+        EXPECT_TRUE(connect_gates(gates[4], gates[5], "I0"));
+        return gates;
+    }
+};
+
+/**
+ * Testing breadth-first searches
+ *
+ * Functions: bfs, get_reached, is_reached, get_distance, get_depth, get_path, set_stop_condition, set_stop_gate_types
+ */
+TEST_F(shortest_path_engine_test, check_bfs)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_empty_netlist();
+        auto gates                  = create_diamond(nl);
+        shortest_path_engine engine(nl);
+        std::vector<u32> v;
+        for (const auto& g : gates)
+        {
+            v.push_back(engine.get_index(g));
+            EXPECT_EQ(engine.get_gate(v.back()), g);
+        }
+        {
+            // Forward search
+            EXPECT_EQ(engine.bfs({v[0]}), 6);
+            std::vector<double> distances = {0, 1, 1, 2, 3, 4};
+            for (u32 i = 0; i < 6; ++i)
+            {
+                EXPECT_TRUE(engine.is_reached(v[i]));
+                EXPECT_EQ(engine.get_distance(v[i]), distances[i]);
+                EXPECT_EQ(engine.get_depth(v[i]), (u32)distances[i]);
+            }
+            EXPECT_EQ(engine.get_reached().front(), v[0]);
+            EXPECT_EQ(engine.get_reached().back(), v[5]);
+            auto path = engine.get_path(v[5]);
+            ASSERT_EQ(path.size(), 5);
+            EXPECT_EQ(path.front(), v[0]);
+            EXPECT_EQ(std::vector<u32>(path.begin() + 2, path.end()), std::vector<u32>({v[3], v[4], v[5]}));
+        }
+        {
+            // Backward search with a maximum depth
+            EXPECT_EQ(engine.bfs({v[5]}, false, 2), 3);
+            EXPECT_EQ(engine.get_distance(v[3]), 2);
+            EXPECT_FALSE(engine.is_reached(v[1]));
+            EXPECT_EQ(engine.get_distance(v[1]), -1);
+            EXPECT_EQ(engine.get_depth(v[1]), shortest_path_engine::invalid_index);
+            EXPECT_TRUE(engine.get_path(v[1]).empty());
+        }
+        {
+            // The search stops at flip-flops unless they are a source
+            engine.set_stop_gate_types({"FF"});
+            EXPECT_EQ(engine.bfs({v[0]}), 5);
+            EXPECT_TRUE(engine.is_reached(v[4]));
+            EXPECT_FALSE(engine.is_reached(v[5]));
+            EXPECT_EQ(engine.bfs({v[4]}), 2);
+            EXPECT_EQ(engine.get_distance(v[5]), 1);
+
+            engine.set_stop_condition([&](const std::shared_ptr<gate>& g) { return g == gates[3]; });
+            EXPECT_EQ(engine.bfs({v[0]}), 4);
+            EXPECT_FALSE(engine.is_reached(v[4]));
+
+            engine.set_stop_condition(nullptr);
+            EXPECT_EQ(engine.bfs({v[0]}), 6);
+        }
+        {
+            // The search terminates once all targets are reached
+            engine.bfs({v[0]}, true, shortest_path_engine::unlimited, {v[1], v[2]});
+            EXPECT_EQ(engine.get_distance(v[1]), 1);
+            EXPECT_EQ(engine.get_distance(v[2]), 1);
+            EXPECT_FALSE(engine.is_reached(v[5]));
+        }
+        // ########################
+        // NEGATIVE TESTS
+        // ########################
+        {
+            // Invalid source
+            NO_COUT_TEST_BLOCK;
+            EXPECT_EQ(engine.bfs({(u32)gates.size()}), 0);
+            EXPECT_TRUE(engine.get_reached().empty());
+            EXPECT_EQ(engine.get_index(nl->create_gate(get_gate_type_by_name("AND2"), "new_gate")), shortest_path_engine::invalid_index);
+        }
+    TEST_END
+}
+
+/**
+ * Testing weighted searches
+ *
+ * Functions: set_edge_weights, dijkstra
+ */
+TEST_F(shortest_path_engine_test, check_dijkstra)
+{
+    TEST_START
+        {
+            // Dijkstra's algorithm and A*
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            auto gates                  = create_diamond(nl);
+            shortest_path_engine engine(nl);
+            std::vector<u32> v;
+            for (const auto& g : gates)
+            {
+                v.push_back(engine.get_index(g));
+            }
+            ASSERT_TRUE(engine.set_edge_weights(get_weights({1, 4, 2, 1, 3, 1})));
+
+            EXPECT_EQ(engine.dijkstra({v[0]}), 6);
+            std::vector<double> distances = {0, 1, 1, 3, 4, 7};
+            for (u32 i = 0; i < 6; ++i)
+            {
+                EXPECT_EQ(engine.get_distance(v[i]), distances[i]);
+            }
+            EXPECT_EQ(engine.get_path(v[5]), std::vector<u32>({v[0], v[2], v[3], v[4], v[5]}));
+
+            engine.dijkstra({v[5]}, false);
+            EXPECT_EQ(engine.get_distance(v[0]), 7);
+
+            // the exact remaining distance is a consistent heuristic, gates on longer paths are not settled
+            std::vector<double> remaining = {7, 8, 6, 4, 3, 0};
+            engine.dijkstra({v[0]}, true, shortest_path_engine::unlimited, {v[5]}, [&](u32 index) {
+                return remaining[std::find(v.begin(), v.end(), index) - v.begin()];
+            });
+            EXPECT_EQ(engine.get_distance(v[5]), 7);
+            EXPECT_FALSE(engine.is_reached(v[1]));
+
+            // stop gates
+            engine.set_stop_gate_types({"FF"});
+            EXPECT_EQ(engine.dijkstra({v[0]}), 5);
+            EXPECT_FALSE(engine.is_reached(v[5]));
+        }
+        {
+            // With a maximum depth, the shortest path with at most that many edges is found: 0 -> 1 -> 3 -> 4 costs 1 + 1 + 1, 2 -> 3 -> 4 costs 5 + 1
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            auto gates                  = create_test_gates(nl, {"AND2", "AND2", "AND2", "AND2", "AND2"});
+            EXPECT_TRUE(connect_gates(gates[0], gates[1], "I0"));
+            EXPECT_TRUE(connect_gates(gates[1], gates[3], "I0"));
+            EXPECT_TRUE(connect_gates(gates[2], gates[3], "I1"));
+            EXPECT_TRUE(connect_gates(gates[3], gates[4], "I0"));
+            shortest_path_engine engine(nl);
+            std::vector<u32> v;
+            for (const auto& g : gates)
+            {
+                v.push_back(engine.get_index(g));
+            }
+            ASSERT_TRUE(engine.set_edge_weights(get_weights({1, 1, 5, 1, 1})));
+
+            engine.dijkstra({v[0], v[2]});
+            EXPECT_EQ(engine.get_distance(v[4]), 3);
+            EXPECT_EQ(engine.get_path(v[4]), std::vector<u32>({v[0], v[1], v[3], v[4]}));
+
+            engine.dijkstra({v[0], v[2]}, true, 2);
+            EXPECT_EQ(engine.get_distance(v[3]), 2);
+            EXPECT_EQ(engine.get_distance(v[4]), 6);
+            EXPECT_EQ(engine.get_depth(v[4]), 2);
+            EXPECT_EQ(engine.get_path(v[4]), std::vector<u32>({v[2], v[3], v[4]}));
+
+            engine.dijkstra({v[0], v[2]}, true, 2, {v[4]}, [](u32) { return 0.0; });
+            EXPECT_EQ(engine.get_distance(v[4]), 6);
+
+            engine.dijkstra({v[0], v[2]}, true, 1);
+            EXPECT_EQ(engine.get_distance(v[3]), 5);
+            EXPECT_FALSE(engine.is_reached(v[4]));
+        }
+        // ########################
+        // NEGATIVE TESTS
+        // ########################
+        {
+            // Negative weights
+            NO_COUT_TEST_BLOCK;
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            create_diamond(nl);
+            shortest_path_engine engine(nl);
+            EXPECT_FALSE(engine.set_edge_weights([](const std::shared_ptr<net>&) { return -1.0; }));
+        }
+    TEST_END
+}
+
+/**
+ * Testing the computation of distance matrices
+ *
+ * Functions: get_distance_matrix
+ */
+TEST_F(shortest_path_engine_test, check_distance_matrix)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_empty_netlist();
+        auto gates                  = create_diamond(nl);
+        shortest_path_engine engine(nl);
+        std::vector<u32> v;
+        for (const auto& g : gates)
+        {
+            v.push_back(engine.get_index(g));
+        }
+        ASSERT_TRUE(engine.set_edge_weights(get_weights({1, 4, 2, 1, 3, 1})));
+
+        std::vector<u32> sources = {v[0], v[2]};
+        std::vector<u32> targets = {v[3], v[5], v[1]};
+        EXPECT_EQ(engine.get_distance_matrix(sources, targets), std::vector<std::vector<double>>({{2, 4, 1}, {1, 3, -1}}));
+        EXPECT_EQ(engine.get_distance_matrix(sources, targets, true, shortest_path_engine::unlimited, true), std::vector<std::vector<double>>({{3, 7, 1}, {2, 6, -1}}));
+        EXPECT_EQ(engine.get_distance_matrix(targets, sources, false), std::vector<std::vector<double>>({{2, 1}, {4, 3}, {1, -1}}));
+        EXPECT_EQ(engine.get_distance_matrix(sources, targets, true, 2), std::vector<std::vector<double>>({{2, -1, 1}, {1, -1, -1}}));
+
+        // stop gates are respected
+        engine.set_stop_gate_types({"FF"});
+        EXPECT_EQ(engine.get_distance_matrix(sources, targets), std::vector<std::vector<double>>({{2, -1, 1}, {1, -1, -1}}));
+
+        // the matrix matches single searches
+        engine.set_stop_condition(nullptr);
+        auto matrix = engine.get_distance_matrix(v, v, true, shortest_path_engine::unlimited, true);
+        for (u32 i = 0; i < v.size(); ++i)
+        {
+            engine.dijkstra({v[i]});
+            for (u32 j = 0; j < v.size(); ++j)
+            {
+                EXPECT_EQ(matrix[i][j], engine.get_distance(v[j]));
+            }
+        }
+    TEST_END
+}
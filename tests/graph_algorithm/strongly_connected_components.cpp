@@ -0,0 +1,102 @@
+#include "netlist/gate_library/gate_library_manager.h"
+#include "netlist/netlist.h"
+#include "netlist_test_utils.h"
+#include "plugin_graph_algorithm.h"
+#include "gtest/gtest.h"
+#include <netlist/gate.h>
+#include <netlist/net.h>
+#include <random>
+
+using namespace test_utils;
+
+class strongly_connected_components_test : public ::testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        NO_COUT_BLOCK;
+        gate_library_manager::load_all();
+        plugin_graph_algorithm().initialize_logging();
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+/**
+ * Testing the detection of strongly connected components
+ *
+ * Functions: get_strongly_connected_component_ids, get_strongly_connected_components
+ */
+TEST_F(strongly_connected_components_test, check_components)
+{
+    TEST_START
+        plugin_graph_algorithm plugin;
+        {
+            // Known cycles: 0 -> 1 -> 2 -> 0, 3 <-> 4, a self-loop at 5, and a path 2 -> 3 -> 6 -> 7
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            auto gates                  = create_test_gates(nl, std::vector<std::string>(8, "AND4"));
+            ASSERT_TRUE(connect_gates(gates[0], gates[1], "I0"));
+            ASSERT_TRUE(connect_gates(gates[1], gates[2], "I0"));
+            ASSERT_TRUE(connect_gates(gates[2], gates[0], "I0"));
+            ASSERT_TRUE(connect_gates(gates[3], gates[4], "I0"));
+            ASSERT_TRUE(connect_gates(gates[4], gates[3], "I0"));
+            ASSERT_TRUE(connect_gates(gates[5], gates[5], "I0"));
+            ASSERT_TRUE(connect_gates(gates[2], gates[3], "I1"));
+            ASSERT_TRUE(connect_gates(gates[3], gates[6], "I0"));
+            ASSERT_TRUE(connect_gates(gates[6], gates[7], "I0"));
+
+            auto id = [](u32 i) { return MIN_GATE_ID + i; };
+            std::vector<std::vector<u32>> expected = {{id(0), id(1), id(2)}, {id(3), id(4)}, {id(5)}, {id(6)}, {id(7)}};
+            EXPECT_EQ(plugin.get_strongly_connected_component_ids(nl), expected);
+            EXPECT_EQ(plugin.get_strongly_connected_component_ids(nl, {}, true), expected);
+
+            // only the connections between the given gates are considered
+            std::vector<std::vector<u32>> expected_subset = {{id(0)}, {id(2)}, {id(3), id(4)}};
+            EXPECT_EQ(plugin.get_strongly_connected_component_ids(nl, {id(4), id(0), id(2), id(3)}), expected_subset);
+            EXPECT_EQ(plugin.get_strongly_connected_component_ids(nl, {id(4), id(0), id(2), id(3)}, true), expected_subset);
+
+            std::set<std::set<std::shared_ptr<gate>>> expected_sets = {{gates[0], gates[1], gates[2]}, {gates[3], gates[4]}};
+            EXPECT_EQ(plugin.get_strongly_connected_components(nl, {gates[0], gates[1], gates[2], gates[3], gates[4]}), expected_sets);
+        }
+        {
+            // The parallel algorithm finds the same components as the sequential one, the netlist exceeds the size below which the parallel algorithm falls back to the sequential one
+            std::mt19937 rng(5);
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            u32 num_gates               = 40000;
+            auto gates                  = create_test_gates(nl, std::vector<std::string>(num_gates, "AND4"));
+            for (u32 i = 0; i < num_gates; ++i)
+            {
+                for (u32 j = 0; j < 2; ++j)
+                {
+                    u32 src = (rng() % 3 == 0) ? rng() % num_gates : (i + 1 + rng() % 5) % num_gates;
+                    ASSERT_TRUE(connect_gates(gates[src], gates[i], "I" + std::to_string(j)));
+                }
+            }
+
+            auto sequential = plugin.get_strongly_connected_component_ids(nl);
+            auto parallel   = plugin.get_strongly_connected_component_ids(nl, {}, true);
+            EXPECT_EQ(sequential, parallel);
+
+            u32 num_components_gates = 0;
+            for (const auto& component : sequential)
+            {
+                num_components_gates += component.size();
+            }
+            EXPECT_EQ(num_components_gates, num_gates);
+        }
+        // ########################
+        // NEGATIVE TESTS
+        // ########################
+        {
+            // Invalid parameters
+            NO_COUT_TEST_BLOCK;
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            create_test_gates(nl, {"AND4", "AND4"});
+            EXPECT_TRUE(plugin.get_strongly_connected_component_ids(nullptr).empty());
+            EXPECT_TRUE(plugin.get_strongly_connected_components(nullptr).empty());
+            EXPECT_TRUE(plugin.get_strongly_connected_components(nl, {nullptr}).empty());
+        }
+    TEST_END
+}
@@ -316,6 +316,30 @@ TEST_F(hdl_parser_verilog_test, check_comment_detection){
             }
 
         }
+        {
+            // Testing a comment within an identifier, parsed directly from a buffer
+            std::string input = "module top (\n"
+                                "  global_in,\n"
+                                "  global_out\n"
+                                " ) ;\n"
+                                "  input glob/*comment*/al_in ;\n"
+                                "  output global_out ;\n"
+                                "INV test_gate (\n"
+                                "  .\\I (global_in ),\n"
+                                "  .\\O (global_(*attribute*)out )\n"
+                                " ) ;\n"
+                                "endmodule";
+            hdl_parser_verilog verilog_parser(std::string_view{input});
+            std::shared_ptr<netlist> nl = verilog_parser.parse(g_lib_name);
+
+            ASSERT_NE(nl, nullptr);
+            ASSERT_EQ(nl->get_gates(gate_filter("INV", "test_gate")).size(), 1);
+            std::shared_ptr<gate> test_gate = *nl->get_gates(gate_filter("INV", "test_gate")).begin();
+            ASSERT_NE(test_gate->get_fan_in_net("I"), nullptr);
+            ASSERT_NE(test_gate->get_fan_out_net("O"), nullptr);
+            EXPECT_EQ(test_gate->get_fan_in_net("I")->get_name(), "global_in");
+            EXPECT_EQ(test_gate->get_fan_out_net("O")->get_name(), "global_out");
+        }
 
     TEST_END
 }
@@ -343,7 +367,9 @@ TEST_F(hdl_parser_verilog_test, check_generic_map){
                                     ".key_bit_vector_hex('habc),"           // All values are 'ABC' in hex
                                     ".key_bit_vector_dec('d2748),"
                                     ".key_bit_vector_oct('o5274),"
-                                    ".key_bit_vector_bin('b101010111100)) "
+                                    ".key_bit_vector_bin('b101010111100),"
+                                    ".key_bit_vector_wide(128'h0123_4567_89ab_cdef_0123_4567_89ab_cdef),"
+                                    ".key_bit_vector_wide_dec(128'd1512366075204170929049582354406559215)) "
                                     "gate_0 ("
                                     "  .\\I (global_in ),"
                                     "  .\\O (global_out )"
@@ -374,6 +400,9 @@ TEST_F(hdl_parser_verilog_test, check_generic_map){
             EXPECT_EQ(gate_0->get_data_by_key("generic","key_bit_vector_dec"), std::make_tuple("bit_vector", "abc"));
             EXPECT_EQ(gate_0->get_data_by_key("generic","key_bit_vector_oct"), std::make_tuple("bit_vector", "abc"));
             EXPECT_EQ(gate_0->get_data_by_key("generic","key_bit_vector_bin"), std::make_tuple("bit_vector", "abc"));
+            // Bit vectors are not limited to 64 bits
+            EXPECT_EQ(gate_0->get_data_by_key("generic","key_bit_vector_wide"), std::make_tuple("bit_vector", "123456789abcdef0123456789abcdef"));
+            EXPECT_EQ(gate_0->get_data_by_key("generic","key_bit_vector_wide_dec"), std::make_tuple("bit_vector", "123456789abcdef0123456789abcdef"));
         }
 
     TEST_END
@@ -1097,6 +1126,100 @@ TEST_F(hdl_parser_verilog_test, check_multiple_entities)
     TEST_END
 }
 
+/**
+ * Testing a file with many entities, one per line block, that are chained into a deep module hierarchy. The entities
+ * are tokenized and parsed independently of each other, so the 'module' keyword inside of a comment block must not
+ * start a new entity.
+ *
+ * Functions: parse
+ */
+TEST_F(hdl_parser_verilog_test, check_many_entities)
+{
+    TEST_START
+        {
+            const u32 num_of_entities = 32;
+            std::stringstream input;
+            input << "module ENT_0 (\n"
+                     "  ent_in,\n"
+                     "  ent_out\n"
+                     " ) ;\n"
+                     "  input ent_in ;\n"
+                     "  output ent_out ;\n"
+                     "INV gate_0 (\n"
+                     "  .\\I (ent_in ),\n"
+                     "  .\\O (ent_out )\n"
+                     " ) ;\n"
+                     "endmodule\n";
+            for (u32 i = 1; i < num_of_entities; i++)
+            {
+                input << "/*\n"
+                         "module ENT_COMMENT (ent_in, ent_out) ;\n"
+                         "*/\n"
+                         "module ENT_" << i << " (\n"
+                         "  ent_in,\n"
+                         "  ent_out\n"
+                         " ) ;\n"
+                         "  input ent_in ;\n"
+                         "  output ent_out ;\n"
+                         "  wire net_" << i << " ;\n"
+                         "INV gate_" << i << " (\n"
+                         "  .\\I (ent_in ),\n"
+                         "  .\\O (net_" << i << " )\n"
+                         " ) ;\n"
+                         "ENT_" << (i - 1) << " child_" << i << " (\n"
+                         "  .\\ent_in (net_" << i << " ),\n"
+                         "  .\\ent_out (ent_out )\n"
+                         " ) ;\n"
+                         "endmodule\n";
+            }
+            hdl_parser_verilog verilog_parser(input);
+            std::shared_ptr<netlist> nl = verilog_parser.parse(g_lib_name);
+
+            ASSERT_NE(nl, nullptr);
+            EXPECT_EQ(nl->get_design_name(), "ENT_" + std::to_string(num_of_entities - 1));
+            EXPECT_EQ(nl->get_gates().size(), num_of_entities);
+            EXPECT_EQ(nl->get_modules().size(), num_of_entities);
+
+            // the last entity is the top module, every other entity is the only submodule of its parent
+            std::shared_ptr<module> current_mod = nl->get_top_module();
+            for (u32 i = 1; i < num_of_entities; i++)
+            {
+                ASSERT_EQ(current_mod->get_submodules().size(), 1);
+                current_mod = *current_mod->get_submodules().begin();
+                EXPECT_TRUE(core_utils::starts_with(current_mod->get_name(), "ENT_" + std::to_string(num_of_entities - 1 - i)));
+            }
+            EXPECT_TRUE(current_mod->get_submodules().empty());
+        }
+        {
+            // An error in one of the entities is reported
+            NO_COUT_TEST_BLOCK;
+            std::stringstream input;
+            input << "module ENT_0 (\n"
+                     "  ent_in,\n"
+                     "  ent_out\n"
+                     " ) ;\n"
+                     "  input ent_in ;\n"
+                     "  output ent_out ;\n"
+                     "  inout ent_inout ;\n"
+                     "endmodule\n"
+                     "module ENT_1 (\n"
+                     "  ent_in,\n"
+                     "  ent_out\n"
+                     " ) ;\n"
+                     "  input ent_in ;\n"
+                     "  output ent_out ;\n"
+                     "INV gate_0 (\n"
+                     "  .\\I (ent_in ),\n"
+                     "  .\\O (ent_out )\n"
+                     " ) ;\n"
+                     "endmodule\n";
+            hdl_parser_verilog verilog_parser(input);
+            std::shared_ptr<netlist> nl = verilog_parser.parse(g_lib_name);
+            EXPECT_EQ(nl, nullptr);
+        }
+    TEST_END
+}
+
 /**
  * Testing the port assigment of the signals '0' and '1' (by 'b0 and 'b1)
  *
@@ -354,7 +354,8 @@ TEST_F(hdl_parser_vhdl_test, check_generic_map){
                                     "      key_bit_vector_0 => X\"abcdef\",\n"
                                     "      key_bit_vector_1 => B\"101010111100110111101111\",\n" // <- binary: 'abcdef' in hex
                                     "      key_bit_vector_2 => O\"52746757\",\n" // <- octal: 'abcdef' in hex
-                                    "      key_bit_vector_3 => D\"11259375\"\n" // <- decimal: 'abcdef' in hex
+                                    "      key_bit_vector_3 => D\"11259375\",\n" // <- decimal: 'abcdef' in hex
+                                    "      key_bit_vector_4 => D\"1512366075204170929049582354406559215\"\n" // <- decimal wider than 64 bits
                                     "    )\n"
                                     "    port map (\n"
                                     "      I => net_global_input\n"
@@ -379,6 +380,7 @@ TEST_F(hdl_parser_vhdl_test, check_generic_map){
             EXPECT_EQ(g->get_data_by_key("generic", "key_bit_vector_1"), std::make_tuple("bit_vector", "abcdef"));
             EXPECT_EQ(g->get_data_by_key("generic", "key_bit_vector_2"), std::make_tuple("bit_vector", "abcdef"));
             EXPECT_EQ(g->get_data_by_key("generic", "key_bit_vector_3"), std::make_tuple("bit_vector", "abcdef"));
+            EXPECT_EQ(g->get_data_by_key("generic", "key_bit_vector_4"), std::make_tuple("bit_vector", "123456789abcdef0123456789abcdef"));
         }
         {
             // A string is passed
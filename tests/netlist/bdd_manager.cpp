@@ -0,0 +1,194 @@
+#include "netlist_test_utils.h"
+#include "gtest/gtest.h"
+#include <netlist/bdd_manager.h>
+#include <netlist/boolean_function.h>
+#include <netlist/truth_table.h>
+
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace test_utils;
+
+class bdd_manager_test : public ::testing::Test
+{
+protected:
+    const boolean_function::value X    = boolean_function::value::X;
+    const boolean_function::value ZERO = boolean_function::value::ZERO;
+    const boolean_function::value ONE  = boolean_function::value::ONE;
+
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+/**
+ * Testing that equivalent functions share their nodes
+ *
+ * Functions: get_variable, ite, apply_and, apply_or, apply_xor, negate
+ */
+TEST_F(bdd_manager_test, check_canonical_nodes)
+{
+    TEST_START
+        bdd_manager m;
+        auto a = m.get_variable("A");
+        auto b = m.get_variable("B");
+        auto c = m.get_variable("C");
+
+        EXPECT_EQ(m.get_variable("A"), a);
+        EXPECT_EQ(m.get_variables(), std::vector<std::string>({"A", "B", "C"}));
+
+        // distributivity
+        EXPECT_EQ(m.apply_or(m.apply_and(a, b), m.apply_and(a, c)), m.apply_and(a, m.apply_or(b, c)));
+        // de morgan
+        EXPECT_EQ(m.negate(m.apply_and(a, b)), m.apply_or(m.negate(a), m.negate(b)));
+        // xor as sum of products
+        EXPECT_EQ(m.apply_xor(a, b), m.apply_or(m.apply_and(a, m.negate(b)), m.apply_and(m.negate(a), b)));
+        // tautology and contradiction
+        EXPECT_EQ(m.apply_or(a, m.negate(a)), bdd_manager::ONE);
+        EXPECT_EQ(m.apply_and(a, m.negate(a)), bdd_manager::ZERO);
+        EXPECT_EQ(m.ite(a, b, b), b);
+
+        // no duplicate nodes are created
+        u32 num_nodes = m.get_num_nodes();
+        m.apply_and(a, m.apply_or(b, c));
+        EXPECT_EQ(m.get_num_nodes(), num_nodes);
+    TEST_END
+}
+
+/**
+ * Testing restriction and composition of diagrams
+ *
+ * Functions: restrict, compose
+ */
+TEST_F(bdd_manager_test, check_compose)
+{
+    TEST_START
+        {
+            bdd_manager m;
+            auto a = m.get_variable("A");
+            auto b = m.get_variable("B");
+            auto c = m.get_variable("C");
+            auto f = m.apply_or(m.apply_and(a, b), c);
+
+            EXPECT_EQ(m.restrict(f, "A", true), m.apply_or(b, c));
+            EXPECT_EQ(m.restrict(f, "C", true), bdd_manager::ONE);
+            EXPECT_EQ(m.restrict(f, "D", true), f);
+            EXPECT_EQ(m.compose(f, "C", m.apply_and(a, b)), m.apply_and(a, b));
+            EXPECT_EQ(m.compose(f, "B", m.negate(a)), c);
+        }
+        {
+            // X of the substituted function only propagates where it matters
+            bdd_manager m;
+            auto f = m.from_boolean_function(boolean_function::from_string("A & B"));
+            auto x = m.from_boolean_function(boolean_function(X));
+            auto g = m.compose(f, "B", x);
+            EXPECT_EQ(m.to_boolean_function(g).to_truth_table({"A"}).to_vector(), std::vector<boolean_function::value>({ZERO, X}));
+        }
+    TEST_END
+}
+
+/**
+ * Testing the conversion between boolean functions and diagrams
+ *
+ * Functions: from_boolean_function, to_boolean_function, boolean_function::operator==
+ */
+TEST_F(bdd_manager_test, check_boolean_function_conversion)
+{
+    TEST_START
+        {
+            bdd_manager m;
+            std::vector<std::string> vars = {"A", "B", "C", "D"};
+            std::vector<boolean_function> functions = {boolean_function::from_string("(A & !B) | (C ^ D)"),
+                                                       boolean_function::from_string("A & (B | X) & !C"),
+                                                       boolean_function::from_string("(A ^ X) | (B & D)"),
+                                                       boolean_function(X),
+                                                       boolean_function()};
+            for (const auto& f : functions)
+            {
+                auto d = m.from_boolean_function(f);
+                auto g = m.to_boolean_function(d);
+                EXPECT_EQ(g.to_truth_table(vars), f.to_truth_table(vars));
+                EXPECT_EQ(m.from_boolean_function(g), d);
+            }
+            EXPECT_EQ(m.from_boolean_function(boolean_function::from_string("A & B | A & C")), m.from_boolean_function(boolean_function::from_string("A & (C | B)")));
+            EXPECT_NE(m.from_boolean_function(boolean_function::from_string("A & X")), m.from_boolean_function(boolean_function::from_string("A")));
+        }
+        {
+            // Equality of functions with more variables than a truth table supports
+            boolean_function f = boolean_function(ZERO);
+            boolean_function g = boolean_function(ZERO);
+            for (u32 i = 0; i < 20; ++i)
+            {
+                boolean_function v("I" + std::to_string(i));
+                f = f ^ v;
+                // an even number of negations cancels out
+                g = g ^ (!v);
+            }
+            EXPECT_TRUE(f == g);
+            EXPECT_FALSE(f == !g);
+        }
+    TEST_END
+}
+
+/**
+ * Testing the hashing of functions to group equivalent gate functions
+ *
+ * Functions: function_hash, function_equal, std::hash<function>
+ */
+TEST_F(bdd_manager_test, check_function_hashing)
+{
+    TEST_START
+        bdd_manager m;
+        std::vector<std::string> expressions = {"A & B", "B & A", "!(!A | !B)", "A | B", "!(!B & !A)", "A & X", "X & A", "A ^ B"};
+
+        std::unordered_map<bdd_manager::function, std::vector<std::string>> groups;
+        for (const auto& e : expressions)
+        {
+            groups[m.from_boolean_function(boolean_function::from_string(e))].push_back(e);
+        }
+        EXPECT_EQ(groups.size(), (size_t)4);
+        EXPECT_EQ(groups[m.from_boolean_function(boolean_function::from_string("A & B"))], std::vector<std::string>({"A & B", "B & A", "!(!A | !B)"}));
+        EXPECT_EQ(groups[m.from_boolean_function(boolean_function::from_string("A & X"))], std::vector<std::string>({"A & X", "X & A"}));
+
+        std::unordered_set<bdd_manager::function, bdd_manager::function_hash, bdd_manager::function_equal> set;
+        set.insert(m.from_boolean_function(boolean_function::from_string("A | B")));
+        EXPECT_EQ(set.count(m.from_boolean_function(boolean_function::from_string("B | A"))), (size_t)1);
+        EXPECT_EQ(set.count(m.from_boolean_function(boolean_function::from_string("A ^ B"))), (size_t)0);
+    TEST_END
+}
+
+/**
+ * Testing that the operation cache stays within its limit
+ *
+ * Functions: set_cache_limit, get_cache_size, clear_cache
+ */
+TEST_F(bdd_manager_test, check_cache_limit)
+{
+    TEST_START
+        bdd_manager reference;
+        bdd_manager m;
+        m.set_cache_limit(16);
+
+        auto build = [](bdd_manager& mgr, u32 limit) {
+            bdd_manager::node f = bdd_manager::ZERO;
+            for (u32 i = 0; i < 12; ++i)
+            {
+                f = mgr.apply_xor(f, mgr.apply_and(mgr.get_variable("A" + std::to_string(i)), mgr.get_variable("B" + std::to_string(i))));
+                EXPECT_LE(mgr.get_cache_size(), limit);
+            }
+            return f;
+        };
+
+        // evicting cached results does not change the canonical nodes
+        EXPECT_EQ(build(m, 16), build(reference, bdd_manager::DEFAULT_CACHE_LIMIT));
+        EXPECT_EQ(m.get_num_nodes(), reference.get_num_nodes());
+        EXPECT_GT(reference.get_cache_size(), (u32)16);
+
+        m.clear_cache();
+        EXPECT_EQ(m.get_cache_size(), (u32)0);
+    TEST_END
+}
@@ -1,6 +1,7 @@
 #include "netlist_test_utils.h"
 #include "gtest/gtest.h"
 #include <netlist/boolean_function.h>
+#include <functional>
 #include <iostream>
 
 
@@ -276,7 +277,8 @@ TEST_F(boolean_function_test, check_compare_operator){
             // The boolean functions are equivalent in semantic (but not in syntax)
             boolean_function a("A");
             boolean_function b("B");
-            // EXPECT_TRUE(((a|b|b) == (a|b)));
+            EXPECT_TRUE(((a|b|b) == (a|b)));
+            EXPECT_TRUE(((a&(!a)) == boolean_function(ZERO)));
         }
         // Tests for !=
         {
@@ -383,6 +385,139 @@ TEST_F(boolean_function_test, check_from_string){
 }
 
 
+/**
+ * Testing the minimization of functions in exact and heuristic mode
+ *
+ * Functions: optimize
+ */
+TEST_F(boolean_function_test, check_optimize_minimization){
+    TEST_START
+        {
+            // Exact mode
+            boolean_function f = boolean_function::from_string("(A & B & C) | (A & B & !C) | (!A & B)");
+            EXPECT_EQ(f.optimize().to_string(), "B");
+
+            boolean_function g = boolean_function::from_string("(A & !B) | (!A & B) | (A & B & C)");
+            auto optimized     = g.optimize();
+            EXPECT_EQ(optimized.get_dnf_clauses().size(), 3);
+            EXPECT_EQ(optimized.get_truth_table({"A", "B", "C"}), g.get_truth_table({"A", "B", "C"}));
+
+            // identical truth tables reuse the minimized cover
+            EXPECT_EQ(g.optimize().to_string(), optimized.to_string());
+        }
+        {
+            // Heuristic mode
+            boolean_function f = boolean_function::from_string("(A & B) | (C & D) | (E & F & G & H & I & J) | (A & B & C & D & !E)");
+            std::vector<std::string> vars = {"A", "B", "C", "D", "E", "F", "G", "H", "I", "J"};
+            auto optimized     = f.optimize();
+            EXPECT_EQ(optimized.get_dnf_clauses().size(), 3);
+            EXPECT_EQ(optimized.get_truth_table(vars), f.get_truth_table(vars));
+        }
+        {
+            // Constants and functions with X outputs
+            EXPECT_TRUE(boolean_function::from_string("A | !A").optimize().is_constant_one());
+            EXPECT_TRUE(boolean_function::from_string("A & !A").optimize().is_constant_zero());
+            boolean_function f = boolean_function::from_string("A & X");
+            EXPECT_EQ(f.optimize().get_truth_table({"A"}), f.get_truth_table({"A"}));
+        }
+    TEST_END
+}
+
+/**
+ * Testing that functions of few variables are minimized to the fewest product terms
+ *
+ * Functions: optimize
+ */
+TEST_F(boolean_function_test, check_optimize_minimum_cover){
+    TEST_START
+        // reference: the smallest number of prime implicants that cover the ON-set, found by enumeration
+        auto minimum_cover = [](u32 num_vars, u32 on_set) {
+            u32 num_minterms = 1u << num_vars;
+            std::vector<u32> implicants;
+            u32 num_cubes = 1;
+            for (u32 i = 0; i < num_vars; ++i)
+            {
+                num_cubes *= 3;
+            }
+            for (u32 c = 0; c < num_cubes; ++c)
+            {
+                // each variable is absent, positive, or negative
+                u32 covered = 0;
+                for (u32 m = 0; m < num_minterms; ++m)
+                {
+                    bool match = true;
+                    for (u32 i = 0, digits = c; i < num_vars; ++i, digits /= 3)
+                    {
+                        u32 literal = digits % 3;
+                        match &= (literal == 0) || (literal == 1) == (((m >> i) & 1) == 1);
+                    }
+                    covered |= match ? (1u << m) : 0;
+                }
+                if ((covered & ~on_set) == 0)
+                {
+                    implicants.push_back(covered);
+                }
+            }
+            std::vector<u32> primes;
+            for (u32 a : implicants)
+            {
+                if (std::none_of(implicants.begin(), implicants.end(), [a](u32 b) { return b != a && (a & b) == a; }))
+                {
+                    primes.push_back(a);
+                }
+            }
+            std::function<bool(u32, u32, u32)> covers = [&](u32 start, u32 remaining, u32 covered) {
+                if (covered == on_set)
+                {
+                    return true;
+                }
+                for (u32 i = start; remaining > 0 && i < primes.size(); ++i)
+                {
+                    if (covers(i + 1, remaining - 1, covered | primes[i]))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            };
+            u32 k = 1;
+            while (!covers(0, k, 0))
+            {
+                ++k;
+            }
+            return k;
+        };
+
+        for (u32 num_vars : {3u, 4u})
+        {
+            std::vector<std::string> vars = {"A", "B", "C", "D"};
+            vars.resize(num_vars);
+            u32 num_functions = 1u << (1u << num_vars);
+            // all 3-variable functions and a spread of 4-variable functions
+            u32 step = (num_vars == 3) ? 1 : 61;
+            for (u32 on_set = 1; on_set + 1 < num_functions; on_set += step)
+            {
+                boolean_function f = boolean_function(ZERO);
+                for (u32 m = 0; m < (1u << num_vars); ++m)
+                {
+                    if ((on_set >> m) & 1)
+                    {
+                        boolean_function term = boolean_function(ONE);
+                        for (u32 i = 0; i < num_vars; ++i)
+                        {
+                            term &= ((m >> i) & 1) ? boolean_function(vars[i]) : !boolean_function(vars[i]);
+                        }
+                        f |= term;
+                    }
+                }
+                auto optimized = f.optimize();
+                EXPECT_EQ(optimized.get_truth_table(vars), f.get_truth_table(vars));
+                EXPECT_EQ(optimized.get_dnf_clauses().size(), minimum_cover(num_vars, on_set)) << "ON-set " << on_set << " over " << num_vars << " variables";
+            }
+        }
+    TEST_END
+}
+
 /**
  * Test string parsing, dnf, and optimization for a collection of functions
  *
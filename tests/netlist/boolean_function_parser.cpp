@@ -0,0 +1,143 @@
+#include "netlist_test_utils.h"
+#include "gtest/gtest.h"
+#include <netlist/boolean_function.h>
+#include <random>
+
+using namespace test_utils;
+
+namespace
+{
+    // generates a random expression in the syntax of liberty files
+    std::string random_expression(std::mt19937& rng, u32 depth)
+    {
+        static const std::vector<std::string> atoms     = {"A", "B", "CLK", "I0", "I1", "I2", "SEL", "D[3]", "0", "1", "X"};
+        static const std::vector<std::string> operators = {" & ", "*", " | ", "+", " ^ ", " ", "&", "|"};
+
+        std::string result;
+        u32 num_terms = 1 + rng() % 4;
+        for (u32 i = 0; i < num_terms; ++i)
+        {
+            if (i > 0)
+            {
+                result += operators[rng() % operators.size()];
+            }
+            if (rng() % 4 == 0)
+            {
+                result += "!";
+            }
+            if (depth > 0 && rng() % 3 == 0)
+            {
+                result += "(" + random_expression(rng, depth - 1) + ")";
+            }
+            else
+            {
+                result += atoms[rng() % atoms.size()];
+            }
+            if (rng() % 5 == 0)
+            {
+                result += "'";
+            }
+        }
+        return result;
+    }
+}    // namespace
+
+class boolean_function_parser_test : public ::testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+/**
+ * Testing the functions built from expressions in the syntax of liberty files.
+ * The equivalence to the previous parser is checked by benchmark-boolean_function_parser.
+ *
+ * Functions: from_string
+ */
+TEST_F(boolean_function_parser_test, check_expressions)
+{
+    TEST_START
+        {
+            // Handwritten expressions
+            std::vector<std::pair<std::string, std::string>> expressions = {{"A", "A"},
+                                                                            {"!A", "!A"},
+                                                                            {"A'", "!A"},
+                                                                            {"!!A''", "A"},
+                                                                            {"A & B | C ^ D", "(A & B) | (C ^ D)"},
+                                                                            {"A | B & C", "A | (B & C)"},
+                                                                            {"(A | B) & C", "(A | B) & C"},
+                                                                            {"!(A & B)'", "A & B"},
+                                                                            {"A B C D(1)", "A & B & C & D & 1"},
+                                                                            {"A*B+C'", "(A & B) | !C"},
+                                                                            {"((A))", "A"},
+                                                                            {"(A & B) & (C & D)", "A & B & C & D"},
+                                                                            {"!(A & B) & C", "!(A & B) & C"},
+                                                                            {"A ^ B ^ (C ^ D)", "A ^ B ^ C ^ D"},
+                                                                            {"(A|B)(C|D)", "(A | B) & (C | D)"},
+                                                                            {"!(!A)", "A"},
+                                                                            {"1 & X | 0", "(1 & X) | 0"},
+                                                                            {"  A   &   B  ", "A & B"},
+                                                                            {"", "<empty>"},
+                                                                            {"()", "<empty>"}};
+            for (const auto& [e, expected] : expressions)
+            {
+                EXPECT_EQ(boolean_function::from_string(e).to_string(), expected) << "expression: '" << e << "'";
+            }
+        }
+        {
+            // Known variable names
+            EXPECT_EQ(boolean_function::from_string("A B & C", {"A B"}).to_string(), "A B & C");
+            EXPECT_EQ(boolean_function::from_string("D(1) | !X", {"D(1)", "X"}).to_string(), "D(1) | !X");
+        }
+        {
+            // Random expressions are printed in a form that parses to the same function
+            std::mt19937 rng(42);
+            for (u32 i = 0; i < 1000; ++i)
+            {
+                auto e = random_expression(rng, 3);
+                auto f = boolean_function::from_string(e);
+                EXPECT_EQ(boolean_function::from_string(f.to_string()).to_string(), f.to_string()) << "expression: '" << e << "'";
+            }
+        }
+        {
+            // Bracket mismatches
+            EXPECT_EQ(boolean_function::from_string("(A & B").to_string(), "X");
+            EXPECT_EQ(boolean_function::from_string("A & B)").to_string(), "X");
+            EXPECT_EQ(boolean_function::from_string(")A & B(").to_string(), "X");
+        }
+        {
+            // Every occurrence of a known variable name is resolved
+            auto bf = boolean_function::from_string("A B | !A B", {"A B"});
+            EXPECT_EQ(bf.get_variables(), std::set<std::string>({"A B"}));
+        }
+    TEST_END
+}
+
+/**
+ * Testing larger expressions with known variable names
+ *
+ * Functions: from_string
+ */
+TEST_F(boolean_function_parser_test, check_large_expressions)
+{
+    TEST_START
+        std::mt19937 rng(1234);
+        std::vector<std::string> pins = {"A", "B", "CLK", "I0", "I1", "I2", "SEL"};
+        for (u32 i = 0; i < 5000; ++i)
+        {
+            auto e = random_expression(rng, 4);
+            auto f = boolean_function::from_string(e, pins);
+            EXPECT_EQ(boolean_function::from_string(f.to_string(), pins).to_string(), f.to_string()) << "expression: '" << e << "'";
+            for (const auto& var : f.get_variables())
+            {
+                EXPECT_TRUE(std::find(pins.begin(), pins.end(), var) != pins.end() || var == "D[3]") << "expression: '" << e << "'";
+            }
+        }
+    TEST_END
+}
@@ -0,0 +1,128 @@
+#include "netlist_test_utils.h"
+#include "gtest/gtest.h"
+#include <netlist/boolean_function.h>
+#include <netlist/compiled_boolean_function.h>
+
+using namespace test_utils;
+
+class compiled_boolean_function_test : public ::testing::Test
+{
+protected:
+    const boolean_function::value X    = boolean_function::value::X;
+    const boolean_function::value ZERO = boolean_function::value::ZERO;
+    const boolean_function::value ONE  = boolean_function::value::ONE;
+
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+
+    // the i-th of all 3^n ternary input vectors
+    std::vector<boolean_function::value> get_input_vector(u32 i, u32 n)
+    {
+        std::vector<boolean_function::value> result;
+        for (u32 j = 0; j < n; ++j)
+        {
+            result.push_back((boolean_function::value)((i % 3) - 1));
+            i /= 3;
+        }
+        return result;
+    }
+};
+
+/**
+ * Testing the evaluation of compiled functions against the evaluation of the expression tree
+ *
+ * Functions: compile, evaluate
+ */
+TEST_F(compiled_boolean_function_test, check_evaluate)
+{
+    TEST_START
+        std::vector<std::string> vars = {"A", "B", "C", "D"};
+        std::vector<boolean_function> functions = {boolean_function::from_string("A & B | !C ^ D"),
+                                                   boolean_function::from_string("!(A | B) & (C ^ !D)"),
+                                                   boolean_function::from_string("A ^ B ^ C ^ D"),
+                                                   boolean_function::from_string("(A & 1) | (B & 0) | (C & D)"),
+                                                   boolean_function("A"),
+                                                   boolean_function(ONE),
+                                                   boolean_function()};
+        for (const auto& f : functions)
+        {
+            auto compiled = f.compile(vars);
+            EXPECT_EQ(compiled.get_num_variables(), 4);
+            for (u32 i = 0; i < 81; ++i)
+            {
+                auto inputs = get_input_vector(i, 4);
+                std::map<std::string, boolean_function::value> named_inputs;
+                for (u32 j = 0; j < vars.size(); ++j)
+                {
+                    named_inputs[vars[j]] = inputs[j];
+                }
+                EXPECT_EQ(compiled.evaluate(inputs), f.evaluate(named_inputs));
+            }
+        }
+        {
+            // Variables that are not compiled evaluate to X
+            auto compiled = boolean_function::from_string("A & B").compile({"A"});
+            EXPECT_EQ(compiled.evaluate({ZERO}), ZERO);
+            EXPECT_EQ(compiled.evaluate({ONE}), X);
+        }
+        {
+            // Deeply nested functions exceed the evaluation stack that is kept on the call stack
+            boolean_function f("A");
+            for (u32 i = 0; i < 200; ++i)
+            {
+                f = (i % 2 == 0) ? (boolean_function("B") | f) : (boolean_function("A") & f);
+            }
+            auto compiled = f.compile({"A", "B"});
+            for (u32 i = 0; i < 9; ++i)
+            {
+                auto inputs = get_input_vector(i, 2);
+                EXPECT_EQ(compiled.evaluate(inputs), f.evaluate({{"A", inputs[0]}, {"B", inputs[1]}}));
+            }
+        }
+        {
+            // Missing inputs
+            NO_COUT_TEST_BLOCK;
+            auto compiled = boolean_function::from_string("A & B").compile(vars);
+            EXPECT_EQ(compiled.evaluate({ONE}), X);
+        }
+    TEST_END
+}
+
+/**
+ * Testing the bitsliced evaluation of 64 input vectors at once
+ *
+ * Functions: evaluate_bitsliced
+ */
+TEST_F(compiled_boolean_function_test, check_evaluate_bitsliced)
+{
+    TEST_START
+        std::vector<std::string> vars = {"A", "B", "C"};
+        boolean_function f            = boolean_function::from_string("(A & !B) | (B ^ C)");
+        auto compiled                 = f.compile(vars);
+
+        // bit i of the words is the i-th ternary input vector, 27 of them are used
+        std::vector<u64> ones(3, 0), unknowns(3, 0);
+        for (u32 i = 0; i < 27; ++i)
+        {
+            auto inputs = get_input_vector(i, 3);
+            for (u32 j = 0; j < 3; ++j)
+            {
+                ones[j] |= (u64)(inputs[j] == ONE) << i;
+                unknowns[j] |= (u64)(inputs[j] == X) << i;
+            }
+        }
+
+        auto [out_ones, out_unknowns] = compiled.evaluate_bitsliced(ones, unknowns);
+        for (u32 i = 0; i < 27; ++i)
+        {
+            auto expected = compiled.evaluate(get_input_vector(i, 3));
+            EXPECT_EQ((out_unknowns >> i) & 1, expected == X);
+            EXPECT_EQ((out_ones >> i) & 1, expected == ONE);
+        }
+    TEST_END
+}
@@ -136,4 +136,72 @@ TEST_F(endpoint_test, check_unequal_operator)
     EXPECT_TRUE(ep != other_ep);
 
     TEST_END
-}
\ No newline at end of file
+}
+
+/**
+ * Testing the constructor and the ordering of endpoints of the same gate, which
+ * has to follow the pin names regardless of the interning
+ *
+ * Functions: endpoint(gate, pin_type), operator<
+ */
+TEST_F(endpoint_test, check_constructor_and_pin_order)
+{
+    TEST_START
+    std::shared_ptr<netlist> nl     = create_empty_netlist(0);
+    std::shared_ptr<gate> test_gate = nl->create_gate(123, get_gate_type_by_name("AND2"), "test_gate");
+
+    endpoint ep(test_gate, "I1");
+    EXPECT_EQ(ep, get_endpoint(test_gate, "I1"));
+    EXPECT_EQ(ep.get_pin_type(), "I1");
+
+    endpoint ep_z(test_gate, "Z_PIN");
+    endpoint ep_a(test_gate, "A_PIN");
+    EXPECT_TRUE(ep_a < ep_z);
+    EXPECT_FALSE(ep_z < ep_a);
+    EXPECT_FALSE(ep_a < ep_a);
+
+    endpoint empty_ep;
+    EXPECT_EQ(empty_ep, get_endpoint(nullptr, ""));
+    EXPECT_EQ(empty_ep.get_pin_type(), "");
+
+    TEST_END
+}
+
+/**
+ * Testing that the pin_type member can still be used like a std::string
+ *
+ * Functions: pin_type
+ */
+TEST_F(endpoint_test, check_pin_type_member)
+{
+    TEST_START
+    endpoint ep;
+    EXPECT_TRUE(ep.pin_type.empty());
+    EXPECT_EQ(ep.pin_type, "");
+
+    ep.pin_type = "I0";
+    std::string pin = ep.pin_type;
+    EXPECT_EQ(pin, "I0");
+    EXPECT_EQ(ep.get_pin_type(), "I0");
+    EXPECT_TRUE(ep.pin_type == pin);
+    EXPECT_TRUE(pin == ep.pin_type);
+    EXPECT_FALSE(ep.pin_type != "I0");
+    EXPECT_TRUE(ep.pin_type < std::string("I1"));
+    EXPECT_EQ(ep.pin_type.size(), 2u);
+    EXPECT_EQ(std::string(ep.pin_type.c_str()), "I0");
+    EXPECT_EQ("pin " + ep.pin_type, "pin I0");
+
+    std::stringstream ss;
+    ss << ep.pin_type;
+    EXPECT_EQ(ss.str(), "I0");
+    EXPECT_EQ(fmt::format("pin '{}'", ep.pin_type), "pin 'I0'");
+
+    std::vector<std::string> pins = {"I1", "I0"};
+    EXPECT_EQ(std::find(pins.begin(), pins.end(), ep.pin_type), pins.begin() + 1);
+
+    // equal pin names share the same handle
+    endpoint other_ep;
+    other_ep.set_pin_type(pin);
+    EXPECT_EQ(other_ep.pin_type, ep.pin_type);
+    TEST_END
+}
@@ -1,4 +1,5 @@
 #include "netlist/gate_library/gate_library_manager.h"
+#include "netlist/gate_library/gate_type/gate_type_lut.h"
 #include "netlist/netlist.h"
 #include "netlist/netlist_factory.h"
 #include "netlist_test_utils.h"
@@ -8,6 +9,7 @@
 #include <netlist/gate.h>
 #include <netlist/net.h>
 #include <netlist/module.h>
+#include <thread>
 
 using namespace test_utils;
 
@@ -124,6 +126,27 @@ TEST_F(gate_test, check_pin_types)
     EXPECT_EQ(test_gate->get_input_pins(), std::vector<std::string>({"I0", "I1"}));
     EXPECT_EQ(test_gate->get_output_pins(), std::vector<std::string>({"O"}));
 
+    // pin indices follow the order of the pins within the gate type
+    auto gt = test_gate->get_type();
+    EXPECT_EQ(gt->get_input_pin_index("I0"), 0u);
+    EXPECT_EQ(gt->get_input_pin_index("I1"), 1u);
+    EXPECT_EQ(gt->get_output_pin_index("O"), 0u);
+    EXPECT_EQ(gt->get_input_pin(1), "I1");
+    EXPECT_EQ(gt->get_output_pin(0), "O");
+    EXPECT_EQ(gt->get_input_pin_index("O"), gate_type::invalid_pin_index);
+    EXPECT_EQ(gt->get_output_pin_index("I0"), gate_type::invalid_pin_index);
+
+    // ########################
+    // NEGATIVE TESTS
+    // ########################
+    {
+        // Get pins with an index out of range
+        NO_COUT_TEST_BLOCK;
+        EXPECT_EQ(gt->get_input_pin(2), "");
+        EXPECT_EQ(gt->get_output_pin(1), "");
+        EXPECT_EQ(gt->get_input_pin(gate_type::invalid_pin_index), "");
+    }
+
     TEST_END
 }
 
@@ -523,6 +546,55 @@ TEST_F(gate_test, check_get_unique_predecessors_and_successors)
     TEST_END
 }
 
+/**
+ * Testing that predecessors and successors are ordered by the names of the pins,
+ * independent of the order in which the pins were added to the gate type
+ *
+ * Functions: get_predecessors, get_successors, get_input_pin_order, get_output_pin_order
+ */
+TEST_F(gate_test, check_pin_order)
+{
+    TEST_START
+    std::shared_ptr<netlist> nl = create_empty_netlist();
+    auto lib                    = nl->get_gate_library();
+    if (lib->get_gate_types().find("PIN_ORDER") == lib->get_gate_types().end())
+    {
+        auto type = std::make_shared<gate_type>("PIN_ORDER");
+        type->add_input_pins({"I_B", "I_C", "I_A"});
+        type->add_output_pins({"O_B", "O_A"});
+        lib->add_gate_type(type);
+    }
+    auto gt = lib->get_gate_types().at("PIN_ORDER");
+    EXPECT_EQ(gt->get_input_pin_order(), std::vector<u32>({2, 0, 1}));
+    EXPECT_EQ(gt->get_output_pin_order(), std::vector<u32>({1, 0}));
+
+    std::shared_ptr<gate> g     = nl->create_gate(MIN_GATE_ID+0, gt, "gate_0");
+    std::shared_ptr<gate> g_1   = nl->create_gate(MIN_GATE_ID+1, gt, "gate_1");
+    std::shared_ptr<gate> g_2   = nl->create_gate(MIN_GATE_ID+2, gt, "gate_2");
+
+    for (const auto& [pin, src] : std::vector<std::pair<std::string, endpoint>>({{"I_C", {g_1, "O_A"}}, {"I_A", {g_1, "O_B"}}, {"I_B", {g_2, "O_A"}}}))
+    {
+        auto n = src.gate->get_fan_out_net(src.pin_type);
+        if (n == nullptr)
+        {
+            n = nl->create_net("net_" + src.gate->get_name() + "_" + src.pin_type);
+            n->set_src(src);
+        }
+        n->add_dst(g, pin);
+    }
+    nl->create_net("net_out_b")->set_src(g, "O_B");
+    nl->create_net("net_out_a")->set_src(g, "O_A");
+    g->get_fan_out_net("O_B")->add_dst(g_2, "I_A");
+    g->get_fan_out_net("O_A")->add_dst(g_1, "I_A");
+
+    std::vector<endpoint> pred = {{g_1, "O_B"}, {g_2, "O_A"}, {g_1, "O_A"}};
+    EXPECT_EQ(g->get_predecessors(), pred);
+    std::vector<endpoint> succ = {{g_1, "I_A"}, {g_2, "I_A"}};
+    EXPECT_EQ(g->get_successors(), succ);
+
+    TEST_END
+}
+
 /**
  * Testing the get_predecessor function
  *
@@ -670,3 +742,135 @@ TEST_F(gate_test, check_location_storage)
     TEST_END
 }
 
+
+/**
+ * Testing the functions of LUT gates, which are shared between gates of the same configuration
+ *
+ * Functions: get_boolean_function, add_boolean_function, set_data
+ */
+TEST_F(gate_test, check_lut_function)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_empty_netlist();
+        std::shared_ptr<gate> lut_0 = nl->create_gate(MIN_GATE_ID+0, get_gate_type_by_name("LUT3"), "lut_0");
+        std::shared_ptr<gate> lut_1 = nl->create_gate(MIN_GATE_ID+1, get_gate_type_by_name("LUT3"), "lut_1");
+        ASSERT_NE(lut_0, nullptr);
+        ASSERT_NE(lut_1, nullptr);
+
+        // bit i of the configuration belongs to input assignment i
+        lut_0->set_data("generic", "INIT", "bit_vector", "80");
+        lut_1->set_data("generic", "INIT", "bit_vector", "80");
+        boolean_function expected = boolean_function::from_string("I0 & I1 & I2");
+        EXPECT_EQ(lut_0->get_boolean_function("O"), expected);
+        EXPECT_EQ(lut_1->get_boolean_function("O"), expected);
+        EXPECT_EQ(lut_0->get_boolean_functions().at("O"), expected);
+
+        // changing the configuration invalidates the function of this gate only
+        lut_0->set_data("generic", "INIT", "bit_vector", "01");
+        EXPECT_EQ(lut_0->get_boolean_function("O"), boolean_function::from_string("!I0 & !I1 & !I2"));
+        EXPECT_EQ(lut_1->get_boolean_function("O"), expected);
+
+        // setting the function writes the configuration
+        lut_1->add_boolean_function("O", boolean_function::from_string("I0 ^ I1 ^ I2"));
+        EXPECT_EQ(std::get<1>(lut_1->get_data_by_key("generic", "INIT")), "96");
+        EXPECT_EQ(lut_1->get_boolean_function("O"), boolean_function::from_string("I0 ^ I1 ^ I2"));
+
+        // the configuration of a LUT6 uses all 64 bits
+        std::shared_ptr<gate> lut_2 = nl->create_gate(MIN_GATE_ID+2, get_gate_type_by_name("LUT6"), "lut_2");
+        ASSERT_NE(lut_2, nullptr);
+        boolean_function f = boolean_function::from_string("(I0 & I5) | (I1 ^ I2 ^ I3 ^ I4)");
+        lut_2->add_boolean_function("O", f);
+        EXPECT_EQ(std::get<1>(lut_2->get_data_by_key("generic", "INIT")).size(), 16);
+        EXPECT_EQ(lut_2->get_boolean_function("O"), f);
+
+        // the configurations of LUT7 and LUT8 are wider than 64 bits
+        auto lib = nl->get_gate_library();
+        std::vector<boolean_function> wide_functions = {boolean_function::from_string("(I0 & I6) | (I1 ^ I2 ^ I3 ^ I4 ^ I5)"),
+                                                        boolean_function::from_string("(I6 & I7 & !I0) | (I1 & I2 & I3 & I4 & I5)")};
+        for (u32 num_inputs : {7u, 8u})
+        {
+            std::string name = "LUT" + std::to_string(num_inputs);
+            if (lib->get_gate_types().find(name) == lib->get_gate_types().end())
+            {
+                auto type = std::make_shared<gate_type_lut>(name);
+                for (u32 i = 0; i < num_inputs; ++i)
+                {
+                    type->add_input_pin("I" + std::to_string(i));
+                }
+                type->add_output_pin("O");
+                type->set_config_data_category("generic");
+                type->set_config_data_identifier("INIT");
+                type->set_config_data_ascending_order(true);
+                type->add_output_from_init_string_pin("O");
+                lib->add_gate_type(type);
+            }
+
+            std::shared_ptr<gate> wide_lut = nl->create_gate(MIN_GATE_ID+num_inputs, lib->get_gate_types().at(name), "lut_" + std::to_string(num_inputs));
+            ASSERT_NE(wide_lut, nullptr);
+            boolean_function wide_f = wide_functions[num_inputs - 7];
+            wide_lut->add_boolean_function("O", wide_f);
+            std::string init = std::get<1>(wide_lut->get_data_by_key("generic", "INIT"));
+            EXPECT_EQ(init.size(), (size_t)1 << (num_inputs - 2));
+            EXPECT_EQ(wide_lut->get_boolean_function("O"), wide_f);
+
+            // the configuration is read back in full, also with a prefix
+            wide_lut->set_data("generic", "INIT", "bit_vector", "0x" + init);
+            EXPECT_EQ(wide_lut->get_boolean_function("O"), wide_f);
+        }
+
+        // without configuration the function is constant ZERO
+        lut_1->delete_data("generic", "INIT");
+        EXPECT_TRUE(lut_1->get_boolean_function("O").is_constant_zero());
+    TEST_END
+}
+
+/**
+ * Testing that the functions of LUT gates can be computed from several threads at once
+ *
+ * Functions: get_boolean_function
+ */
+TEST_F(gate_test, check_lut_function_concurrent)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_empty_netlist();
+        std::vector<std::string> configs = {"8000000000000001", "6996966996696996", "FFFF0000FFFF0000", "0123456789ABCDEF"};
+        std::vector<std::shared_ptr<gate>> luts;
+        for (u32 i = 0; i < 64; ++i)
+        {
+            luts.push_back(nl->create_gate(MIN_GATE_ID+i, get_gate_type_by_name("LUT6"), "lut_" + std::to_string(i)));
+            ASSERT_NE(luts.back(), nullptr);
+            luts.back()->set_data("generic", "INIT", "bit_vector", configs[i % configs.size()]);
+        }
+
+        // each thread evaluates all gates, so every cached function is requested by several threads at once
+        std::vector<std::vector<boolean_function>> results(4);
+        std::vector<std::thread> threads;
+        for (u32 t = 0; t < results.size(); ++t)
+        {
+            threads.emplace_back([&, t]() {
+                for (const auto& lut : luts)
+                {
+                    results[t].push_back(lut->get_boolean_function("O"));
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        std::shared_ptr<netlist> reference_nl = create_empty_netlist();
+        for (u32 i = 0; i < configs.size(); ++i)
+        {
+            auto reference = reference_nl->create_gate(MIN_GATE_ID+i, get_gate_type_by_name("LUT6"), "reference_" + std::to_string(i));
+            reference->set_data("generic", "INIT", "bit_vector", configs[i]);
+            for (const auto& result : results)
+            {
+                for (u32 j = i; j < luts.size(); j += configs.size())
+                {
+                    EXPECT_EQ(result[j], reference->get_boolean_function("O"));
+                }
+            }
+        }
+    TEST_END
+}
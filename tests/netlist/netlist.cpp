@@ -4,11 +4,13 @@
 #include "netlist/gate_library/gate_library_manager.h"
 #include "netlist/net.h"
 #include "netlist/netlist_factory.h"
+#include "netlist/netlist_graph_snapshot.h"
 #include "netlist/module.h"
 #include "core/plugin_manager.h"
 #include "gtest/gtest.h"
 #include <core/log.h>
 #include <iostream>
+#include <thread>
 
 using namespace test_utils;
 
@@ -169,6 +171,13 @@ TEST_F(netlist_test, check_get_unique_gate_id)
         EXPECT_TRUE(used_ids.find(unique_id) == used_ids.end());
         EXPECT_NE(unique_id, INVALID_GATE_ID);
 
+        // Freed ids are reused starting with the smallest one
+        nl->delete_gate(g_2);
+        nl->delete_gate(g_0);
+        EXPECT_EQ(nl->get_unique_gate_id(), MIN_GATE_ID+0);
+        nl->create_gate(MIN_GATE_ID+0, get_gate_type_by_name("INV"), "gate_0");
+        EXPECT_EQ(nl->get_unique_gate_id(), MIN_GATE_ID+1);
+
     TEST_END
 }
 
@@ -187,8 +196,37 @@ TEST_F(netlist_test, check_get_num_of_gates)
         std::shared_ptr<gate> g_2   = nl->create_gate(nl->get_unique_gate_id(), get_gate_type_by_name("INV"), "gate_2");
         std::shared_ptr<gate> g_3   = nl->create_gate(nl->get_unique_gate_id(), get_gate_type_by_name("INV"), "gate_4");
 
+        EXPECT_EQ(nl->get_num_of_gates(), (u32)4);
         EXPECT_EQ(nl->get_gates().size(), (size_t)4);
 
+        // Moving a gate into a submodule must not change the count
+        std::shared_ptr<module> m_0 = nl->create_module("mod_0", nl->get_top_module(), {g_0, g_1});
+        EXPECT_EQ(nl->get_num_of_gates(), (u32)4);
+
+        // Deleting a gate must be reflected
+        nl->delete_gate(g_3);
+        EXPECT_EQ(nl->get_num_of_gates(), (u32)3);
+
+    TEST_END
+}
+
+/**
+ * Testing the iteration over all gates without building a set
+ *
+ * Functions: for_each_gate
+ */
+TEST_F(netlist_test, check_for_each_gate)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_example_netlist();
+        std::shared_ptr<module> m_0 = nl->create_module("mod_0", nl->get_top_module(), {nl->get_gate_by_id(MIN_GATE_ID+0)});
+        std::shared_ptr<module> m_1 = nl->create_module("mod_1", m_0, {nl->get_gate_by_id(MIN_GATE_ID+1)});
+
+        std::set<std::shared_ptr<gate>> visited;
+        nl->for_each_gate([&visited](const std::shared_ptr<gate>& g) { visited.insert(g); });
+
+        EXPECT_EQ(visited, nl->get_gates());
+        EXPECT_EQ(visited, nl->get_top_module()->get_gates(nullptr, true));
     TEST_END
 }
 
@@ -366,6 +404,47 @@ TEST_F(netlist_test, check_get_gate_by_id){
             // Gate isn't added
             EXPECT_EQ(nl->get_gate_by_id(MIN_GATE_ID+3), nullptr);
         }
+        {
+            // Get gates with very sparse ids, also after deleting and recreating them
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            std::shared_ptr<gate> g_0   = nl->create_gate(MIN_GATE_ID+0, get_gate_type_by_name("INV"), "gate_0");
+            std::shared_ptr<gate> g_1   = nl->create_gate(0xFFFFFF00, get_gate_type_by_name("INV"), "gate_1");
+            std::shared_ptr<gate> g_2   = nl->create_gate(0x00100000, get_gate_type_by_name("INV"), "gate_2");
+            EXPECT_EQ(nl->get_gate_by_id(MIN_GATE_ID+0), g_0);
+            EXPECT_EQ(nl->get_gate_by_id(0xFFFFFF00), g_1);
+            EXPECT_EQ(nl->get_gate_by_id(0x00100000), g_2);
+
+            nl->delete_gate(g_0);
+            EXPECT_EQ(nl->get_gate_by_id(MIN_GATE_ID+0), nullptr);
+            EXPECT_EQ(nl->get_gate_by_id(0xFFFFFF00), g_1);
+            EXPECT_EQ(nl->get_gate_by_id(0x00100000), g_2);
+            EXPECT_EQ(nl->get_num_of_gates(), (u32)2);
+
+            std::shared_ptr<gate> g_3 = nl->create_gate(MIN_GATE_ID+0, get_gate_type_by_name("INV"), "gate_3");
+            EXPECT_EQ(nl->get_gate_by_id(MIN_GATE_ID+0), g_3);
+            EXPECT_FALSE(nl->is_gate_in_netlist(g_0));
+            EXPECT_TRUE(nl->is_gate_in_netlist(g_3));
+        }
+        {
+            // Get gates with sparse ids that are moved into the dense range once it grows
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            std::shared_ptr<gate> g_0   = nl->create_gate(100000, get_gate_type_by_name("INV"), "gate_0");
+            std::shared_ptr<gate> g_1   = nl->create_gate(130000, get_gate_type_by_name("INV"), "gate_1");
+            std::shared_ptr<gate> g_2   = nl->create_gate(60000, get_gate_type_by_name("INV"), "gate_2");
+            std::shared_ptr<gate> g_3   = nl->create_gate(110000, get_gate_type_by_name("INV"), "gate_3");
+            EXPECT_EQ(nl->get_gate_by_id(100000), g_0);
+            EXPECT_EQ(nl->get_gate_by_id(130000), g_1);
+            EXPECT_EQ(nl->get_gate_by_id(60000), g_2);
+            EXPECT_EQ(nl->get_gate_by_id(110000), g_3);
+
+            nl->delete_gate(g_0);
+            nl->delete_gate(g_1);
+            EXPECT_EQ(nl->get_gate_by_id(100000), nullptr);
+            EXPECT_EQ(nl->get_gate_by_id(130000), nullptr);
+            EXPECT_EQ(nl->get_gate_by_id(60000), g_2);
+            EXPECT_EQ(nl->get_gate_by_id(110000), g_3);
+            EXPECT_EQ(nl->get_num_of_gates(), (u32)2);
+        }
     TEST_END
 }
 
@@ -1325,3 +1404,95 @@ TEST_F(netlist_test, check_get_unique_module_id) {
     TEST_END
 }
 
+/**
+ * Testing the CSR graph snapshot of the netlist and its invalidation
+ *
+ * Functions: get_graph_snapshot
+ */
+TEST_F(netlist_test, check_get_graph_snapshot)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_empty_netlist();
+        std::shared_ptr<gate> g_0   = nl->create_gate(MIN_GATE_ID+0, get_gate_type_by_name("INV"), "gate_0");
+        std::shared_ptr<gate> g_1   = nl->create_gate(MIN_GATE_ID+1, get_gate_type_by_name("AND2"), "gate_1");
+        std::shared_ptr<gate> g_2   = nl->create_gate(MIN_GATE_ID+2, get_gate_type_by_name("INV"), "gate_2");
+
+        std::shared_ptr<net> n_0 = nl->create_net(MIN_NET_ID+0, "net_0");
+        n_0->set_src(g_0, "O");
+        n_0->add_dst(g_1, "I0");
+        n_0->add_dst(g_1, "I1");
+        std::shared_ptr<net> n_1 = nl->create_net(MIN_NET_ID+1, "net_1");
+        n_1->set_src(g_1, "O");
+        n_1->add_dst(g_2, "I");
+
+        auto snapshot = nl->get_graph_snapshot();
+        ASSERT_NE(snapshot, nullptr);
+        EXPECT_EQ(snapshot->get_num_of_gates(), 3u);
+        EXPECT_EQ(snapshot->get_num_of_nets(), 2u);
+        EXPECT_EQ(snapshot->get_num_of_edges(), 3u);
+
+        u32 idx_0 = snapshot->get_gate_index(g_0);
+        u32 idx_1 = snapshot->get_gate_index(g_1);
+        u32 idx_2 = snapshot->get_gate_index(g_2);
+        ASSERT_NE(idx_0, netlist_graph_snapshot::invalid_index);
+        ASSERT_NE(idx_1, netlist_graph_snapshot::invalid_index);
+        ASSERT_NE(idx_2, netlist_graph_snapshot::invalid_index);
+        EXPECT_EQ(snapshot->get_gate(idx_1), g_1);
+
+        // gate_0 drives both inputs of gate_1
+        auto successors = snapshot->get_successors(idx_0);
+        ASSERT_EQ(successors.size(), 2u);
+        std::set<u32> dst_pins;
+        for (const auto& e : successors)
+        {
+            EXPECT_EQ(e.gate, idx_1);
+            EXPECT_EQ(snapshot->get_net(e.net), n_0);
+            EXPECT_EQ(e.src_pin, 0u);
+            dst_pins.insert(e.dst_pin);
+        }
+        EXPECT_EQ(dst_pins, std::set<u32>({0, 1}));
+
+        auto predecessors = snapshot->get_predecessors(idx_2);
+        ASSERT_EQ(predecessors.size(), 1u);
+        EXPECT_EQ(predecessors[0].gate, idx_1);
+        EXPECT_EQ(snapshot->get_net(predecessors[0].net), n_1);
+        EXPECT_TRUE(snapshot->get_predecessors(idx_0).empty());
+        EXPECT_TRUE(snapshot->get_successors(idx_2).empty());
+
+        EXPECT_EQ(snapshot->get_fan_in_nets(idx_1).size(), 2u);
+        ASSERT_EQ(snapshot->get_fan_out_nets(idx_1).size(), 1u);
+        EXPECT_EQ(snapshot->get_net(snapshot->get_fan_out_nets(idx_1)[0].net), n_1);
+
+        // the snapshot is shared until the netlist changes
+        EXPECT_EQ(nl->get_graph_snapshot(), snapshot);
+        n_1->remove_dst(g_2, "I");
+        auto new_snapshot = nl->get_graph_snapshot();
+        EXPECT_NE(new_snapshot, snapshot);
+        EXPECT_EQ(new_snapshot->get_num_of_edges(), 2u);
+        EXPECT_EQ(snapshot->get_num_of_edges(), 3u);
+
+        // gates of other netlists are not part of the snapshot
+        std::shared_ptr<netlist> other_nl = create_empty_netlist();
+        std::shared_ptr<gate> other_g     = other_nl->create_gate(MIN_GATE_ID+0, get_gate_type_by_name("INV"), "gate_0");
+        EXPECT_EQ(new_snapshot->get_gate_index(other_g), netlist_graph_snapshot::invalid_index);
+        EXPECT_EQ(new_snapshot->get_gate_index(nullptr), netlist_graph_snapshot::invalid_index);
+
+        // concurrent callers share a single snapshot
+        n_1->add_dst(g_2, "I");
+        std::vector<std::shared_ptr<const netlist_graph_snapshot>> snapshots(8);
+        std::vector<std::thread> threads;
+        for (u32 i = 0; i < snapshots.size(); ++i)
+        {
+            threads.emplace_back([&nl, &snapshots, i]() { snapshots[i] = nl->get_graph_snapshot(); });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        EXPECT_EQ(snapshots[0]->get_num_of_edges(), 3u);
+        for (const auto& s : snapshots)
+        {
+            EXPECT_EQ(s, snapshots[0]);
+        }
+    TEST_END
+}
@@ -0,0 +1,212 @@
+#include "netlist/persistent/netlist_binary_file.h"
+#include "netlist/gate_library/gate_library_manager.h"
+#include "netlist/netlist.h"
+#include "netlist/netlist_factory.h"
+#include "netlist_test_utils.h"
+#include "gtest/gtest.h"
+#include <core/log.h>
+#include <core/utils.h>
+#include <netlist/gate.h>
+#include <netlist/module.h>
+#include <netlist/net.h>
+
+#include <fstream>
+
+using namespace test_utils;
+
+class netlist_binary_file_test : public ::testing::Test
+{
+protected:
+    hal::path test_hal_file_path;
+
+    virtual void SetUp()
+    {
+        NO_COUT_BLOCK;
+        gate_library_manager::load_all();
+        test_hal_file_path = core_utils::get_binary_directory() / "tmp_binary.hal";
+    }
+
+    virtual void TearDown()
+    {
+        fs::remove(test_hal_file_path);
+    }
+};
+
+/**
+ * Testing writing a netlist to a binary file and building it again from the file
+ *
+ * Functions: write, is_binary_file, open, create_netlist
+ */
+TEST_F(netlist_binary_file_test, check_write_and_create_netlist)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_example_netlist();
+        nl->set_design_name("design");
+
+        std::shared_ptr<module> m_0 = nl->create_module(MIN_MODULE_ID+1, "module_0", nl->get_top_module());
+        std::shared_ptr<module> m_1 = nl->create_module(MIN_MODULE_ID+2, "module_1", m_0);
+        m_0->assign_gate(nl->get_gate_by_id(MIN_GATE_ID+1));
+        m_1->assign_gate(nl->get_gate_by_id(MIN_GATE_ID+2));
+
+        nl->get_gate_by_id(MIN_GATE_ID+1)->set_data("category_0", "key_0", "data_type", "test_value");
+        nl->get_gate_by_id(MIN_GATE_ID+1)->set_data("category_1", "key_1", "data_type", "test_value_1");
+        nl->get_net_by_id(MIN_NET_ID+13)->set_data("category", "key_2", "data_type", "test_value");
+        m_1->set_data("category", "key_3", "data_type", "test_value");
+
+        nl->mark_gnd_gate(nl->get_gate_by_id(MIN_GATE_ID+1));
+        nl->mark_vcc_gate(nl->get_gate_by_id(MIN_GATE_ID+2));
+        nl->mark_global_input_net(nl->get_net_by_id(MIN_NET_ID+13));
+        nl->mark_global_output_net(nl->get_net_by_id(MIN_NET_ID+30));
+
+        ASSERT_TRUE(netlist_binary_file::write(nl, test_hal_file_path, "extension"));
+        EXPECT_TRUE(netlist_binary_file::is_binary_file(test_hal_file_path));
+
+        netlist_binary_file file;
+        ASSERT_TRUE(file.open(test_hal_file_path));
+        EXPECT_EQ(file.get_extension(), "extension");
+
+        std::shared_ptr<netlist> des_nl = file.create_netlist();
+        ASSERT_NE(des_nl, nullptr);
+        EXPECT_EQ(nl->get_id(), des_nl->get_id());
+        EXPECT_EQ(nl->get_gate_library()->get_name(), des_nl->get_gate_library()->get_name());
+        EXPECT_EQ(nl->get_gates().size(), des_nl->get_gates().size());
+        for (auto g_0 : nl->get_gates())
+        {
+            EXPECT_TRUE(gates_are_equal(g_0, des_nl->get_gate_by_id(g_0->get_id())));
+            EXPECT_EQ(nl->is_gnd_gate(g_0), des_nl->is_gnd_gate(des_nl->get_gate_by_id(g_0->get_id())));
+            EXPECT_EQ(nl->is_vcc_gate(g_0), des_nl->is_vcc_gate(des_nl->get_gate_by_id(g_0->get_id())));
+        }
+        EXPECT_EQ(nl->get_nets().size(), des_nl->get_nets().size());
+        for (auto n_0 : nl->get_nets())
+        {
+            EXPECT_TRUE(nets_are_equal(n_0, des_nl->get_net_by_id(n_0->get_id())));
+            EXPECT_EQ(nl->is_global_input_net(n_0), des_nl->is_global_input_net(des_nl->get_net_by_id(n_0->get_id())));
+            EXPECT_EQ(nl->is_global_output_net(n_0), des_nl->is_global_output_net(des_nl->get_net_by_id(n_0->get_id())));
+        }
+        EXPECT_EQ(nl->get_modules().size(), des_nl->get_modules().size());
+        for (auto m : nl->get_modules())
+        {
+            EXPECT_TRUE(modules_are_equal(m, des_nl->get_module_by_id(m->get_id())));
+        }
+        EXPECT_EQ(des_nl->get_design_name(), "design");
+        EXPECT_EQ(des_nl->get_module_by_id(MIN_MODULE_ID+2)->get_parent_module()->get_id(), MIN_MODULE_ID+1);
+        EXPECT_EQ(des_nl->get_gate_by_id(MIN_GATE_ID+1)->get_data(), nl->get_gate_by_id(MIN_GATE_ID+1)->get_data());
+        EXPECT_EQ(des_nl->get_net_by_id(MIN_NET_ID+13)->get_data(), nl->get_net_by_id(MIN_NET_ID+13)->get_data());
+        EXPECT_EQ(des_nl->get_module_by_id(MIN_MODULE_ID+2)->get_data(), m_1->get_data());
+
+        // data is skipped on request
+        std::shared_ptr<netlist> des_nl_no_data = file.create_netlist(false);
+        ASSERT_NE(des_nl_no_data, nullptr);
+        EXPECT_EQ(des_nl_no_data->get_gates().size(), nl->get_gates().size());
+        EXPECT_TRUE(des_nl_no_data->get_gate_by_id(MIN_GATE_ID+1)->get_data().empty());
+    TEST_END
+}
+
+/**
+ * Testing the access to single elements of an opened file without building the netlist
+ *
+ * Functions: get_num_of_gates, get_gate_id, get_gate_name, get_gate_type, get_gate_data, get_net_name, get_module_name
+ */
+TEST_F(netlist_binary_file_test, check_element_access)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_example_netlist();
+        nl->get_gate_by_id(MIN_GATE_ID+3)->set_data("category", "key", "data_type", "test_value");
+        ASSERT_TRUE(netlist_binary_file::write(nl, test_hal_file_path));
+
+        netlist_binary_file file;
+        ASSERT_TRUE(file.open(test_hal_file_path));
+        EXPECT_EQ(file.get_gate_library_name(), nl->get_gate_library()->get_name());
+        ASSERT_EQ(file.get_num_of_gates(), nl->get_gates().size());
+        ASSERT_EQ(file.get_num_of_nets(), nl->get_nets().size());
+        ASSERT_EQ(file.get_num_of_modules(), 1);
+        EXPECT_EQ(file.get_module_name(0), nl->get_top_module()->get_name());
+
+        for (u32 i = 0; i < file.get_num_of_gates(); ++i)
+        {
+            auto g = nl->get_gate_by_id(file.get_gate_id(i));
+            ASSERT_NE(g, nullptr);
+            EXPECT_EQ(file.get_gate_name(i), g->get_name());
+            EXPECT_EQ(file.get_gate_type(i), g->get_type()->get_name());
+            EXPECT_EQ(file.get_gate_data(i), g->get_data());
+        }
+        for (u32 i = 0; i < file.get_num_of_nets(); ++i)
+        {
+            auto n = nl->get_net_by_id(file.get_net_id(i));
+            ASSERT_NE(n, nullptr);
+            EXPECT_EQ(file.get_net_name(i), n->get_name());
+        }
+    TEST_END
+}
+
+/**
+ * Testing the handling of invalid files
+ *
+ * Functions: is_binary_file, open, create_netlist
+ */
+TEST_F(netlist_binary_file_test, check_invalid_files)
+{
+    TEST_START
+        {
+            // Open a non existing file
+            NO_COUT_TEST_BLOCK;
+            netlist_binary_file file;
+            EXPECT_FALSE(netlist_binary_file::is_binary_file(hal::path("/using/this/file/is/let.hal")));
+            EXPECT_FALSE(file.open(hal::path("/using/this/file/is/let.hal")));
+            EXPECT_EQ(file.create_netlist(), nullptr);
+        }
+        {
+            // Open a JSON file
+            NO_COUT_TEST_BLOCK;
+            std::ofstream ofs(test_hal_file_path.string());
+            ofs << "{\"serialization_format_version\":4}";
+            ofs.close();
+
+            netlist_binary_file file;
+            EXPECT_FALSE(netlist_binary_file::is_binary_file(test_hal_file_path));
+            EXPECT_FALSE(file.open(test_hal_file_path));
+        }
+        {
+            // Open a truncated file
+            NO_COUT_TEST_BLOCK;
+            ASSERT_TRUE(netlist_binary_file::write(create_example_netlist(), test_hal_file_path));
+            auto size = fs::file_size(test_hal_file_path);
+            fs::resize_file(test_hal_file_path, size / 2);
+
+            netlist_binary_file file;
+            EXPECT_TRUE(netlist_binary_file::is_binary_file(test_hal_file_path));
+            EXPECT_FALSE(file.open(test_hal_file_path));
+            EXPECT_EQ(file.create_netlist(), nullptr);
+        }
+        {
+            // A net is connected to a pin that does not exist
+            NO_COUT_TEST_BLOCK;
+            auto nl = create_empty_netlist();
+            auto g  = nl->create_gate(MIN_GATE_ID + 0, get_gate_type_by_name("AND2"), "gate_0");
+            auto n  = nl->create_net(MIN_NET_ID + 0, "net_0");
+            ASSERT_NE(g, nullptr);
+            ASSERT_NE(n, nullptr);
+            ASSERT_TRUE(n->add_dst(g, "I1"));
+            ASSERT_TRUE(netlist_binary_file::write(nl, test_hal_file_path));
+
+            // rename the pin in the string table
+            std::string content;
+            {
+                std::ifstream ifs(test_hal_file_path.string(), std::ios::binary);
+                content.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+            }
+            auto pos = content.find("I1");
+            ASSERT_NE(pos, std::string::npos);
+            ASSERT_EQ(content.find("I1", pos + 1), std::string::npos);
+            content[pos + 1] = '9';
+            {
+                std::ofstream ofs(test_hal_file_path.string(), std::ios::binary);
+                ofs << content;
+            }
+
+            netlist_binary_file file;
+            EXPECT_TRUE(file.open(test_hal_file_path));
+            EXPECT_EQ(file.create_netlist(), nullptr);
+        }
+    TEST_END
+}
@@ -0,0 +1,158 @@
+#include "netlist/gate_library/gate_library_manager.h"
+#include "netlist/netlist.h"
+#include "netlist/netlist_builder.h"
+#include "netlist/netlist_factory.h"
+#include "netlist/event_system/gate_event_handler.h"
+#include "netlist/event_system/net_event_handler.h"
+#include "netlist/event_system/netlist_event_handler.h"
+#include "netlist_test_utils.h"
+#include "gtest/gtest.h"
+#include <core/log.h>
+#include <iostream>
+#include <netlist/gate.h>
+#include <netlist/module.h>
+#include <netlist/net.h>
+
+using namespace test_utils;
+
+class netlist_builder_test : public ::testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        NO_COUT_BLOCK;
+        gate_library_manager::load_all();
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+/**
+ * Testing the creation of gates and nets as well as their connections via the builder
+ *
+ * Functions: create_gate, create_net, set_src, add_dst, assign_gate
+ */
+TEST_F(netlist_builder_test, check_build)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_empty_netlist();
+        std::shared_ptr<module> m   = nl->create_module(MIN_MODULE_ID+0, "module_0", nl->get_top_module());
+        {
+            netlist_builder builder(nl);
+            builder.reserve(2, 1);
+
+            std::shared_ptr<gate> g_0 = builder.create_gate(MIN_GATE_ID+0, get_gate_type_by_name("INV"), "gate_0");
+            std::shared_ptr<gate> g_1 = builder.create_gate(get_gate_type_by_name("AND2"), "gate_1");
+            std::shared_ptr<net> n_0  = builder.create_net(MIN_NET_ID+0, "net_0");
+            ASSERT_NE(g_0, nullptr);
+            ASSERT_NE(g_1, nullptr);
+            ASSERT_NE(n_0, nullptr);
+
+            EXPECT_TRUE(builder.set_src(n_0, g_0, "O"));
+            EXPECT_TRUE(builder.add_dst(n_0, g_1, "I0"));
+            EXPECT_TRUE(builder.add_dst(n_0, g_1, "I1"));
+            EXPECT_TRUE(builder.assign_gate(m, g_1));
+
+            // the netlist reflects the changes immediately
+            EXPECT_TRUE(nl->is_gate_in_netlist(g_0));
+            EXPECT_TRUE(nl->is_net_in_netlist(n_0));
+            EXPECT_EQ(nl->get_gate_by_id(MIN_GATE_ID+0), g_0);
+            EXPECT_EQ(n_0->get_src(), get_endpoint(g_0, "O"));
+            EXPECT_EQ(n_0->get_num_of_dsts(), 2u);
+            EXPECT_EQ(g_1->get_fan_in_net("I0"), n_0);
+            EXPECT_EQ(g_0->get_fan_out_net("O"), n_0);
+            EXPECT_EQ(g_1->get_predecessor("I1"), get_endpoint(g_0, "O"));
+            EXPECT_EQ(g_0->get_module(), nl->get_top_module());
+            EXPECT_EQ(g_1->get_module(), m);
+            EXPECT_TRUE(m->contains_gate(g_1));
+        }
+        // NEGATIVE
+        {
+            NO_COUT_TEST_BLOCK;
+            netlist_builder builder(nl);
+            std::shared_ptr<gate> g_0 = nl->get_gate_by_id(MIN_GATE_ID+0);
+            std::shared_ptr<gate> g_1 = nl->get_gate_by_id(MIN_GATE_ID+1);
+            std::shared_ptr<net> n_0  = nl->get_net_by_id(MIN_NET_ID+0);
+
+            // the ids are already taken or invalid
+            EXPECT_EQ(builder.create_gate(MIN_GATE_ID+0, get_gate_type_by_name("INV"), "gate_2"), nullptr);
+            EXPECT_EQ(builder.create_gate(0, get_gate_type_by_name("INV"), "gate_2"), nullptr);
+            EXPECT_EQ(builder.create_net(MIN_NET_ID+0, "net_1"), nullptr);
+            EXPECT_EQ(builder.create_net(0, "net_1"), nullptr);
+
+            // the names are empty or the gate type is invalid
+            EXPECT_EQ(builder.create_gate(get_gate_type_by_name("INV"), ""), nullptr);
+            EXPECT_EQ(builder.create_gate(get_gate_type_by_name("INV"), "  "), nullptr);
+            EXPECT_EQ(builder.create_gate(nullptr, "gate_2"), nullptr);
+            EXPECT_EQ(builder.create_net(""), nullptr);
+            EXPECT_EQ(builder.create_net(" \t"), nullptr);
+
+            // the pins are unknown or already occupied
+            std::shared_ptr<net> n_1 = builder.create_net(MIN_NET_ID+1, "net_1");
+            ASSERT_NE(n_1, nullptr);
+            EXPECT_FALSE(builder.set_src(n_1, g_0, "I"));
+            EXPECT_FALSE(builder.set_src(n_1, g_0, "O"));
+            EXPECT_FALSE(builder.add_dst(n_1, g_1, "O"));
+            EXPECT_FALSE(builder.add_dst(n_1, g_1, "I0"));
+            EXPECT_FALSE(builder.add_dst(n_0, g_1, "I0"));
+            EXPECT_FALSE(builder.add_dst(nullptr, g_1, "I0"));
+            EXPECT_EQ(n_1->get_src().gate, nullptr);
+            EXPECT_TRUE(n_1->get_dsts().empty());
+        }
+    TEST_END
+}
+
+/**
+ * Testing that the builder fires a single event on commit instead of one event per change
+ *
+ * Functions: commit
+ */
+TEST_F(netlist_builder_test, check_commit)
+{
+    TEST_START
+        u32 num_of_netlist_events = 0;
+        u32 num_of_gate_events    = 0;
+        u32 num_of_net_events     = 0;
+        netlist_event_handler::register_callback("netlist_builder_test", [&](netlist_event_handler::event e, std::shared_ptr<netlist>, u32) {
+            if (e == netlist_event_handler::event::bulk_changes_committed)
+            {
+                num_of_netlist_events++;
+            }
+        });
+        gate_event_handler::register_callback("netlist_builder_test", [&](gate_event_handler::event, std::shared_ptr<gate>, u32) { num_of_gate_events++; });
+        net_event_handler::register_callback("netlist_builder_test", [&](net_event_handler::event, std::shared_ptr<net>, u32) { num_of_net_events++; });
+
+        std::shared_ptr<netlist> nl = create_empty_netlist();
+        {
+            netlist_builder builder(nl);
+            for (u32 i = 0; i < 10; i++)
+            {
+                std::shared_ptr<gate> g = builder.create_gate(get_gate_type_by_name("INV"), "gate_" + std::to_string(i));
+                std::shared_ptr<net> n  = builder.create_net("net_" + std::to_string(i));
+                builder.set_src(n, g, "O");
+            }
+            EXPECT_EQ(num_of_netlist_events, 0u);
+
+            builder.commit();
+            EXPECT_EQ(num_of_netlist_events, 1u);
+
+            // nothing left to commit
+            builder.commit();
+            EXPECT_EQ(num_of_netlist_events, 1u);
+
+            builder.create_net("net_10");
+        }
+        // the destructor commits pending changes
+        EXPECT_EQ(num_of_netlist_events, 2u);
+        EXPECT_EQ(num_of_gate_events, 0u);
+        EXPECT_EQ(num_of_net_events, 0u);
+        EXPECT_EQ(nl->get_gates().size(), 10u);
+        EXPECT_EQ(nl->get_nets().size(), 11u);
+
+        netlist_event_handler::unregister_callback("netlist_builder_test");
+        gate_event_handler::unregister_callback("netlist_builder_test");
+        net_event_handler::unregister_callback("netlist_builder_test");
+    TEST_END
+}
@@ -0,0 +1,254 @@
+#include "netlist/gate_library/gate_library.h"
+#include "netlist/gate_library/gate_library_manager.h"
+#include "netlist/netlist.h"
+#include "netlist_test_utils.h"
+#include "gtest/gtest.h"
+#include <core/utils.h>
+#include <fstream>
+#include <netlist/gate.h>
+#include <netlist/net.h>
+#include <netlist/netlist_sequential_simulator.h>
+#include <sstream>
+
+using namespace test_utils;
+
+class netlist_sequential_simulator_test : public ::testing::Test
+{
+protected:
+    hal::path test_file_path;
+
+    virtual void SetUp()
+    {
+        NO_COUT_BLOCK;
+        gate_library_manager::load_all();
+        test_file_path = core_utils::get_binary_directory() / "tmp_simulation.txt";
+    }
+
+    virtual void TearDown()
+    {
+        fs::remove(test_file_path);
+    }
+
+    // a two bit counter with synchronous enable and asynchronous reset
+    struct counter
+    {
+        std::shared_ptr<netlist> nl;
+        std::shared_ptr<net> clk, ce, rst, q0, q1;
+    };
+
+    counter create_counter()
+    {
+        counter c;
+        c.nl  = create_empty_netlist();
+        c.clk = c.nl->create_net("clk");
+        c.ce  = c.nl->create_net("ce");
+        c.rst = c.nl->create_net("rst");
+
+        auto ff_0 = c.nl->create_gate(get_gate_type_by_name("FFR"), "ff_0");
+        auto ff_1 = c.nl->create_gate(get_gate_type_by_name("FFR"), "ff_1");
+        c.q0      = c.nl->create_net("q0");
+        c.q1      = c.nl->create_net("q1");
+        c.q0->set_src(ff_0, "Q");
+        c.q1->set_src(ff_1, "Q");
+
+        auto d0 = connect_test_gate(c.nl, c.nl->create_gate(get_gate_type_by_name("INV"), "inv"), {{"I", c.q0}}, "O");
+        auto d1 = connect_test_gate(c.nl, c.nl->create_gate(get_gate_type_by_name("XOR"), "xor"), {{"I0", c.q0}, {"I1", c.q1}}, "O");
+        for (const auto& [ff, d] : {std::make_pair(ff_0, d0), std::make_pair(ff_1, d1)})
+        {
+            c.clk->add_dst(ff, "C");
+            c.ce->add_dst(ff, "CE");
+            c.rst->add_dst(ff, "R");
+            d->add_dst(ff, "D");
+        }
+        return c;
+    }
+};
+
+/**
+ * Testing the clocking of flip-flops
+ *
+ * Functions: constructor, set_input, step, run_clock_cycles, get_time, get_num_evaluations
+ */
+TEST_F(netlist_sequential_simulator_test, check_flip_flops)
+{
+    TEST_START
+        auto c = create_counter();
+        netlist_sequential_simulator sim(c.nl);
+        EXPECT_EQ(sim.get_input_nets(), std::vector<std::shared_ptr<net>>({c.clk, c.ce, c.rst}));
+        {
+            // The state is X until the reset
+            sim.set_input(c.clk, boolean_function::ZERO);
+            sim.set_input(c.ce, boolean_function::ONE);
+            sim.step();
+            EXPECT_EQ(sim.get_value(c.q0, 0), boolean_function::X);
+            sim.set_input(c.rst, boolean_function::ONE);
+            sim.step();
+            EXPECT_EQ(sim.get_value(c.q0, 0), boolean_function::ZERO);
+            EXPECT_EQ(sim.get_value(c.q1, 0), boolean_function::ZERO);
+            sim.set_input(c.rst, boolean_function::ZERO);
+            sim.step();
+            EXPECT_EQ(sim.get_time(), 3);
+        }
+        {
+            // Counting on rising edges only
+            for (u32 i = 1; i <= 5; ++i)
+            {
+                EXPECT_TRUE(sim.run_clock_cycles(c.clk, 1));
+                EXPECT_EQ(sim.get_value(c.q0, 0), (i & 1) ? boolean_function::ONE : boolean_function::ZERO);
+                EXPECT_EQ(sim.get_value(c.q1, 0), (i & 2) ? boolean_function::ONE : boolean_function::ZERO);
+            }
+            sim.set_input(c.clk, boolean_function::ZERO);
+            sim.step();
+            EXPECT_EQ(sim.get_value(c.q0, 0), boolean_function::ONE);
+        }
+        {
+            // Disabled flip-flops keep their state
+            sim.set_input(c.ce, boolean_function::ZERO);
+            sim.run_clock_cycles(c.clk, 2);
+            EXPECT_EQ(sim.get_value(c.q0, 0), boolean_function::ONE);
+            EXPECT_EQ(sim.get_value(c.q1, 0), boolean_function::ZERO);
+        }
+        {
+            // Steps without changes evaluate nothing
+            u64 evaluations = sim.get_num_evaluations();
+            sim.step();
+            sim.step();
+            EXPECT_EQ(sim.get_num_evaluations(), evaluations);
+        }
+        {
+            // Every pattern is simulated on its own
+            sim.set_input(c.ce, 0xFull);
+            sim.run_clock_cycles(c.clk, 1);
+            EXPECT_EQ(sim.get_value(c.q0), std::make_pair((u64)0xFFFFFFFFFFFFFFF0ull, (u64)0));
+            EXPECT_EQ(sim.get_value(c.q1), std::make_pair((u64)0xFull, (u64)0));
+        }
+        {
+            // Invalid calls
+            NO_COUT_TEST_BLOCK;
+            EXPECT_FALSE(sim.set_input(c.q0, boolean_function::ONE));
+            EXPECT_FALSE(sim.run_clock_cycles(nullptr, 1));
+        }
+    TEST_END
+}
+
+/**
+ * Testing transparent latches
+ *
+ * Functions: step
+ */
+TEST_F(netlist_sequential_simulator_test, check_latches)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_empty_netlist();
+        auto lib                    = nl->get_gate_library();
+        if (lib->get_gate_types().find("TEST_LATCH") == lib->get_gate_types().end())
+        {
+            auto type = std::make_shared<gate_type_sequential>("TEST_LATCH", gate_type::base_type::latch);
+            type->add_input_pins({"D", "E"});
+            type->add_output_pins({"Q", "QN"});
+            type->add_boolean_function("data_in", boolean_function::from_string("D"));
+            type->add_boolean_function("enable", boolean_function::from_string("E"));
+            type->add_state_output_pin("Q");
+            type->add_inverted_state_output_pin("QN");
+            lib->add_gate_type(type);
+        }
+
+        auto d     = nl->create_net("d");
+        auto e     = nl->create_net("e");
+        auto latch = nl->create_gate(lib->get_gate_types().at("TEST_LATCH"), "latch");
+        d->add_dst(latch, "D");
+        e->add_dst(latch, "E");
+        auto q  = nl->create_net("q");
+        auto qn = nl->create_net("qn");
+        q->set_src(latch, "Q");
+        qn->set_src(latch, "QN");
+
+        netlist_sequential_simulator sim(nl);
+        sim.set_input(e, boolean_function::ONE);
+        sim.set_input(d, boolean_function::ONE);
+        sim.step();
+        EXPECT_EQ(sim.get_value(q, 0), boolean_function::ONE);
+        EXPECT_EQ(sim.get_value(qn, 0), boolean_function::ZERO);
+
+        // transparent while enabled
+        sim.set_input(d, boolean_function::ZERO);
+        sim.step();
+        EXPECT_EQ(sim.get_value(q, 0), boolean_function::ZERO);
+
+        // holds the state while disabled
+        sim.set_input(e, boolean_function::ZERO);
+        sim.step();
+        sim.set_input(d, boolean_function::ONE);
+        sim.step();
+        EXPECT_EQ(sim.get_value(q, 0), boolean_function::ZERO);
+        EXPECT_EQ(sim.get_value(qn, 0), boolean_function::ONE);
+    TEST_END
+}
+
+/**
+ * Testing stimulus files and the VCD output
+ *
+ * Functions: run_stimulus, write_vcd
+ */
+TEST_F(netlist_sequential_simulator_test, check_stimulus_and_vcd)
+{
+    TEST_START
+        auto c = create_counter();
+        netlist_sequential_simulator sim(c.nl);
+        {
+            std::ofstream file(test_file_path.string());
+            file << "# reset, then two rising edges" << std::endl;
+            file << "0 ce 1" << std::endl;
+            file << "0 rst 1" << std::endl;
+            file << "0 clk 0" << std::endl;
+            file << "5 rst 0" << std::endl;
+            file << "10 clk 1" << std::endl;
+            file << "15 clk 0" << std::endl;
+            file << "20 clk 1" << std::endl;
+        }
+        EXPECT_TRUE(sim.run_stimulus(test_file_path));
+        EXPECT_EQ(sim.get_time(), 21);
+        EXPECT_EQ(sim.get_value(c.q0, 0), boolean_function::ZERO);
+        EXPECT_EQ(sim.get_value(c.q1, 0), boolean_function::ONE);
+
+        EXPECT_TRUE(sim.write_vcd(test_file_path));
+        std::ifstream file(test_file_path.string());
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        std::string vcd = buffer.str();
+
+        // the identifier of a net follows its index, which is sorted by id
+        std::string q0_id(1, (char)('!' + 4));
+        EXPECT_NE(vcd.find("$var wire 1 " + q0_id + " q0 $end"), std::string::npos);
+        EXPECT_NE(vcd.find("$enddefinitions $end"), std::string::npos);
+        auto get_changes = [&vcd](u64 time) {
+            auto begin = vcd.find("#" + std::to_string(time) + "\n");
+            if (begin == std::string::npos)
+            {
+                return std::string();
+            }
+            // identifiers may contain '#' as well, times start at the beginning of a line
+            return vcd.substr(begin, vcd.find("\n#", begin) + 1 - begin);
+        };
+        EXPECT_NE(get_changes(0).find("\n0" + q0_id + "\n"), std::string::npos);
+        EXPECT_NE(get_changes(10).find("\n1" + q0_id + "\n"), std::string::npos);
+        EXPECT_EQ(get_changes(15).find(q0_id + "\n"), std::string::npos);
+        EXPECT_NE(get_changes(20).find("\n0" + q0_id + "\n"), std::string::npos);
+
+        {
+            // Invalid stimulus files
+            NO_COUT_TEST_BLOCK;
+            {
+                std::ofstream invalid(test_file_path.string());
+                invalid << "30 q0 1" << std::endl;
+            }
+            EXPECT_FALSE(sim.run_stimulus(test_file_path));
+            {
+                std::ofstream invalid(test_file_path.string());
+                invalid << "5 clk 1" << std::endl;
+            }
+            EXPECT_FALSE(sim.run_stimulus(test_file_path));
+            EXPECT_FALSE(sim.run_stimulus(hal::path("/this/file/does/not/exist")));
+        }
+    TEST_END
+}
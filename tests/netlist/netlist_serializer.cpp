@@ -1,4 +1,5 @@
 #include "netlist/persistent/netlist_serializer.h"
+#include "core/hal_file_manager.h"
 #include "netlist/gate_library/gate_library_manager.h"
 #include "netlist/netlist.h"
 #include "netlist/netlist_factory.h"
@@ -15,6 +16,8 @@
 #include <fstream>
 #include <streambuf>
 #include <string>
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
 
 using namespace test_utils;
 
@@ -34,6 +37,38 @@ protected:
     {
         fs::remove(test_hal_file_path);
     }
+
+    // rewrites the .hal file with the given members of the 'netlist' node in front
+    void move_netlist_members_to_front(const std::vector<std::string>& members)
+    {
+        std::ifstream in(test_hal_file_path.string());
+        std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        in.close();
+
+        rapidjson::Document document;
+        document.Parse(content.c_str());
+        auto& allocator = document.GetAllocator();
+
+        rapidjson::Value reordered(rapidjson::kObjectType);
+        for (const auto& member : members)
+        {
+            reordered.AddMember(rapidjson::Value(member, allocator), document["netlist"][member], allocator);
+        }
+        for (auto& member : document["netlist"].GetObject())
+        {
+            if (std::find(members.begin(), members.end(), member.name.GetString()) == members.end())
+            {
+                reordered.AddMember(member.name, member.value, allocator);
+            }
+        }
+        document["netlist"] = reordered;
+
+        rapidjson::StringBuffer strbuf;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
+        document.Accept(writer);
+        std::ofstream out(test_hal_file_path.string());
+        out << strbuf.GetString();
+    }
 };
 
 /**
@@ -151,6 +186,86 @@ TEST_F(netlist_serializer_test, check_serialize_and_deserialize){
     TEST_END
 }
 
+/**
+ * Testing the deserialization of a file whose elements precede the elements they refer to, e.g., nets before gates or
+ * modules before their parent module. Top-level members other than the netlist are passed to the hal_file_manager.
+ *
+ * Functions: serialize_netlist, deserialize_netlist
+ */
+TEST_F(netlist_serializer_test, check_deserialize_member_order)
+{
+    TEST_START
+        {
+            std::shared_ptr<netlist> nl = create_example_netlist();
+
+            std::shared_ptr<module> test_m = nl->create_module(MIN_MODULE_ID+1, "test_type", nl->get_top_module());
+            test_m->assign_gate(nl->get_gate_by_id(MIN_GATE_ID+1));
+            std::shared_ptr<module> child_m = nl->create_module(MIN_MODULE_ID+2, "child_type", test_m);
+            child_m->assign_gate(nl->get_gate_by_id(MIN_GATE_ID+2));
+            nl->get_net_by_id(MIN_NET_ID+13)->set_data("category", "key", "data_type", "test_value");
+            std::shared_ptr<net> in_net = nl->create_net(MIN_NET_ID+100, "net_in_7");
+            in_net->add_dst(nl->get_gate_by_id(MIN_GATE_ID+7), "I1");
+
+            nl->mark_gnd_gate(nl->get_gate_by_id(MIN_GATE_ID+1));
+            nl->mark_vcc_gate(nl->get_gate_by_id(MIN_GATE_ID+2));
+            nl->mark_global_input_net(in_net);
+            nl->mark_global_output_net(nl->get_net_by_id(MIN_NET_ID+30));
+
+            hal_file_manager::register_on_serialize_callback("test_extension", [](const hal::path&, std::shared_ptr<netlist>, rapidjson::Document& document) {
+                rapidjson::Value extension(rapidjson::kObjectType);
+                extension.AddMember("value", 42, document.GetAllocator());
+                document.AddMember("test_extension", extension, document.GetAllocator());
+                return true;
+            });
+            int extension_value = 0;
+            bool has_netlist_member = true;
+            hal_file_manager::register_on_deserialize_callback("test_extension", [&](const hal::path&, std::shared_ptr<netlist>, rapidjson::Document& document) {
+                has_netlist_member = document.HasMember("netlist");
+                if (document.HasMember("test_extension"))
+                {
+                    extension_value = document["test_extension"]["value"].GetInt();
+                }
+                return true;
+            });
+
+            NO_COUT_TEST_BLOCK;
+            ASSERT_TRUE(netlist_serializer::serialize_to_file(nl, test_hal_file_path));
+
+            // modules are serialized in a fixed order, put the child module first to make it precede its parent
+            move_netlist_members_to_front({"modules", "global_out", "global_in", "nets", "global_gnd", "global_vcc", "gates"});
+            std::shared_ptr<netlist> des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+
+            hal_file_manager::unregister_on_serialize_callback("test_extension");
+            hal_file_manager::unregister_on_deserialize_callback("test_extension");
+
+            ASSERT_NE(des_nl, nullptr);
+            EXPECT_EQ(extension_value, 42);
+            EXPECT_FALSE(has_netlist_member);
+
+            EXPECT_EQ(nl->get_gates().size(), des_nl->get_gates().size());
+            for (auto g_0 : nl->get_gates())
+            {
+                EXPECT_TRUE(gates_are_equal(g_0, des_nl->get_gate_by_id(g_0->get_id())));
+            }
+            EXPECT_EQ(nl->get_nets().size(), des_nl->get_nets().size());
+            for (auto n_0 : nl->get_nets())
+            {
+                EXPECT_TRUE(nets_are_equal(n_0, des_nl->get_net_by_id(n_0->get_id())));
+            }
+            EXPECT_EQ(nl->get_modules().size(), des_nl->get_modules().size());
+            for (auto m_0 : nl->get_modules())
+            {
+                EXPECT_TRUE(modules_are_equal(m_0, des_nl->get_module_by_id(m_0->get_id())));
+            }
+
+            EXPECT_TRUE(des_nl->is_gnd_gate(des_nl->get_gate_by_id(MIN_GATE_ID+1)));
+            EXPECT_TRUE(des_nl->is_vcc_gate(des_nl->get_gate_by_id(MIN_GATE_ID+2)));
+            EXPECT_TRUE(des_nl->is_global_input_net(des_nl->get_net_by_id(MIN_NET_ID+100)));
+            EXPECT_TRUE(des_nl->is_global_output_net(des_nl->get_net_by_id(MIN_NET_ID+30)));
+        }
+    TEST_END
+}
+
 /**
  * Testing the serialization and deserialization of a netlist with invalid input
  *
@@ -188,5 +303,26 @@ TEST_F(netlist_serializer_test, check_serialize_and_deserialize_negative)
             std::shared_ptr<netlist> des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
             EXPECT_EQ(des_nl, nullptr);
         }
+        {
+            // Deserialize a net that refers to a gate that does not exist
+            NO_COUT_TEST_BLOCK;
+            std::shared_ptr<netlist> nl = create_example_netlist(0);
+            ASSERT_TRUE(netlist_serializer::serialize_to_file(nl, test_hal_file_path));
+            std::ifstream in(test_hal_file_path.string());
+            std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            in.close();
+            rapidjson::Document document;
+            document.Parse(content.c_str());
+            document["netlist"]["gates"].Erase(document["netlist"]["gates"].Begin());
+            rapidjson::StringBuffer strbuf;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
+            document.Accept(writer);
+            std::ofstream myfile;
+            myfile.open(test_hal_file_path.string());
+            myfile << strbuf.GetString();
+            myfile.close();
+            std::shared_ptr<netlist> des_nl = netlist_serializer::deserialize_from_file(test_hal_file_path);
+            EXPECT_EQ(des_nl, nullptr);
+        }
     TEST_END
 }
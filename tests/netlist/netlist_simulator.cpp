@@ -0,0 +1,152 @@
+#include "netlist/gate_library/gate_library_manager.h"
+#include "netlist/netlist.h"
+#include "netlist_test_utils.h"
+#include "gtest/gtest.h"
+#include <netlist/gate.h>
+#include <netlist/net.h>
+#include <netlist/netlist_simulator.h>
+#include <netlist/netlist_utils.h>
+#include <random>
+
+using namespace test_utils;
+
+class netlist_simulator_test : public ::testing::Test
+{
+protected:
+    using bit_planes = std::pair<u64, u64>;
+
+    virtual void SetUp()
+    {
+        NO_COUT_BLOCK;
+        gate_library_manager::load_all();
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+/**
+ * Testing the simulation of 64 patterns at once
+ *
+ * Functions: constructor, get_input_nets, get_num_evaluated_outputs, set_input, simulate, get_value
+ */
+TEST_F(netlist_simulator_test, check_simulation)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_empty_netlist();
+        auto a                      = nl->create_net("a");
+        auto b                      = nl->create_net("b");
+        auto c                      = nl->create_net("c");
+
+        auto and_out = connect_test_gate(nl, nl->create_gate(get_gate_type_by_name("AND2"), "and"), {{"I0", a}, {"I1", b}}, "O");
+        auto inv_out = connect_test_gate(nl, nl->create_gate(get_gate_type_by_name("INV"), "inv"), {{"I", and_out}}, "O");
+        auto xor_out = connect_test_gate(nl, nl->create_gate(get_gate_type_by_name("XOR"), "xor"), {{"I0", inv_out}, {"I1", c}}, "O");
+        auto ff_out  = connect_test_gate(nl, nl->create_gate(get_gate_type_by_name("FF"), "ff"), {{"D", xor_out}}, "Q");
+        auto out     = connect_test_gate(nl, nl->create_gate(get_gate_type_by_name("AND2"), "and_ff"), {{"I0", ff_out}, {"I1", a}}, "O");
+
+        netlist_simulator sim(nl);
+        EXPECT_EQ(sim.get_input_nets(), std::vector<std::shared_ptr<net>>({a, b, c, ff_out}));
+        EXPECT_EQ(sim.get_num_evaluated_outputs(), 4);
+
+        u64 pa = 0xAAAAAAAAAAAAAAAAull, pb = 0xCCCCCCCCCCCCCCCCull, pc = 0xF0F0F0F0F0F0F0F0ull;
+        {
+            // Combinational logic, the flip-flop output is X
+            EXPECT_TRUE(sim.set_input(a, pa));
+            EXPECT_TRUE(sim.set_input(b, pb));
+            EXPECT_TRUE(sim.set_input(c, pc));
+            sim.simulate();
+            EXPECT_EQ(sim.get_value(xor_out), bit_planes(~(pa & pb) ^ pc, 0ull));
+            EXPECT_EQ(sim.get_value(out), bit_planes(0ull, pa));
+            EXPECT_EQ(sim.get_value(out, 0), boolean_function::ZERO);
+            EXPECT_EQ(sim.get_value(out, 1), boolean_function::X);
+        }
+        {
+            // Flip-flop outputs are cut points
+            EXPECT_TRUE(sim.set_input(ff_out, boolean_function::ONE));
+            sim.simulate();
+            EXPECT_EQ(sim.get_value(out), bit_planes(pa, 0ull));
+        }
+        {
+            // Invalid calls
+            NO_COUT_TEST_BLOCK;
+            EXPECT_FALSE(sim.set_input(xor_out, boolean_function::ONE));
+            EXPECT_FALSE(sim.set_input(nullptr, boolean_function::ONE));
+            EXPECT_EQ(sim.get_value(nullptr), bit_planes(0ull, ~0ull));
+            EXPECT_EQ(sim.get_value(out, 64), boolean_function::X);
+        }
+    TEST_END
+}
+
+/**
+ * Testing the simulation against the composed functions of random netlists
+ *
+ * Functions: simulate, get_value
+ */
+TEST_F(netlist_simulator_test, check_random_netlist)
+{
+    TEST_START
+        {
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            std::vector<std::shared_ptr<net>> nets;
+            for (u32 i = 0; i < 6; ++i)
+            {
+                nets.push_back(nl->create_net("in_" + std::to_string(i)));
+            }
+
+            std::mt19937 rng(7);
+            std::vector<std::string> types = {"AND2", "OR2", "XOR", "MUX", "INV"};
+            for (u32 i = 0; i < 200; ++i)
+            {
+                auto type = get_gate_type_by_name(types[rng() % types.size()]);
+                auto g    = nl->create_gate(type, "gate_" + std::to_string(i));
+                std::vector<std::pair<std::string, std::shared_ptr<net>>> inputs;
+                for (const auto& pin : type->get_input_pins())
+                {
+                    inputs.push_back({pin, nets[rng() % nets.size()]});
+                }
+                nets.push_back(connect_test_gate(nl, g, inputs, "O"));
+            }
+
+            // the 64 patterns enumerate all assignments of the inputs
+            netlist_simulator sim(nl);
+            static const u64 patterns[6] = {0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull, 0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
+            for (u32 i = 0; i < 6; ++i)
+            {
+                sim.set_input(nets[i], patterns[i]);
+            }
+            sim.simulate();
+
+            for (u32 i = 6; i < nets.size(); i += 7)
+            {
+                auto f = netlist_utils::get_subgraph_function(nets[i]);
+                for (u32 p = 0; p < 64; ++p)
+                {
+                    std::map<std::string, boolean_function::value> assignment;
+                    for (u32 j = 0; j < 6; ++j)
+                    {
+                        assignment[netlist_utils::get_net_variable_name(nets[j])] = ((p >> j) & 1) ? boolean_function::ONE : boolean_function::ZERO;
+                    }
+                    ASSERT_EQ(sim.get_value(nets[i], p), f.evaluate(assignment));
+                }
+            }
+        }
+        {
+            // Combinational loops are not simulated
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            auto a                      = nl->create_net("a");
+            auto loop                   = nl->create_net("loop");
+            auto g                      = nl->create_gate(get_gate_type_by_name("AND2"), "and");
+            a->add_dst(g, "I0");
+            loop->add_dst(g, "I1");
+            loop->set_src(g, "O");
+
+            NO_COUT_TEST_BLOCK;
+            netlist_simulator sim(nl);
+            sim.set_input(a, boolean_function::ZERO);
+            sim.simulate();
+            EXPECT_EQ(sim.get_num_evaluated_outputs(), 0);
+            EXPECT_EQ(sim.get_value(loop), bit_planes(0ull, ~0ull));
+        }
+    TEST_END
+}
@@ -0,0 +1,189 @@
+#include "netlist/gate_library/gate_library_manager.h"
+#include "netlist/netlist.h"
+#include "netlist_test_utils.h"
+#include "gtest/gtest.h"
+#include <netlist/gate.h>
+#include <netlist/net.h>
+#include <netlist/netlist_utils.h>
+
+using namespace test_utils;
+
+class netlist_utils_test : public ::testing::Test
+{
+protected:
+    virtual void SetUp()
+    {
+        NO_COUT_BLOCK;
+        gate_library_manager::load_all();
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+/**
+ * Testing the composition of the functions of a combinational cone
+ *
+ * Functions: get_subgraph_function, get_net_variable_name
+ */
+TEST_F(netlist_utils_test, check_get_subgraph_function)
+{
+    TEST_START
+        std::shared_ptr<netlist> nl = create_empty_netlist();
+        auto a                      = nl->create_net("a");
+        auto b                      = nl->create_net("b");
+        auto c                      = nl->create_net("c");
+
+        auto and_out = connect_test_gate(nl, nl->create_gate(get_gate_type_by_name("AND2"), "and"), {{"I0", a}, {"I1", b}}, "O");
+        auto inv_out = connect_test_gate(nl, nl->create_gate(get_gate_type_by_name("INV"), "inv"), {{"I", and_out}}, "O");
+        auto xor_out = connect_test_gate(nl, nl->create_gate(get_gate_type_by_name("XOR"), "xor"), {{"I0", inv_out}, {"I1", c}}, "O");
+        auto ff_out  = connect_test_gate(nl, nl->create_gate(get_gate_type_by_name("FF"), "ff"), {{"D", xor_out}}, "Q");
+        auto out     = connect_test_gate(nl, nl->create_gate(get_gate_type_by_name("AND2"), "and_ff"), {{"I0", ff_out}, {"I1", a}}, "O");
+
+        auto var = [](const std::shared_ptr<net>& n) { return boolean_function(netlist_utils::get_net_variable_name(n)); };
+        {
+            // Cones ending at nets without a source
+            EXPECT_EQ(netlist_utils::get_net_variable_name(a), "net_" + std::to_string(a->get_id()));
+            EXPECT_EQ(netlist_utils::get_subgraph_function(a), var(a));
+            EXPECT_EQ(netlist_utils::get_subgraph_function(xor_out), !(var(a) & var(b)) ^ var(c));
+        }
+        {
+            // Flip-flops stop the traversal by default
+            EXPECT_EQ(netlist_utils::get_subgraph_function(out), var(ff_out) & var(a));
+        }
+        {
+            // Custom stop condition
+            auto f = netlist_utils::get_subgraph_function(xor_out, [](const std::shared_ptr<gate>& g) { return g->get_name() == "inv"; });
+            EXPECT_EQ(f, var(inv_out) ^ var(c));
+        }
+        {
+            // Unconnected inputs are X
+            auto n = connect_test_gate(nl, nl->create_gate(get_gate_type_by_name("AND2"), "open"), {{"I0", a}}, "O");
+            EXPECT_EQ(netlist_utils::get_subgraph_function(n).evaluate({{var(a).to_string(), boolean_function::ZERO}}), boolean_function::ZERO);
+            EXPECT_EQ(netlist_utils::get_subgraph_function(n).evaluate({{var(a).to_string(), boolean_function::ONE}}), boolean_function::X);
+        }
+        {
+            // Invalid input
+            NO_COUT_TEST_BLOCK;
+            EXPECT_TRUE(netlist_utils::get_subgraph_function(nullptr).is_empty());
+        }
+    TEST_END
+}
+
+/**
+ * Testing the composition of deep cones with reconverging paths
+ *
+ * Functions: get_subgraph_function
+ */
+TEST_F(netlist_utils_test, check_get_subgraph_function_deep_cones)
+{
+    TEST_START
+        {
+            // Every net is the XOR of the two nets before it, which repeats a, b, a ^ b.
+            // Substituting the functions one by one would double the size of the function with every gate.
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            std::vector<std::shared_ptr<net>> nets = {nl->create_net("a"), nl->create_net("b")};
+            for (u32 i = 2; i <= 2000; ++i)
+            {
+                auto g = nl->create_gate(get_gate_type_by_name("XOR"), "xor_" + std::to_string(i));
+                nets.push_back(connect_test_gate(nl, g, {{"I0", nets[i - 1]}, {"I1", nets[i - 2]}}, "O"));
+            }
+
+            boolean_function a(netlist_utils::get_net_variable_name(nets[0]));
+            boolean_function b(netlist_utils::get_net_variable_name(nets[1]));
+            EXPECT_EQ(netlist_utils::get_subgraph_function(nets[2000]), a ^ b);
+            EXPECT_EQ(netlist_utils::get_subgraph_function(nets[1998]), a);
+
+            // a shared manager reuses the diagrams of the cones
+            bdd_manager manager;
+            auto f = netlist_utils::get_subgraph_function(manager, nets[1000]);
+            EXPECT_EQ(manager.to_boolean_function(f), b);
+            EXPECT_EQ(netlist_utils::get_subgraph_function(manager, nets[1999]), f);
+            EXPECT_LE(manager.get_num_nodes(), 10);
+        }
+        {
+            // Combinational loops are cut at the net closing the loop
+            std::shared_ptr<netlist> nl = create_empty_netlist();
+            auto a                      = nl->create_net("a");
+            auto loop                   = nl->create_net("loop");
+            auto g                      = nl->create_gate(get_gate_type_by_name("AND2"), "and");
+            a->add_dst(g, "I0");
+            loop->add_dst(g, "I1");
+            loop->set_src(g, "O");
+
+            auto f = netlist_utils::get_subgraph_function(loop);
+            EXPECT_EQ(f, boolean_function(netlist_utils::get_net_variable_name(a)) & boolean_function(netlist_utils::get_net_variable_name(loop)));
+        }
+    TEST_END
+}
+
+/**
+ * Testing the composition of wide cones with many inputs
+ *
+ * Functions: get_subgraph_function
+ */
+TEST_F(netlist_utils_test, check_get_subgraph_function_wide_cones)
+{
+    TEST_START
+        // balanced trees of two-input gates over the given number of inputs
+        auto build_tree = [](const std::shared_ptr<netlist>& nl, const std::string& type, u32 num_inputs, std::vector<std::shared_ptr<net>>& inputs) {
+            inputs.clear();
+            for (u32 i = 0; i < num_inputs; ++i)
+            {
+                inputs.push_back(nl->create_net(type + "_in_" + std::to_string(i)));
+            }
+            std::vector<std::shared_ptr<net>> level = inputs;
+            for (u32 i = 0; level.size() > 1; ++i)
+            {
+                std::vector<std::shared_ptr<net>> next;
+                for (u32 j = 0; j + 1 < level.size(); j += 2)
+                {
+                    auto g = nl->create_gate(get_gate_type_by_name(type == "and" ? "AND2" : "XOR"), type + "_" + std::to_string(i) + "_" + std::to_string(j));
+                    next.push_back(connect_test_gate(nl, g, {{"I0", level[j]}, {"I1", level[j + 1]}}, "O"));
+                }
+                level = next;
+            }
+            return level.front();
+        };
+        auto var = [](const std::shared_ptr<net>& n) { return boolean_function(netlist_utils::get_net_variable_name(n)); };
+
+        std::shared_ptr<netlist> nl = create_empty_netlist();
+        std::vector<std::shared_ptr<net>> inputs;
+        {
+            // The function of a wide AND cone stays small, even beyond the size of a truth table
+            auto out                  = build_tree(nl, "and", 64, inputs);
+            boolean_function expected = var(inputs[0]);
+            for (u32 i = 1; i < inputs.size(); ++i)
+            {
+                expected = expected & var(inputs[i]);
+            }
+            EXPECT_EQ(netlist_utils::get_subgraph_function(out), expected);
+        }
+        {
+            // The parity of many nets is compared on its diagrams, whose size is linear in the number of inputs.
+            // The manager also keeps the diagrams of the intermediate nets, which adds a few nodes per input and tree level.
+            auto out = build_tree(nl, "xor", 64, inputs);
+            bdd_manager manager;
+            auto f = netlist_utils::get_subgraph_function(manager, out);
+            EXPECT_LE(manager.get_num_nodes(), 16 * 64);
+
+            bdd_manager::node expected = bdd_manager::ZERO;
+            for (const auto& n : inputs)
+            {
+                expected = manager.apply_xor(expected, manager.get_variable(netlist_utils::get_net_variable_name(n)));
+            }
+            EXPECT_EQ(f, (bdd_manager::function{expected, bdd_manager::ZERO}));
+        }
+        {
+            // Converting the diagrams of a narrower parity to a boolean function expands every node once
+            auto out                  = build_tree(nl, "xor", 8, inputs);
+            boolean_function expected = var(inputs[0]);
+            for (u32 i = 1; i < inputs.size(); ++i)
+            {
+                expected = expected ^ var(inputs[i]);
+            }
+            EXPECT_EQ(netlist_utils::get_subgraph_function(out), expected);
+        }
+    TEST_END
+}
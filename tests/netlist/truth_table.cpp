@@ -0,0 +1,176 @@
+#include "netlist_test_utils.h"
+#include "gtest/gtest.h"
+#include <netlist/boolean_function.h>
+#include <netlist/truth_table.h>
+
+using namespace test_utils;
+
+class truth_table_test : public ::testing::Test
+{
+protected:
+    const boolean_function::value X    = boolean_function::value::X;
+    const boolean_function::value ZERO = boolean_function::value::ZERO;
+    const boolean_function::value ONE  = boolean_function::value::ONE;
+
+    virtual void SetUp()
+    {
+    }
+
+    virtual void TearDown()
+    {
+    }
+};
+
+/**
+ * Testing the construction of truth tables and the access to their outputs
+ *
+ * Functions: constructor, variable, from_vector, from_words, from_hex_string, to_hex_string, reverse, get_value, set_value, to_vector, size
+ */
+TEST_F(truth_table_test, check_construction)
+{
+    TEST_START
+        {
+            // Constant truth tables
+            truth_table t(3, ONE);
+            EXPECT_EQ(t.get_num_variables(), 3);
+            EXPECT_EQ(t.size(), 8);
+            EXPECT_EQ(t.to_vector(), std::vector<boolean_function::value>(8, ONE));
+            EXPECT_TRUE(t.is_constant(ONE));
+            EXPECT_TRUE(truth_table(0, X).is_constant(X));
+        }
+        {
+            // Variables within a word and across words
+            for (u32 n : {3u, 8u})
+            {
+                for (u32 var = 0; var < n; ++var)
+                {
+                    truth_table t = truth_table::variable(n, var);
+                    for (u32 i = 0; i < t.size(); ++i)
+                    {
+                        EXPECT_EQ(t.get_value(i), ((i >> var) & 1) ? ONE : ZERO);
+                    }
+                }
+            }
+        }
+        {
+            // Outputs set individually
+            std::vector<boolean_function::value> outputs = {ZERO, X, ONE, ONE};
+            truth_table t                                = truth_table::from_vector(outputs);
+            EXPECT_EQ(t.get_num_variables(), 2);
+            EXPECT_EQ(t.to_vector(), outputs);
+            t.set_value(1, ZERO);
+            EXPECT_EQ(t.get_value(1), ZERO);
+            EXPECT_EQ(t.get_ones()[0], 0xCull);
+            EXPECT_EQ(t.get_unknowns()[0], 0x0ull);
+            EXPECT_EQ(truth_table::from_words(2, {0xFFull}).get_ones()[0], 0xFull);
+        }
+        {
+            // Hex strings of arbitrary length
+            truth_table t = truth_table::from_hex_string(8, "8000000000000000000000000000000000000000000000000000000000000001");
+            EXPECT_EQ(t.get_value(0), ONE);
+            EXPECT_EQ(t.get_value(255), ONE);
+            EXPECT_EQ(t.to_vector(), t.reverse().to_vector());
+            EXPECT_EQ(t.to_hex_string(), "8000000000000000000000000000000000000000000000000000000000000001");
+            EXPECT_EQ(truth_table::from_hex_string(8, "3").to_hex_string(), "0000000000000000000000000000000000000000000000000000000000000003");
+            EXPECT_EQ(truth_table::from_hex_string(2, "F3").to_hex_string(), "3");
+            EXPECT_EQ(truth_table::from_hex_string(1, "2").get_value(1), ONE);
+            EXPECT_EQ(truth_table::from_hex_string(7, "0x80000000000000000000000000000001"), truth_table::from_hex_string(7, "80000000000000000000000000000001"));
+            EXPECT_EQ(truth_table::from_hex_string(2, "0XF3").to_hex_string(), "3");
+            EXPECT_EQ(truth_table::from_hex_string(4, "0").to_hex_string(), "0000");
+
+            // Reversing the order of the input assignments
+            EXPECT_EQ(truth_table::from_hex_string(3, "01").reverse().to_hex_string(), "80");
+            EXPECT_EQ(truth_table::from_hex_string(8, "3").reverse().get_value(254), ONE);
+            EXPECT_EQ(truth_table::from_hex_string(8, "3").reverse().get_value(253), ZERO);
+        }
+        {
+            // Invalid inputs
+            NO_COUT_TEST_BLOCK;
+            EXPECT_EQ(truth_table(truth_table::MAX_VARIABLES + 1).get_num_variables(), truth_table::MAX_VARIABLES);
+            EXPECT_EQ(truth_table::from_vector({ZERO, ONE, ONE}).get_num_variables(), 0);
+            EXPECT_TRUE(truth_table::from_hex_string(4, "12g4").is_constant(ZERO));
+        }
+    TEST_END
+}
+
+/**
+ * Testing the operators on truth tables against the evaluation of boolean functions
+ *
+ * Functions: operator&, operator|, operator^, operator!, operator==, cofactor, depends_on
+ */
+TEST_F(truth_table_test, check_operators)
+{
+    TEST_START
+        {
+            // Ternary logic of the operators
+            std::vector<boolean_function::value> a = {ZERO, ZERO, ZERO, ONE, ONE, ONE, X, X};
+            std::vector<boolean_function::value> b = {ZERO, ONE, X, ZERO, ONE, X, ZERO, ONE};
+            truth_table ta                         = truth_table::from_vector(a);
+            truth_table tb                         = truth_table::from_vector(b);
+            for (u32 i = 0; i < a.size(); ++i)
+            {
+                std::map<std::string, boolean_function::value> inputs = {{"a", a[i]}, {"b", b[i]}};
+                boolean_function fa("a"), fb("b");
+                EXPECT_EQ((ta & tb).get_value(i), (fa & fb).evaluate(inputs));
+                EXPECT_EQ((ta | tb).get_value(i), (fa | fb).evaluate(inputs));
+                EXPECT_EQ((ta ^ tb).get_value(i), (fa ^ fb).evaluate(inputs));
+                EXPECT_EQ((!ta).get_value(i), (!fa).evaluate(inputs));
+            }
+        }
+        {
+            // Cofactors within a word and across words
+            for (u32 n : {4u, 9u})
+            {
+                truth_table f = (truth_table::variable(n, 0) & truth_table::variable(n, n - 1)) | truth_table::variable(n, 2);
+                EXPECT_EQ(f.cofactor(n - 1, true), truth_table::variable(n, 0) | truth_table::variable(n, 2));
+                EXPECT_EQ(f.cofactor(n - 1, false), truth_table::variable(n, 2));
+                EXPECT_EQ(f.cofactor(0, false), truth_table::variable(n, 2));
+                EXPECT_TRUE(f.depends_on(0));
+                EXPECT_FALSE(f.depends_on(1));
+                EXPECT_TRUE(f.depends_on(n - 1));
+                EXPECT_NE(f, !f);
+            }
+        }
+    TEST_END
+}
+
+/**
+ * Testing the conversion between boolean functions and truth tables
+ *
+ * Functions: boolean_function::to_truth_table, boolean_function::from_truth_table, boolean_function::get_truth_table
+ */
+TEST_F(truth_table_test, check_boolean_function_conversion)
+{
+    TEST_START
+        {
+            boolean_function f = boolean_function::from_string("(A & !B) | (C ^ D) | (E & F & G)");
+            std::vector<std::string> vars = {"A", "B", "C", "D", "E", "F", "G"};
+
+            truth_table t = f.to_truth_table(vars);
+            for (u32 i = 0; i < t.size(); ++i)
+            {
+                std::map<std::string, boolean_function::value> inputs;
+                for (u32 j = 0; j < vars.size(); ++j)
+                {
+                    inputs[vars[j]] = ((i >> j) & 1) ? ONE : ZERO;
+                }
+                EXPECT_EQ(t.get_value(i), f.evaluate(inputs));
+            }
+            EXPECT_EQ(f.get_truth_table(vars), t.to_vector());
+
+            boolean_function g = boolean_function::from_truth_table(t, vars);
+            EXPECT_EQ(g.to_truth_table(vars), t);
+            EXPECT_TRUE(f == g);
+        }
+        {
+            // Unassigned variables evaluate to X
+            boolean_function f = boolean_function("A") & boolean_function("B");
+            EXPECT_EQ(f.to_truth_table({"A"}).to_vector(), std::vector<boolean_function::value>({ZERO, X}));
+        }
+        {
+            // Constants
+            EXPECT_TRUE(boolean_function::from_truth_table(truth_table(2, ONE), {"A", "B"}).is_constant_one());
+            EXPECT_TRUE(boolean_function::from_truth_table(truth_table(2, ZERO), {"A", "B"}).is_constant_zero());
+        }
+    TEST_END
+}
@@ -107,6 +107,38 @@ namespace test_utils
      * @returns an already created AND3 gate
      */
     std::shared_ptr<gate> create_test_gate(std::shared_ptr<netlist> nl, const u32 id);
+
+    /**
+     * Creates a gate for every given gate type with the IDs MIN_GATE_ID+0, MIN_GATE_ID+1, ...
+     * Each gate drives a net of the same ID through its first output pin.
+     *
+     * @param nl - the netlist, the gates are created in
+     * @param[in] types - the names of the gate types
+     * @returns the created gates in the order of their types
+     */
+    std::vector<std::shared_ptr<gate>> create_test_gates(std::shared_ptr<netlist> nl, const std::vector<std::string>& types);
+
+    /**
+     * Connects the net driven by a gate to an input pin of another gate.
+     *
+     * @param[in] src - the driving gate
+     * @param[in] dst - the gate to connect
+     * @param[in] pin - the input pin of dst
+     * @returns TRUE on success, FALSE otherwise
+     */
+    bool connect_gates(const std::shared_ptr<gate>& src, const std::shared_ptr<gate>& dst, const std::string& pin);
+
+    /**
+     * Connects the input pins of a gate to the given nets and creates a net "<gate name>_out" driven by its output pin.
+     *
+     * @param nl - the netlist of the gate
+     * @param[in] g - the gate to connect
+     * @param[in] inputs - pairs of an input pin and the net to connect to it
+     * @param[in] output_pin - the output pin that drives the new net
+     * @returns the net driven by the output pin
+     */
+    std::shared_ptr<net> connect_test_gate(std::shared_ptr<netlist> nl, const std::shared_ptr<gate>& g, const std::vector<std::pair<std::string, std::shared_ptr<net>>>& inputs, const std::string& output_pin);
+
     /**
      * Checks if two vectors have the same content regardless of their order. Shouldn't be used for
      * large vectors, since it isn't really efficient.
@@ -477,6 +477,39 @@ std::shared_ptr<gate> test_utils::create_test_gate(std::shared_ptr<netlist> nl,
     return res_gate;
 }
 
+std::vector<std::shared_ptr<gate>> test_utils::create_test_gates(std::shared_ptr<netlist> nl, const std::vector<std::string>& types)
+{
+    std::vector<std::shared_ptr<gate>> gates;
+    for (u32 i = 0; i < types.size(); i++)
+    {
+        std::shared_ptr<gate> g = nl->create_gate(MIN_GATE_ID + i, get_gate_type_by_name(types[i]), "gate_" + std::to_string(i));
+        nl->create_net(MIN_NET_ID + i, "net_" + std::to_string(i))->set_src(g, g->get_output_pins().front());
+        gates.push_back(g);
+    }
+    return gates;
+}
+
+bool test_utils::connect_gates(const std::shared_ptr<gate>& src, const std::shared_ptr<gate>& dst, const std::string& pin)
+{
+    auto fan_out_nets = src->get_fan_out_nets();
+    if (fan_out_nets.empty())
+    {
+        return false;
+    }
+    return (*fan_out_nets.begin())->add_dst(dst, pin);
+}
+
+std::shared_ptr<net> test_utils::connect_test_gate(std::shared_ptr<netlist> nl, const std::shared_ptr<gate>& g, const std::vector<std::pair<std::string, std::shared_ptr<net>>>& inputs, const std::string& output_pin)
+{
+    for (const auto& [pin, n] : inputs)
+    {
+        n->add_dst(g, pin);
+    }
+    auto output = nl->create_net(g->get_name() + "_out");
+    output->set_src(g, output_pin);
+    return output;
+}
+
 
 endpoint test_utils::get_dst_by_pin_type(const std::vector<endpoint> dsts, const std::string pin_type)
 {